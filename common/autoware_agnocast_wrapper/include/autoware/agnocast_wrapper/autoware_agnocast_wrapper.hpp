@@ -23,8 +23,6 @@
 #define AUTOWARE_SUBSCRIPTION_PTR(MessageT) typename agnocast::Subscription<MessageT>::SharedPtr
 #define AUTOWARE_PUBLISHER_PTR(MessageT) typename agnocast::Publisher<MessageT>::SharedPtr
 
-#define AUTOWARE_POLLING_SUBSCRIBER(MessageT) typename agnocast::PollingSubscriber<MessageT>
-
 #define AUTOWARE_CREATE_SUBSCRIPTION(message_type, topic, qos, callback, options) \
   agnocast::create_subscription<message_type>(this, topic, qos, callback, options)
 #define AUTOWARE_CREATE_PUBLISHER2(message_type, arg1, arg2) \
@@ -40,8 +38,6 @@
 
 #else
 
-#include "autoware_utils/ros/polling_subscriber.hpp"
-
 #include <rclcpp/rclcpp.hpp>
 
 #include <memory>
@@ -51,9 +47,6 @@
 #define AUTOWARE_SUBSCRIPTION_PTR(MessageT) typename rclcpp::Subscription<MessageT>::SharedPtr
 #define AUTOWARE_PUBLISHER_PTR(MessageT) typename rclcpp::Publisher<MessageT>::SharedPtr
 
-#define AUTOWARE_POLLING_SUBSCRIBER(MessageT) \
-  typename autoware_utils::InterProcessPollingSubscriber<MessageT>
-
 #define AUTOWARE_CREATE_SUBSCRIPTION(message_type, topic, qos, callback, options) \
   this->create_subscription<message_type>(topic, qos, callback, options)
 #define AUTOWARE_CREATE_PUBLISHER2(message_type, arg1, arg2) \
@@ -70,3 +63,9 @@
   std::make_shared<typename std::remove_reference<decltype(*publisher)>::type::ROSMessageType>()
 
 #endif
+
+// The polling subscriber takes messages without copying them in both modes
+#define AUTOWARE_POLLING_SUBSCRIBER(MessageT) \
+  autoware::agnocast_wrapper::PollingSubscriber<MessageT>
+
+#include "autoware/agnocast_wrapper/polling_subscriber.hpp"
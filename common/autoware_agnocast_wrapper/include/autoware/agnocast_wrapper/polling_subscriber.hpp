@@ -0,0 +1,106 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "autoware/agnocast_wrapper/autoware_agnocast_wrapper.hpp"
+
+#include <autoware/universe_utils/ros/polling_subscriber.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace autoware::agnocast_wrapper
+{
+
+/**
+ * @brief Polling subscriber keeping the latest message, which avoids message copies in both build
+ * modes. With Agnocast the message is read from shared memory. Without it, the message is taken as
+ * a middleware loan when the RMW supports it, otherwise into a buffer reused between takes.
+ *
+ * @tparam MessageT The message type.
+ */
+template <typename MessageT>
+class PollingSubscriber
+{
+public:
+  using SharedPtr = std::shared_ptr<PollingSubscriber<MessageT>>;
+
+  explicit PollingSubscriber(
+    rclcpp::Node * node, const std::string & topic_name, const rclcpp::QoS & qos = rclcpp::QoS{1})
+#ifdef USE_AGNOCAST_ENABLED
+  : subscriber_(std::make_shared<agnocast::TakeSubscription<MessageT>>(node, topic_name, qos))
+#else
+  : subscriber_(node, topic_name, qos)
+#endif
+  {
+  }
+
+  static SharedPtr create_subscription(
+    rclcpp::Node * node, const std::string & topic_name, const rclcpp::QoS & qos = rclcpp::QoS{1})
+  {
+    return std::make_shared<PollingSubscriber<MessageT>>(node, topic_name, qos);
+  }
+
+  /**
+   * @brief Retrieve the latest data. If no new data has been received, the previously received
+   * data is returned.
+   */
+  AUTOWARE_MESSAGE_SHARED_PTR(const MessageT) takeData()
+  {
+#ifdef USE_AGNOCAST_ENABLED
+    // take() returns an empty pointer unless a message not taken yet is available
+    auto msg = subscriber_->take(false);
+    metrics_.taken = static_cast<bool>(msg);
+    if (metrics_.taken) {
+      metrics_.loaned = true;
+      metrics_.reused_buffer = false;
+      metrics_.staleness_ms = autoware::universe_utils::detail::calcHeaderStalenessMs(*msg);
+      metrics_.message_size = autoware::universe_utils::detail::estimateMessageSize(*msg);
+      ++metrics_.take_count;
+      data_ = std::move(msg);
+    }
+    return data_;
+#else
+    return subscriber_.takeData();
+#endif
+  }
+
+  /**
+   * @brief Get the metrics of the last takeData() call. Without Agnocast, the staleness is
+   * measured from the middleware source timestamp. With Agnocast, it is measured from the header
+   * stamp if the message has one, and the transport latency is not available.
+   */
+  const autoware::universe_utils::TakeMetrics & lastTakeMetrics() const
+  {
+#ifdef USE_AGNOCAST_ENABLED
+    return metrics_;
+#else
+    return subscriber_.lastTakeMetrics();
+#endif
+  }
+
+private:
+#ifdef USE_AGNOCAST_ENABLED
+  typename agnocast::TakeSubscription<MessageT>::SharedPtr subscriber_;
+  AUTOWARE_MESSAGE_SHARED_PTR(const MessageT) data_;  // latest message taken
+  autoware::universe_utils::TakeMetrics metrics_;
+#else
+  autoware::universe_utils::InterProcessPollingSubscriber<MessageT> subscriber_;
+#endif
+};
+
+}  // namespace autoware::agnocast_wrapper
@@ -15,6 +15,7 @@
 #ifndef AUTOWARE__BOUNDARY_DEPARTURE_CHECKER__BOUNDARY_DEPARTURE_CHECKER_HPP_
 #define AUTOWARE__BOUNDARY_DEPARTURE_CHECKER__BOUNDARY_DEPARTURE_CHECKER_HPP_
 
+#include "autoware/boundary_departure_checker/footprint_sweep.hpp"
 #include "autoware/boundary_departure_checker/parameters.hpp"
 
 #include <autoware_utils/system/time_keeper.hpp>
@@ -45,8 +46,6 @@
 
 namespace autoware::boundary_departure_checker
 {
-using SegmentRtree = boost::geometry::index::rtree<Segment2d, boost::geometry::index::rstar<16>>;
-
 class BoundaryDepartureChecker
 {
 public:
@@ -108,18 +107,42 @@ private:
     const lanelet::ConstLanelets & candidate_lanelets,
     const std::vector<LinearRing2d> & vehicle_footprints) const;
 
-  static SegmentRtree extractUncrossableBoundaries(
-    const lanelet::LaneletMap & lanelet_map, const geometry_msgs::msg::Point & ego_point,
-    const double max_search_length, const std::vector<std::string> & boundary_types_to_detect);
-
   bool willCrossBoundary(
-    const std::vector<LinearRing2d> & vehicle_footprints,
-    const SegmentRtree & uncrossable_segments) const;
+    const std::vector<LinearRing2d> & vehicle_footprints, const SegmentRtree & uncrossable_segments,
+    const geometry_msgs::msg::Point & ego_point, const double max_search_length) const;
+
+  /**
+   * @brief get the footprints along the path, shared by the checks receiving the same path
+   */
+  FootprintSweepConstPtr getFootprintSweep(const PathWithLaneId & path) const;
+
+  static bool isAllFootprintsWithin(
+    const FootprintSweep & footprint_sweep, const autoware_utils::Polygon2d & polygon);
+
+  /**
+   * @brief rebuild the spatial indices which depend on the map, the boundary types or the lanelets
+   * of the input, so that they are computed once per map and route instead of every cycle
+   */
+  void updateSpatialIndices(const Input & input);
 
   lanelet::BasicPolygon2d toBasicPolygon2D(const LinearRing2d & footprint_hull) const;
   autoware_utils::Polygon2d toPolygon2D(const lanelet::BasicPolygon2d & poly) const;
 
   mutable std::shared_ptr<autoware_utils::TimeKeeper> time_keeper_;
+
+  // spatial indices of the last input, keyed by the map and the indexed elements
+  struct LaneletsIndex
+  {
+    std::vector<lanelet::Id> ids;
+    LaneletRtree rtree;
+  };
+  lanelet::LaneletMapPtr indexed_lanelet_map_{nullptr};
+  std::vector<std::string> indexed_boundary_types_;
+  SegmentRtree uncrossable_boundaries_;
+  LaneletsIndex route_lanelets_index_;
+  LaneletsIndex shoulder_lanelets_index_;
+
+  mutable FootprintSweepCache path_footprint_sweep_cache_;
 };
 }  // namespace autoware::boundary_departure_checker
 
@@ -0,0 +1,135 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__BOUNDARY_DEPARTURE_CHECKER__FOOTPRINT_SWEEP_HPP_
+#define AUTOWARE__BOUNDARY_DEPARTURE_CHECKER__FOOTPRINT_SWEEP_HPP_
+
+#include "autoware/boundary_departure_checker/type_alias.hpp"
+
+#include <builtin_interfaces/msg/time.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace autoware::boundary_departure_checker
+{
+/**
+ * @brief lateral and longitudinal margins added to the vehicle footprint
+ */
+struct FootprintSweepMargin
+{
+  double lat{0.0};
+  double lon{0.0};
+
+  bool operator==(const FootprintSweepMargin & other) const
+  {
+    return lat == other.lat && lon == other.lon;
+  }
+};
+
+/**
+ * @brief axis aligned bounding boxes of the footprints, stored as one array per coordinate so that
+ * the box tests along the sweep are simple loops over contiguous memory
+ */
+struct FootprintBoxes
+{
+  std::vector<double> min_x;
+  std::vector<double> min_y;
+  std::vector<double> max_x;
+  std::vector<double> max_y;
+};
+
+/**
+ * @brief vehicle footprints along a sequence of poses, for one or several margins.
+ * The rotation of each pose is computed once and shared by all the margin variants.
+ */
+class FootprintSweep
+{
+public:
+  /**
+   * @brief create the footprints along the poses
+   * @param poses poses of the base_link along the path or the trajectory
+   * @param vehicle_info vehicle information
+   * @param margins margins of the footprint variants, in the order used by the getters
+   */
+  FootprintSweep(
+    const std::vector<geometry_msgs::msg::Pose> & poses, const VehicleInfo & vehicle_info,
+    const std::vector<FootprintSweepMargin> & margins);
+
+  size_t size() const { return poses_num_; }
+  size_t getMarginsNum() const { return margins_.size(); }
+  const std::vector<FootprintSweepMargin> & getMargins() const { return margins_; }
+
+  /**
+   * @brief get the footprints of the margin variant, one for each pose
+   */
+  const std::vector<LinearRing2d> & getFootprints(const size_t margin_idx) const
+  {
+    return footprints_.at(margin_idx);
+  }
+
+  /**
+   * @brief get the bounding boxes of the footprints of the margin variant, one for each pose
+   */
+  const FootprintBoxes & getBoxes(const size_t margin_idx) const { return boxes_.at(margin_idx); }
+
+  /**
+   * @brief check for each footprint if its bounding box is covered by the given box
+   * @details a footprint can only be within a polygon if its box is covered by the polygon envelope
+   * @return flags, one for each pose
+   */
+  std::vector<uint8_t> isBoxCoveredBy(const size_t margin_idx, const Box2d & box) const;
+
+private:
+  size_t poses_num_{0};
+  std::vector<FootprintSweepMargin> margins_;
+  std::vector<std::vector<LinearRing2d>> footprints_;
+  std::vector<FootprintBoxes> boxes_;
+};
+
+using FootprintSweepConstPtr = std::shared_ptr<const FootprintSweep>;
+
+/**
+ * @brief keep the footprint sweep of the last path, so that the consumers receiving the same path
+ * several times in a cycle share the same footprints
+ * @note get() may be called concurrently, the cache is guarded by a mutex. A copy starts empty.
+ */
+class FootprintSweepCache
+{
+public:
+  FootprintSweepCache() = default;
+  FootprintSweepCache(const FootprintSweepCache &) {}
+  FootprintSweepCache & operator=(const FootprintSweepCache &) { return *this; }
+
+  /**
+   * @brief get the footprint sweep of the path, computed only if the stamp, the poses or the
+   * margins differ from the last call
+   * @return handle to the footprints which stays valid after the cache is updated
+   */
+  FootprintSweepConstPtr get(
+    const PathWithLaneId & path, const VehicleInfo & vehicle_info,
+    const std::vector<FootprintSweepMargin> & margins);
+
+private:
+  std::mutex mutex_;
+  builtin_interfaces::msg::Time stamp_;
+  std::vector<geometry_msgs::msg::Pose> poses_;
+  FootprintSweepConstPtr sweep_{nullptr};
+};
+}  // namespace autoware::boundary_departure_checker
+
+#endif  // AUTOWARE__BOUNDARY_DEPARTURE_CHECKER__FOOTPRINT_SWEEP_HPP_
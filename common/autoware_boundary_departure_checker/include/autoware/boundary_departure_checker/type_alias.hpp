@@ -20,6 +20,9 @@
 #include <autoware_planning_msgs/msg/trajectory.hpp>
 #include <autoware_planning_msgs/msg/trajectory_point.hpp>
 
+#include <boost/geometry/index/rtree.hpp>
+
+#include <utility>
 #include <vector>
 
 #ifndef AUTOWARE__BOUNDARY_DEPARTURE_CHECKER__TYPE_ALIAS_HPP_
@@ -33,6 +36,7 @@ using autoware_planning_msgs::msg::LaneletRoute;
 using autoware_planning_msgs::msg::Trajectory;
 using autoware_planning_msgs::msg::TrajectoryPoint;
 
+using autoware_utils::Box2d;
 using autoware_utils::LinearRing2d;
 using autoware_utils::LineString2d;
 using autoware_utils::MultiPoint2d;
@@ -43,6 +47,11 @@ using autoware::vehicle_info_utils::VehicleInfo;  // NOLINT
 
 using TrajectoryPoints = std::vector<TrajectoryPoint>;
 
+using SegmentRtree = boost::geometry::index::rtree<Segment2d, boost::geometry::index::rstar<16>>;
+// bounding box of a lanelet and its index in the indexed lanelets
+using LaneletNode = std::pair<Box2d, size_t>;
+using LaneletRtree = boost::geometry::index::rtree<LaneletNode, boost::geometry::index::rstar<16>>;
+
 }  // namespace autoware::boundary_departure_checker
 
 #endif  // AUTOWARE__BOUNDARY_DEPARTURE_CHECKER__TYPE_ALIAS_HPP_
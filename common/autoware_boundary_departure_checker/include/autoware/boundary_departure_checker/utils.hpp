@@ -19,10 +19,12 @@
 
 #include <geometry_msgs/msg/pose_with_covariance.hpp>
 
+#include <lanelet2_core/LaneletMap.h>
 #include <lanelet2_core/primitives/CompoundPolygon.h>
 #include <lanelet2_core/primitives/Lanelet.h>
 #include <lanelet2_core/primitives/Polygon.h>
 
+#include <string>
 #include <vector>
 
 namespace autoware::boundary_departure_checker::utils
@@ -77,6 +79,35 @@ lanelet::ConstLanelets getCandidateLanelets(
   const lanelet::ConstLanelets & route_lanelets,
   const std::vector<LinearRing2d> & vehicle_footprints);
 
+/**
+ * @brief create an R-tree of the bounding boxes of the lanelets
+ * @param lanelets lanelets to index
+ * @return R-tree whose values are the bounding boxes and the indices of the lanelets
+ */
+LaneletRtree createLaneletRtree(const lanelet::ConstLanelets & lanelets);
+
+/**
+ * @brief find lanelets that potentially intersect with the vehicle's trajectory, only checking the
+ * lanelets whose bounding box intersects the one of the convex hull of vehicle footprints
+ * @param lanelets lanelets along the planned route
+ * @param lanelets_rtree R-tree of the lanelets created with createLaneletRtree
+ * @param vehicle_footprints series of vehicle footprint polygons along the trajectory
+ * @return same lanelets in the same order as getCandidateLanelets(lanelets, vehicle_footprints)
+ */
+lanelet::ConstLanelets getCandidateLanelets(
+  const lanelet::ConstLanelets & lanelets, const LaneletRtree & lanelets_rtree,
+  const std::vector<LinearRing2d> & vehicle_footprints);
+
+/**
+ * @brief create an R-tree of the segments of the line strings with one of the given types
+ * @param lanelet_map lanelet map
+ * @param boundary_types_to_detect types of the line strings to extract
+ * @return R-tree of the segments of the uncrossable boundaries of the whole map
+ */
+SegmentRtree createUncrossableBoundariesRtree(
+  const lanelet::LaneletMap & lanelet_map,
+  const std::vector<std::string> & boundary_types_to_detect);
+
 /**
  * @brief create a convex hull from multiple footprint polygons
  * @param footprints collection of footprint polygons represented as LinearRing2d
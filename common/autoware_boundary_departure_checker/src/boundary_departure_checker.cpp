@@ -86,10 +86,13 @@ Output BoundaryDepartureChecker::update(const Input & input)
   output.vehicle_passing_areas = utils::createVehiclePassingAreas(output.vehicle_footprints);
   output.processing_time_map["createVehiclePassingAreas"] = stop_watch.toc(true);
 
-  const auto candidate_road_lanelets =
-    utils::getCandidateLanelets(input.route_lanelets, output.vehicle_footprints);
-  const auto candidate_shoulder_lanelets =
-    utils::getCandidateLanelets(input.shoulder_lanelets, output.vehicle_footprints);
+  updateSpatialIndices(input);
+  output.processing_time_map["updateSpatialIndices"] = stop_watch.toc(true);
+
+  const auto candidate_road_lanelets = utils::getCandidateLanelets(
+    input.route_lanelets, route_lanelets_index_.rtree, output.vehicle_footprints);
+  const auto candidate_shoulder_lanelets = utils::getCandidateLanelets(
+    input.shoulder_lanelets, shoulder_lanelets_index_.rtree, output.vehicle_footprints);
   output.candidate_lanelets = candidate_road_lanelets;
   output.candidate_lanelets.insert(
     output.candidate_lanelets.end(), candidate_shoulder_lanelets.begin(),
@@ -105,10 +108,9 @@ Output BoundaryDepartureChecker::update(const Input & input)
 
   const double max_search_length_for_boundaries =
     utils::calcMaxSearchLengthForBoundaries(*input.predicted_trajectory, *vehicle_info_ptr_);
-  const auto uncrossable_boundaries = extractUncrossableBoundaries(
-    *input.lanelet_map, input.predicted_trajectory->points.front().pose.position,
-    max_search_length_for_boundaries, input.boundary_types_to_detect);
-  output.will_cross_boundary = willCrossBoundary(output.vehicle_footprints, uncrossable_boundaries);
+  output.will_cross_boundary = willCrossBoundary(
+    output.vehicle_footprints, uncrossable_boundaries_,
+    input.predicted_trajectory->points.front().pose.position, max_search_length_for_boundaries);
   output.processing_time_map["willCrossBoundary"] = stop_watch.toc(true);
 
   return output;
@@ -119,8 +121,8 @@ bool BoundaryDepartureChecker::checkPathWillLeaveLane(
 {
   autoware_utils::ScopedTimeTrack st(__func__, *time_keeper_);
 
-  std::vector<LinearRing2d> vehicle_footprints =
-    utils::createVehicleFootprints(path, *vehicle_info_ptr_, param_.footprint_extra_margin);
+  const auto footprint_sweep = getFootprintSweep(path);
+  const auto & vehicle_footprints = footprint_sweep->getFootprints(0);
   lanelet::ConstLanelets candidate_lanelets =
     utils::getCandidateLanelets(lanelets, vehicle_footprints);
   return willLeaveLane(candidate_lanelets, vehicle_footprints);
@@ -147,8 +149,8 @@ std::vector<std::pair<double, lanelet::Lanelet>> BoundaryDepartureChecker::getLa
   autoware_utils::ScopedTimeTrack st(__func__, *time_keeper_);
 
   // Get Footprint Hull basic polygon
-  std::vector<LinearRing2d> vehicle_footprints =
-    utils::createVehicleFootprints(path, *vehicle_info_ptr_, param_.footprint_extra_margin);
+  const auto footprint_sweep = getFootprintSweep(path);
+  const auto & vehicle_footprints = footprint_sweep->getFootprints(0);
   LinearRing2d footprint_hull = utils::createHullFromFootprints(vehicle_footprints);
 
   lanelet::BasicPolygon2d footprint_hull_basic_polygon = toBasicPolygon2D(footprint_hull);
@@ -229,15 +231,10 @@ bool BoundaryDepartureChecker::checkPathWillLeaveLane(
   autoware_utils::ScopedTimeTrack st(__func__, *time_keeper_);
 
   // check if the footprint is not fully contained within the fused lanelets polygon
-  const std::vector<LinearRing2d> vehicle_footprints =
-    utils::createVehicleFootprints(path, *vehicle_info_ptr_, param_.footprint_extra_margin);
+  const auto footprint_sweep = getFootprintSweep(path);
   const auto fused_lanelets_polygon = getFusedLaneletPolygonForPath(lanelet_map_ptr, path);
   if (!fused_lanelets_polygon) return true;
-  return !std::all_of(
-    vehicle_footprints.begin(), vehicle_footprints.end(),
-    [&fused_lanelets_polygon](const auto & footprint) {
-      return boost::geometry::within(footprint, fused_lanelets_polygon.value());
-    });
+  return !isAllFootprintsWithin(*footprint_sweep, fused_lanelets_polygon.value());
 }
 
 bool BoundaryDepartureChecker::checkPathWillLeaveLane(
@@ -247,13 +244,10 @@ bool BoundaryDepartureChecker::checkPathWillLeaveLane(
 {
   autoware_utils::ScopedTimeTrack st(__func__, *time_keeper_);
 
-  const std::vector<LinearRing2d> vehicle_footprints =
-    utils::createVehicleFootprints(path, *vehicle_info_ptr_, param_.footprint_extra_margin);
+  const auto footprint_sweep = getFootprintSweep(path);
 
   auto is_all_footprints_within = [&](const auto & polygon) {
-    return std::all_of(
-      vehicle_footprints.begin(), vehicle_footprints.end(),
-      [&polygon](const auto & footprint) { return boost::geometry::within(footprint, polygon); });
+    return isAllFootprintsWithin(*footprint_sweep, polygon);
   };
 
   // If lanelets polygon exists and all footprints are within it, the path doesn't leave the lane
@@ -288,17 +282,24 @@ PathWithLaneId BoundaryDepartureChecker::cropPointsOutsideOfLanes(
     return temp_path;
   }
 
-  const auto vehicle_footprints =
-    utils::createVehicleFootprints(path, *vehicle_info_ptr_, param_.footprint_extra_margin);
+  const auto footprint_sweep = getFootprintSweep(path);
+  const auto & vehicle_footprints = footprint_sweep->getFootprints(0);
 
   {
     autoware_utils::ScopedTimeTrack st2(
       "check if footprint is within fused_lanelets_polygon", *time_keeper_);
 
+    // a footprint whose bounding box is not covered by the polygon envelope cannot be within it
+    const auto is_box_covered = footprint_sweep->isBoxCoveredBy(
+      0, boost::geometry::return_envelope<autoware_utils::Box2d>(fused_lanelets_polygon.value()));
+
     size_t idx = 0;
     std::for_each(
       vehicle_footprints.begin(), vehicle_footprints.end(), [&](const auto & footprint) {
-        if (idx > end_index || boost::geometry::within(footprint, fused_lanelets_polygon.value())) {
+        if (
+          idx > end_index ||
+          (is_box_covered[idx] &&
+           boost::geometry::within(footprint, fused_lanelets_polygon.value()))) {
           temp_path.points.push_back(path.points.at(idx));
         }
         ++idx;
@@ -309,6 +310,29 @@ PathWithLaneId BoundaryDepartureChecker::cropPointsOutsideOfLanes(
   return cropped_path;
 }
 
+FootprintSweepConstPtr BoundaryDepartureChecker::getFootprintSweep(
+  const PathWithLaneId & path) const
+{
+  const auto margin = param_.footprint_extra_margin;
+  return path_footprint_sweep_cache_.get(path, *vehicle_info_ptr_, {{margin, margin}});
+}
+
+bool BoundaryDepartureChecker::isAllFootprintsWithin(
+  const FootprintSweep & footprint_sweep, const autoware_utils::Polygon2d & polygon)
+{
+  // check the bounding boxes first, which rejects the footprints going out of the polygon envelope
+  const auto is_box_covered = footprint_sweep.isBoxCoveredBy(
+    0, boost::geometry::return_envelope<autoware_utils::Box2d>(polygon));
+  if (std::find(is_box_covered.begin(), is_box_covered.end(), 0) != is_box_covered.end()) {
+    return false;
+  }
+
+  const auto & vehicle_footprints = footprint_sweep.getFootprints(0);
+  return std::all_of(
+    vehicle_footprints.begin(), vehicle_footprints.end(),
+    [&polygon](const auto & footprint) { return boost::geometry::within(footprint, polygon); });
+}
+
 bool BoundaryDepartureChecker::isOutOfLane(
   const lanelet::ConstLanelets & candidate_lanelets, const LinearRing2d & vehicle_footprint)
 {
@@ -321,45 +345,54 @@ bool BoundaryDepartureChecker::isOutOfLane(
   return false;
 }
 
-SegmentRtree BoundaryDepartureChecker::extractUncrossableBoundaries(
-  const lanelet::LaneletMap & lanelet_map, const geometry_msgs::msg::Point & ego_point,
-  const double max_search_length, const std::vector<std::string> & boundary_types_to_detect)
+void BoundaryDepartureChecker::updateSpatialIndices(const Input & input)
 {
-  const auto has_types =
-    [](const lanelet::ConstLineString3d & ls, const std::vector<std::string> & types) {
-      constexpr auto no_type = "";
-      const auto type = ls.attributeOr(lanelet::AttributeName::Type, no_type);
-      return (type != no_type && std::find(types.begin(), types.end(), type) != types.end());
-    };
-
-  SegmentRtree uncrossable_segments_in_range;
-  LineString2d line;
-  const auto ego_p = Point2d{ego_point.x, ego_point.y};
-  for (const auto & ls : lanelet_map.lineStringLayer) {
-    if (has_types(ls, boundary_types_to_detect)) {
-      line.clear();
-      for (const auto & p : ls) line.push_back(Point2d{p.x(), p.y()});
-      for (auto segment_idx = 0LU; segment_idx + 1 < line.size(); ++segment_idx) {
-        const Segment2d segment = {line[segment_idx], line[segment_idx + 1]};
-        if (boost::geometry::distance(segment, ego_p) < max_search_length) {
-          uncrossable_segments_in_range.insert(segment);
-        }
-      }
-    }
+  autoware_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+
+  const bool is_map_changed = indexed_lanelet_map_ != input.lanelet_map;
+  if (is_map_changed || indexed_boundary_types_ != input.boundary_types_to_detect) {
+    uncrossable_boundaries_ =
+      utils::createUncrossableBoundariesRtree(*input.lanelet_map, input.boundary_types_to_detect);
+    indexed_boundary_types_ = input.boundary_types_to_detect;
   }
-  return uncrossable_segments_in_range;
+  // keep the map alive so that a new map cannot have the same address as the indexed one
+  indexed_lanelet_map_ = input.lanelet_map;
+
+  const auto update_lanelets_index = [&](const auto & lanelets, LaneletsIndex & index) {
+    const bool is_same_lanelets = std::equal(
+      lanelets.begin(), lanelets.end(), index.ids.begin(), index.ids.end(),
+      [](const auto & lanelet, const auto id) { return lanelet.id() == id; });
+    if (!is_map_changed && is_same_lanelets) {
+      return;
+    }
+    index.ids.clear();
+    std::transform(
+      lanelets.begin(), lanelets.end(), std::back_inserter(index.ids),
+      [](const auto & lanelet) { return lanelet.id(); });
+    index.rtree = utils::createLaneletRtree(lanelets);
+  };
+  update_lanelets_index(input.route_lanelets, route_lanelets_index_);
+  update_lanelets_index(input.shoulder_lanelets, shoulder_lanelets_index_);
 }
 
 bool BoundaryDepartureChecker::willCrossBoundary(
-  const std::vector<LinearRing2d> & vehicle_footprints,
-  const SegmentRtree & uncrossable_segments) const
+  const std::vector<LinearRing2d> & vehicle_footprints, const SegmentRtree & uncrossable_segments,
+  const geometry_msgs::msg::Point & ego_point, const double max_search_length) const
 {
   autoware_utils::ScopedTimeTrack st(__func__, *time_keeper_);
 
+  // the segments farther than max_search_length from ego are ignored
+  const auto ego_p = Point2d{ego_point.x, ego_point.y};
+  const auto is_in_range = [&](const Segment2d & segment) {
+    return boost::geometry::distance(segment, ego_p) < max_search_length;
+  };
+
   for (const auto & footprint : vehicle_footprints) {
     std::vector<Segment2d> intersection_result;
     uncrossable_segments.query(
-      boost::geometry::index::intersects(footprint), std::back_inserter(intersection_result));
+      boost::geometry::index::intersects(footprint) &&
+        boost::geometry::index::satisfies(is_in_range),
+      std::back_inserter(intersection_result));
     if (!intersection_result.empty()) {
       return true;
     }
@@ -0,0 +1,127 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/boundary_departure_checker/footprint_sweep.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace autoware::boundary_departure_checker
+{
+FootprintSweep::FootprintSweep(
+  const std::vector<geometry_msgs::msg::Pose> & poses, const VehicleInfo & vehicle_info,
+  const std::vector<FootprintSweepMargin> & margins)
+: poses_num_(poses.size()), margins_(margins)
+{
+  // Create vehicle footprints in base_link coordinate
+  std::vector<LinearRing2d> local_footprints;
+  for (const auto & margin : margins_) {
+    local_footprints.push_back(vehicle_info.createFootprint(margin.lat, margin.lon));
+  }
+
+  footprints_.resize(margins_.size());
+  boxes_.resize(margins_.size());
+  for (size_t m = 0; m < margins_.size(); ++m) {
+    footprints_[m].reserve(poses_num_);
+    auto & boxes = boxes_[m];
+    boxes.min_x.reserve(poses_num_);
+    boxes.min_y.reserve(poses_num_);
+    boxes.max_x.reserve(poses_num_);
+    boxes.max_y.reserve(poses_num_);
+  }
+
+  for (const auto & pose : poses) {
+    // rotation of the x-y plane of base_link, same as transforming with the full 3D pose
+    const auto & q = pose.orientation;
+    const double r00 = 1.0 - 2.0 * (q.y * q.y + q.z * q.z);
+    const double r01 = 2.0 * (q.x * q.y - q.z * q.w);
+    const double r10 = 2.0 * (q.x * q.y + q.z * q.w);
+    const double r11 = 1.0 - 2.0 * (q.x * q.x + q.z * q.z);
+    const double tx = pose.position.x;
+    const double ty = pose.position.y;
+
+    for (size_t m = 0; m < margins_.size(); ++m) {
+      double min_x = std::numeric_limits<double>::max();
+      double min_y = std::numeric_limits<double>::max();
+      double max_x = std::numeric_limits<double>::lowest();
+      double max_y = std::numeric_limits<double>::lowest();
+
+      LinearRing2d footprint;
+      footprint.reserve(local_footprints[m].size());
+      for (const auto & p : local_footprints[m]) {
+        const double x = r00 * p.x() + r01 * p.y() + tx;
+        const double y = r10 * p.x() + r11 * p.y() + ty;
+        footprint.emplace_back(x, y);
+        min_x = std::min(min_x, x);
+        min_y = std::min(min_y, y);
+        max_x = std::max(max_x, x);
+        max_y = std::max(max_y, y);
+      }
+      footprints_[m].push_back(std::move(footprint));
+
+      auto & boxes = boxes_[m];
+      boxes.min_x.push_back(min_x);
+      boxes.min_y.push_back(min_y);
+      boxes.max_x.push_back(max_x);
+      boxes.max_y.push_back(max_y);
+    }
+  }
+}
+
+std::vector<uint8_t> FootprintSweep::isBoxCoveredBy(
+  const size_t margin_idx, const Box2d & box) const
+{
+  const auto & boxes = boxes_.at(margin_idx);
+  const double box_min_x = box.min_corner().x();
+  const double box_min_y = box.min_corner().y();
+  const double box_max_x = box.max_corner().x();
+  const double box_max_y = box.max_corner().y();
+
+  std::vector<uint8_t> is_covered(poses_num_);
+  for (size_t i = 0; i < poses_num_; ++i) {
+    is_covered[i] = static_cast<uint8_t>(
+      (box_min_x <= boxes.min_x[i]) & (box_min_y <= boxes.min_y[i]) &
+      (boxes.max_x[i] <= box_max_x) & (boxes.max_y[i] <= box_max_y));
+  }
+  return is_covered;
+}
+
+FootprintSweepConstPtr FootprintSweepCache::get(
+  const PathWithLaneId & path, const VehicleInfo & vehicle_info,
+  const std::vector<FootprintSweepMargin> & margins)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  const bool is_same_path =
+    sweep_ && stamp_ == path.header.stamp && sweep_->getMargins() == margins &&
+    std::equal(
+      path.points.begin(), path.points.end(), poses_.begin(), poses_.end(),
+      [](const auto & p, const auto & pose) { return p.point.pose == pose; });
+  if (is_same_path) {
+    return sweep_;
+  }
+
+  stamp_ = path.header.stamp;
+  poses_.clear();
+  poses_.reserve(path.points.size());
+  for (const auto & p : path.points) {
+    poses_.push_back(p.point.pose);
+  }
+  sweep_ = std::make_shared<const FootprintSweep>(poses_, vehicle_info, margins);
+  return sweep_;
+}
+}  // namespace autoware::boundary_departure_checker
@@ -14,13 +14,19 @@
 
 #include "autoware/boundary_departure_checker/utils.hpp"
 
+#include "autoware/boundary_departure_checker/footprint_sweep.hpp"
+
 #include <autoware/motion_utils/trajectory/trajectory.hpp>
 #include <autoware_utils/geometry/geometry.hpp>
 
 #include <boost/geometry.hpp>
 
+#include <lanelet2_core/geometry/Lanelet.h>
 #include <lanelet2_core/geometry/Polygon.h>
 
+#include <algorithm>
+#include <iterator>
+#include <string>
 #include <vector>
 
 namespace
@@ -136,34 +142,27 @@ std::vector<LinearRing2d> createVehicleFootprints(
   // Calculate longitudinal and lateral margin based on covariance
   const auto margin = calcFootprintMargin(covariance, footprint_margin_scale);
 
-  // Create vehicle footprint in base_link coordinate
-  const auto local_vehicle_footprint = vehicle_info.createFootprint(margin.lat, margin.lon);
-
-  // Create vehicle footprint on each TrajectoryPoint
-  std::vector<LinearRing2d> vehicle_footprints;
+  std::vector<geometry_msgs::msg::Pose> poses;
+  poses.reserve(trajectory.size());
   for (const auto & p : trajectory) {
-    vehicle_footprints.push_back(autoware_utils::transform_vector(
-      local_vehicle_footprint, autoware_utils::pose2transform(p.pose)));
+    poses.push_back(p.pose);
   }
 
-  return vehicle_footprints;
+  return FootprintSweep(poses, vehicle_info, {{margin.lat, margin.lon}}).getFootprints(0);
 }
 
 std::vector<LinearRing2d> createVehicleFootprints(
   const PathWithLaneId & path, const autoware::vehicle_info_utils::VehicleInfo & vehicle_info,
   const double footprint_extra_margin)
 {
-  // Create vehicle footprint in base_link coordinate
-  const auto local_vehicle_footprint = vehicle_info.createFootprint(footprint_extra_margin);
-
-  // Create vehicle footprint on each Path point
-  std::vector<LinearRing2d> vehicle_footprints;
+  std::vector<geometry_msgs::msg::Pose> poses;
+  poses.reserve(path.points.size());
   for (const auto & p : path.points) {
-    vehicle_footprints.push_back(autoware_utils::transform_vector(
-      local_vehicle_footprint, autoware_utils::pose2transform(p.point.pose)));
+    poses.push_back(p.point.pose);
   }
 
-  return vehicle_footprints;
+  return FootprintSweep(poses, vehicle_info, {{footprint_extra_margin, footprint_extra_margin}})
+    .getFootprints(0);
 }
 
 lanelet::ConstLanelets getCandidateLanelets(
@@ -185,6 +184,71 @@ lanelet::ConstLanelets getCandidateLanelets(
   return candidate_lanelets;
 }
 
+LaneletRtree createLaneletRtree(const lanelet::ConstLanelets & lanelets)
+{
+  std::vector<LaneletNode> nodes;
+  nodes.reserve(lanelets.size());
+  for (size_t i = 0; i < lanelets.size(); ++i) {
+    const auto bbox = lanelet::geometry::boundingBox2d(lanelets.at(i));
+    nodes.emplace_back(
+      Box2d{{bbox.min().x(), bbox.min().y()}, {bbox.max().x(), bbox.max().y()}}, i);
+  }
+  return LaneletRtree(nodes.begin(), nodes.end());
+}
+
+lanelet::ConstLanelets getCandidateLanelets(
+  const lanelet::ConstLanelets & lanelets, const LaneletRtree & lanelets_rtree,
+  const std::vector<LinearRing2d> & vehicle_footprints)
+{
+  lanelet::ConstLanelets candidate_lanelets;
+
+  // Find lanes within the convex hull of footprints
+  const auto footprint_hull = createHullFromFootprints(vehicle_footprints);
+
+  std::vector<LaneletNode> nodes;
+  lanelets_rtree.query(
+    boost::geometry::index::intersects(boost::geometry::return_envelope<Box2d>(footprint_hull)),
+    std::back_inserter(nodes));
+  // keep the order of the input lanelets
+  std::sort(
+    nodes.begin(), nodes.end(), [](const auto & a, const auto & b) { return a.second < b.second; });
+
+  for (const auto & node : nodes) {
+    const auto & lanelet = lanelets.at(node.second);
+    const auto poly = lanelet.polygon2d().basicPolygon();
+    if (!boost::geometry::disjoint(poly, footprint_hull)) {
+      candidate_lanelets.push_back(lanelet);
+    }
+  }
+
+  return candidate_lanelets;
+}
+
+SegmentRtree createUncrossableBoundariesRtree(
+  const lanelet::LaneletMap & lanelet_map,
+  const std::vector<std::string> & boundary_types_to_detect)
+{
+  const auto has_types =
+    [](const lanelet::ConstLineString3d & ls, const std::vector<std::string> & types) {
+      constexpr auto no_type = "";
+      const auto type = ls.attributeOr(lanelet::AttributeName::Type, no_type);
+      return (type != no_type && std::find(types.begin(), types.end(), type) != types.end());
+    };
+
+  std::vector<Segment2d> uncrossable_segments;
+  for (const auto & ls : lanelet_map.lineStringLayer) {
+    if (!has_types(ls, boundary_types_to_detect)) {
+      continue;
+    }
+    for (auto segment_idx = 0LU; segment_idx + 1 < ls.size(); ++segment_idx) {
+      const auto & p1 = ls[segment_idx];
+      const auto & p2 = ls[segment_idx + 1];
+      uncrossable_segments.emplace_back(Point2d{p1.x(), p1.y()}, Point2d{p2.x(), p2.y()});
+    }
+  }
+  return SegmentRtree(uncrossable_segments.begin(), uncrossable_segments.end());
+}
+
 LinearRing2d createHullFromFootprints(const std::vector<LinearRing2d> & footprints)
 {
   MultiPoint2d combined;
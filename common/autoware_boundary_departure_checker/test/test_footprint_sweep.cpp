@@ -0,0 +1,157 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/boundary_departure_checker/footprint_sweep.hpp"
+#include "autoware/boundary_departure_checker/utils.hpp"
+
+#include <autoware_utils/geometry/geometry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+using autoware::boundary_departure_checker::FootprintSweep;
+using autoware::boundary_departure_checker::FootprintSweepCache;
+using autoware::boundary_departure_checker::FootprintSweepMargin;
+using autoware_internal_planning_msgs::msg::PathPointWithLaneId;
+using autoware_internal_planning_msgs::msg::PathWithLaneId;
+
+namespace
+{
+PathWithLaneId create_path()
+{
+  PathWithLaneId path;
+  for (int i = 0; i < 10; ++i) {
+    const double yaw = 0.3 * i;
+    PathPointWithLaneId p;
+    p.point.pose.position.x = 2.0 * i;
+    p.point.pose.position.y = 0.5 * i * i;
+    p.point.pose.orientation.z = std::sin(yaw / 2);
+    p.point.pose.orientation.w = std::cos(yaw / 2);
+    path.points.push_back(p);
+  }
+  return path;
+}
+
+std::vector<geometry_msgs::msg::Pose> get_poses(const PathWithLaneId & path)
+{
+  std::vector<geometry_msgs::msg::Pose> poses;
+  for (const auto & p : path.points) {
+    poses.push_back(p.point.pose);
+  }
+  return poses;
+}
+
+void expect_same_footprint(
+  const autoware_utils::LinearRing2d & footprint, const autoware_utils::LinearRing2d & expected)
+{
+  ASSERT_EQ(footprint.size(), expected.size());
+  for (size_t j = 0; j < expected.size(); ++j) {
+    EXPECT_NEAR(footprint.at(j).x(), expected.at(j).x(), 1e-9);
+    EXPECT_NEAR(footprint.at(j).y(), expected.at(j).y(), 1e-9);
+  }
+}
+
+autoware::vehicle_info_utils::VehicleInfo create_vehicle_info()
+{
+  return autoware::vehicle_info_utils::createVehicleInfo(
+    0.383, 0.235, 2.79, 1.64, 1.0, 1.1, 0.128, 0.128, 2.5, 0.70);
+}
+}  // namespace
+
+TEST(FootprintSweepTest, SameAsTransformedVehicleFootprint)
+{
+  const auto vehicle_info = create_vehicle_info();
+  const auto path = create_path();
+  // asymmetric margins, so that swapping the lateral and longitudinal margins is detected
+  const std::vector<FootprintSweepMargin> margins = {{0.3, 0.8}, {0.0, 0.0}};
+  const FootprintSweep sweep(get_poses(path), vehicle_info, margins);
+
+  ASSERT_EQ(sweep.size(), path.points.size());
+  ASSERT_EQ(sweep.getMarginsNum(), margins.size());
+  for (size_t m = 0; m < margins.size(); ++m) {
+    const auto local_footprint =
+      vehicle_info.createFootprint(margins.at(m).lat, margins.at(m).lon);
+    const auto & footprints = sweep.getFootprints(m);
+    const auto & boxes = sweep.getBoxes(m);
+    ASSERT_EQ(footprints.size(), path.points.size());
+    for (size_t i = 0; i < path.points.size(); ++i) {
+      const auto expected = autoware_utils::transform_vector(
+        local_footprint, autoware_utils::pose2transform(path.points.at(i).point.pose));
+      expect_same_footprint(footprints.at(i), expected);
+      for (const auto & p : footprints.at(i)) {
+        EXPECT_LE(boxes.min_x.at(i), p.x());
+        EXPECT_LE(boxes.min_y.at(i), p.y());
+        EXPECT_GE(boxes.max_x.at(i), p.x());
+        EXPECT_GE(boxes.max_y.at(i), p.y());
+      }
+    }
+  }
+}
+
+TEST(FootprintSweepTest, CreateVehicleFootprintsOfPath)
+{
+  const auto vehicle_info = create_vehicle_info();
+  const auto path = create_path();
+  const double margin = 0.5;
+
+  const auto footprints = autoware::boundary_departure_checker::utils::createVehicleFootprints(
+    path, vehicle_info, margin);
+  const auto local_footprint = vehicle_info.createFootprint(margin, margin);
+  ASSERT_EQ(footprints.size(), path.points.size());
+  for (size_t i = 0; i < path.points.size(); ++i) {
+    expect_same_footprint(
+      footprints.at(i),
+      autoware_utils::transform_vector(
+        local_footprint, autoware_utils::pose2transform(path.points.at(i).point.pose)));
+  }
+}
+
+TEST(FootprintSweepTest, IsBoxCoveredBy)
+{
+  const auto vehicle_info = create_vehicle_info();
+  const FootprintSweep sweep(get_poses(create_path()), vehicle_info, {{0.0, 0.0}});
+  const auto & boxes = sweep.getBoxes(0);
+
+  const autoware_utils::Box2d box{{-10.0, -10.0}, {boxes.max_x.at(4), boxes.max_y.at(4)}};
+  const auto is_covered = sweep.isBoxCoveredBy(0, box);
+  ASSERT_EQ(is_covered.size(), sweep.size());
+  for (size_t i = 0; i < sweep.size(); ++i) {
+    const bool expected = boxes.max_x.at(i) <= boxes.max_x.at(4) &&
+                          boxes.max_y.at(i) <= boxes.max_y.at(4);
+    EXPECT_EQ(is_covered.at(i) != 0, expected);
+  }
+}
+
+TEST(FootprintSweepTest, CacheReusesSweepOfSamePath)
+{
+  const auto vehicle_info = create_vehicle_info();
+  auto path = create_path();
+  FootprintSweepCache cache;
+
+  const auto sweep = cache.get(path, vehicle_info, {{0.1, 0.1}});
+  EXPECT_EQ(cache.get(path, vehicle_info, {{0.1, 0.1}}), sweep);
+  EXPECT_NE(cache.get(path, vehicle_info, {{0.2, 0.2}}), sweep);
+
+  const auto sweep2 = cache.get(path, vehicle_info, {{0.1, 0.1}});
+  path.points.back().point.pose.position.x += 1.0;
+  const auto sweep3 = cache.get(path, vehicle_info, {{0.1, 0.1}});
+  EXPECT_NE(sweep3, sweep2);
+  // the handle of the previous path is still valid
+  EXPECT_EQ(sweep2->size(), path.points.size());
+
+  path.header.stamp.sec += 1;
+  EXPECT_NE(cache.get(path, vehicle_info, {{0.1, 0.1}}), sweep3);
+}
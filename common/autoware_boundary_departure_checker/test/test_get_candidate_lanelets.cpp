@@ -0,0 +1,114 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/boundary_departure_checker/utils.hpp"
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+
+#include <string>
+#include <vector>
+
+using autoware::boundary_departure_checker::LinearRing2d;
+
+namespace
+{
+// straight lanelet of 10 m x 4 m whose left bound is at y = y_left
+lanelet::Lanelet create_lanelet(const lanelet::Id id, const double x_start, const double y_left)
+{
+  const lanelet::LineString3d left(
+    lanelet::InvalId, {lanelet::Point3d(lanelet::InvalId, x_start, y_left, 0.0),
+                       lanelet::Point3d(lanelet::InvalId, x_start + 10.0, y_left, 0.0)});
+  const lanelet::LineString3d right(
+    lanelet::InvalId, {lanelet::Point3d(lanelet::InvalId, x_start, y_left - 4.0, 0.0),
+                       lanelet::Point3d(lanelet::InvalId, x_start + 10.0, y_left - 4.0, 0.0)});
+  return lanelet::Lanelet(id, left, right);
+}
+
+LinearRing2d create_footprint(const double x, const double y)
+{
+  LinearRing2d footprint;
+  footprint.push_back({x + 2.0, y + 1.0});
+  footprint.push_back({x + 2.0, y - 1.0});
+  footprint.push_back({x - 2.0, y - 1.0});
+  footprint.push_back({x - 2.0, y + 1.0});
+  footprint.push_back({x + 2.0, y + 1.0});
+  return footprint;
+}
+
+std::vector<lanelet::Id> get_ids(const lanelet::ConstLanelets & lanelets)
+{
+  std::vector<lanelet::Id> ids;
+  for (const auto & lanelet : lanelets) {
+    ids.push_back(lanelet.id());
+  }
+  return ids;
+}
+}  // namespace
+
+TEST(BoundaryDepartureCheckerTest, GetCandidateLaneletsWithRtree)
+{
+  using autoware::boundary_departure_checker::utils::createLaneletRtree;
+  using autoware::boundary_departure_checker::utils::getCandidateLanelets;
+
+  // grid of 5 x 5 lanelets, listed in a non spatial order
+  lanelet::ConstLanelets lanelets;
+  for (int i = 0; i < 5; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      lanelets.push_back(create_lanelet(100 + (4 - i) * 5 + j, 10.0 * (4 - i), 4.0 * j));
+    }
+  }
+  const auto rtree = createLaneletRtree(lanelets);
+  EXPECT_EQ(rtree.size(), lanelets.size());
+
+  const std::vector<std::vector<LinearRing2d>> footprints_list = {
+    {create_footprint(5.0, 2.0)},
+    {create_footprint(5.0, 2.0), create_footprint(15.0, 2.0), create_footprint(25.0, 6.0)},
+    {create_footprint(9.5, 3.5), create_footprint(20.5, 4.5)},
+    {create_footprint(30.0, 8.0), create_footprint(10.0, -10.0)},
+    {create_footprint(100.0, 100.0)},
+  };
+  for (const auto & footprints : footprints_list) {
+    const auto expected = getCandidateLanelets(lanelets, footprints);
+    const auto result = getCandidateLanelets(lanelets, rtree, footprints);
+    EXPECT_EQ(get_ids(result), get_ids(expected));
+  }
+}
+
+TEST(BoundaryDepartureCheckerTest, CreateUncrossableBoundariesRtree)
+{
+  using autoware::boundary_departure_checker::utils::createUncrossableBoundariesRtree;
+
+  lanelet::LineString3d road_border(
+    lanelet::InvalId, {lanelet::Point3d(lanelet::InvalId, 0.0, 0.0, 0.0),
+                       lanelet::Point3d(lanelet::InvalId, 10.0, 0.0, 0.0),
+                       lanelet::Point3d(lanelet::InvalId, 20.0, 0.0, 0.0)});
+  road_border.attributes()[lanelet::AttributeName::Type] = "road_border";
+  lanelet::LineString3d line_thin(
+    lanelet::InvalId, {lanelet::Point3d(lanelet::InvalId, 0.0, 4.0, 0.0),
+                       lanelet::Point3d(lanelet::InvalId, 20.0, 4.0, 0.0)});
+  line_thin.attributes()[lanelet::AttributeName::Type] = "line_thin";
+  lanelet::LineString3d untyped(
+    lanelet::InvalId, {lanelet::Point3d(lanelet::InvalId, 0.0, 8.0, 0.0),
+                       lanelet::Point3d(lanelet::InvalId, 20.0, 8.0, 0.0)});
+
+  lanelet::LaneletMap map;
+  map.add(road_border);
+  map.add(line_thin);
+  map.add(untyped);
+
+  EXPECT_EQ(createUncrossableBoundariesRtree(map, {"road_border"}).size(), 2U);
+  EXPECT_EQ(createUncrossableBoundariesRtree(map, {"road_border", "line_thin"}).size(), 3U);
+  EXPECT_TRUE(createUncrossableBoundariesRtree(map, {}).empty());
+}
@@ -0,0 +1,162 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__UNIVERSE_UTILS__MATH__QUANTILE_ACCUMULATOR_HPP_
+#define AUTOWARE__UNIVERSE_UTILS__MATH__QUANTILE_ACCUMULATOR_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace autoware::universe_utils
+{
+/**
+ * @brief class to estimate a quantile of streaming data in constant memory.
+ * @details This is the P-square algorithm of Jain and Chlamtac (1985): five markers track the
+ * minimum, the p/2, p, (1+p)/2 quantiles and the maximum, and their heights are adjusted with a
+ * piecewise-parabolic interpolation as the values are added. The values are not stored.
+ * @typedef T type of the values (default to double)
+ */
+template <typename T = double>
+class QuantileAccumulator
+{
+public:
+  /**
+   * @brief constructor
+   * @param probability probability of the quantile to estimate, in [0, 1]
+   * @throw std::invalid_argument if the probability is out of range
+   */
+  explicit QuantileAccumulator(const double probability) : probability_(probability)
+  {
+    if (!(0.0 <= probability && probability <= 1.0)) {
+      throw std::invalid_argument("QuantileAccumulator: probability must be in [0, 1]");
+    }
+    desired_positions_ = {1.0, 1.0 + 2.0 * probability, 1.0 + 4.0 * probability,
+                          3.0 + 2.0 * probability, 5.0};
+    increments_ = {0.0, probability / 2.0, probability, (1.0 + probability) / 2.0, 1.0};
+  }
+
+  /**
+   * @brief add a value
+   * @param value value to add
+   */
+  void add(const T & value)
+  {
+    const auto x = static_cast<double>(value);
+    if (count_ < num_markers) {
+      heights_[count_++] = x;
+      if (count_ == num_markers) {
+        std::sort(heights_.begin(), heights_.end());
+      }
+      return;
+    }
+    ++count_;
+
+    // Find the cell of the value, extending the extreme markers if needed
+    size_t k = 0;
+    if (x < heights_[0]) {
+      heights_[0] = x;
+    } else if (x >= heights_[4]) {
+      heights_[4] = x;
+      k = 3;
+    } else {
+      while (x >= heights_[k + 1]) {
+        ++k;
+      }
+    }
+    for (size_t i = k + 1; i < num_markers; ++i) {
+      positions_[i] += 1.0;
+    }
+    for (size_t i = 0; i < num_markers; ++i) {
+      desired_positions_[i] += increments_[i];
+    }
+
+    // Move the middle markers toward their desired positions
+    for (size_t i = 1; i < num_markers - 1; ++i) {
+      const double d = desired_positions_[i] - positions_[i];
+      if (
+        (d >= 1.0 && positions_[i + 1] - positions_[i] > 1.0) ||
+        (d <= -1.0 && positions_[i - 1] - positions_[i] < -1.0)) {
+        const double sign = d > 0.0 ? 1.0 : -1.0;
+        const double height = parabolic(i, sign);
+        if (heights_[i - 1] < height && height < heights_[i + 1]) {
+          heights_[i] = height;
+        } else {
+          heights_[i] = linear(i, sign);
+        }
+        positions_[i] += sign;
+      }
+    }
+  }
+
+  /**
+   * @brief get the estimated quantile, which is exact while less than 5 values were added
+   * @return the quantile, or NaN if no value was added
+   */
+  double quantile() const
+  {
+    if (count_ == 0) {
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+    if (count_ < num_markers) {
+      // Nearest rank of the few values seen so far
+      std::array<double, num_markers> sorted = heights_;
+      std::sort(sorted.begin(), sorted.begin() + count_);
+      const auto rank = static_cast<size_t>(std::lround(probability_ * (count_ - 1)));
+      return sorted[rank];
+    }
+    return heights_[2];
+  }
+
+  /**
+   * @brief get the probability of the estimated quantile
+   */
+  double probability() const { return probability_; }
+
+  /**
+   * @brief get the number of values used to build this statistic
+   */
+  unsigned int count() const { return count_; }
+
+private:
+  static constexpr size_t num_markers = 5;
+
+  double parabolic(const size_t i, const double d) const
+  {
+    const auto & q = heights_;
+    const auto & n = positions_;
+    return q[i] + d / (n[i + 1] - n[i - 1]) *
+                    ((n[i] - n[i - 1] + d) * (q[i + 1] - q[i]) / (n[i + 1] - n[i]) +
+                     (n[i + 1] - n[i] - d) * (q[i] - q[i - 1]) / (n[i] - n[i - 1]));
+  }
+
+  double linear(const size_t i, const double d) const
+  {
+    const size_t j = d > 0.0 ? i + 1 : i - 1;
+    return heights_[i] + d * (heights_[j] - heights_[i]) / (positions_[j] - positions_[i]);
+  }
+
+  double probability_;
+  std::array<double, num_markers> heights_{};
+  std::array<double, num_markers> positions_{1.0, 2.0, 3.0, 4.0, 5.0};
+  std::array<double, num_markers> desired_positions_{};
+  std::array<double, num_markers> increments_{};
+  unsigned int count_ = 0;
+};
+
+}  // namespace autoware::universe_utils
+
+#endif  // AUTOWARE__UNIVERSE_UTILS__MATH__QUANTILE_ACCUMULATOR_HPP_
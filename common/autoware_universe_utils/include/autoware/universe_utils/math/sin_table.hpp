@@ -15,15 +15,107 @@
 #ifndef AUTOWARE__UNIVERSE_UTILS__MATH__SIN_TABLE_HPP_
 #define AUTOWARE__UNIVERSE_UTILS__MATH__SIN_TABLE_HPP_
 
+#include "autoware/universe_utils/math/constants.hpp"
+
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <utility>
 
 namespace autoware::universe_utils
 {
 
-constexpr size_t sin_table_size = 32769;
-constexpr size_t discrete_arcs_num_90 = 32768;
-constexpr size_t discrete_arcs_num_360 = 131072;
-extern const float g_sin_table[sin_table_size];
+namespace detail_sin_table
+{
+/**
+ * @brief compile-time sine for x in [0, pi/2] using its Taylor series
+ */
+constexpr double constexpr_sin(const double x)
+{
+  double term = x;
+  double sum = x;
+  const double x2 = x * x;
+  for (int n = 1; n < 16; ++n) {
+    term *= -x2 / static_cast<double>((2 * n) * (2 * n + 1));
+    sum += term;
+  }
+  return sum;
+}
+}  // namespace detail_sin_table
+
+/**
+ * @brief sine table for the first quadrant generated at compile time, evaluated with linear
+ * interpolation between the samples
+ * @tparam DiscreteArcsNum90 number of intervals in [0, pi/2], must be a power of two. The
+ * interpolation error is bounded by (pi / 2 / DiscreteArcsNum90)^2 / 8.
+ */
+template <size_t DiscreteArcsNum90>
+class SinTable
+{
+  static_assert(
+    DiscreteArcsNum90 > 0 && (DiscreteArcsNum90 & (DiscreteArcsNum90 - 1)) == 0,
+    "DiscreteArcsNum90 must be a power of two");
+
+public:
+  static constexpr size_t discrete_arcs_num_90 = DiscreteArcsNum90;
+  static constexpr size_t discrete_arcs_num_360 = 4 * DiscreteArcsNum90;
+  static constexpr size_t size = DiscreteArcsNum90 + 1;
+
+  constexpr SinTable() : values_{}
+  {
+    for (size_t i = 0; i < size; ++i) {
+      values_[i] = static_cast<float>(detail_sin_table::constexpr_sin(
+        static_cast<double>(i) * (pi / 2.0) / static_cast<double>(DiscreteArcsNum90)));
+    }
+  }
+
+  constexpr float operator[](const size_t idx) const { return values_[idx]; }
+
+  /**
+   * @brief get sin and cos of the angle at once
+   * @param radian angle, any range
+   * @return pair of sin and cos
+   */
+  std::pair<float, float> sin_and_cos(const double radian) const
+  {
+    constexpr double scale = static_cast<double>(discrete_arcs_num_360) / (2.0 * pi);
+    constexpr int64_t mask_90 = static_cast<int64_t>(discrete_arcs_num_90) - 1;
+
+    const double arc = radian * scale;
+    // floor without the libm call, which is not inlined on targets without SSE4.1
+    const auto arc_trunc = static_cast<int64_t>(arc);
+    const int64_t arc_idx = arc_trunc - (arc < static_cast<double>(arc_trunc) ? 1 : 0);
+    const auto ratio = static_cast<float>(arc - static_cast<double>(arc_idx));
+    const auto quadrant = static_cast<int64_t>(
+      static_cast<uint64_t>(arc_idx) / discrete_arcs_num_90 % 4);  // two's complement wrap
+    const auto idx = static_cast<size_t>(arc_idx & mask_90);
+
+    // sin(x) and cos(x) of the angle reduced to the first quadrant
+    const float s = values_[idx] + (values_[idx + 1] - values_[idx]) * ratio;
+    const float c = values_[discrete_arcs_num_90 - idx] +
+                    (values_[discrete_arcs_num_90 - idx - 1] - values_[discrete_arcs_num_90 - idx]) *
+                      ratio;
+
+    // quadrant 0: (s, c), 1: (c, -s), 2: (-s, -c), 3: (-c, s), written without branches
+    const bool swap = (quadrant & 1) != 0;
+    const float sin_sign = (quadrant & 2) != 0 ? -1.f : 1.f;
+    const float cos_sign = ((quadrant + 1) & 2) != 0 ? -1.f : 1.f;
+    return {sin_sign * (swap ? c : s), cos_sign * (swap ? s : c)};
+  }
+
+  float sin(const double radian) const { return sin_and_cos(radian).first; }
+
+  float cos(const double radian) const { return sin_and_cos(radian).second; }
+
+private:
+  std::array<float, size> values_;
+};
+
+// 2048 intervals keep the interpolation error (~7.4e-8) below the float resolution around 1.0
+constexpr size_t discrete_arcs_num_90 = 2048;
+constexpr size_t discrete_arcs_num_360 = 4 * discrete_arcs_num_90;
+constexpr size_t sin_table_size = discrete_arcs_num_90 + 1;
+inline constexpr SinTable<discrete_arcs_num_90> g_sin_table{};
 
 }  // namespace autoware::universe_utils
 
@@ -15,6 +15,7 @@
 #ifndef AUTOWARE__UNIVERSE_UTILS__MATH__TRIGONOMETRY_HPP_
 #define AUTOWARE__UNIVERSE_UTILS__MATH__TRIGONOMETRY_HPP_
 
+#include <cstddef>
 #include <utility>
 
 namespace autoware::universe_utils
@@ -28,6 +29,23 @@ std::pair<float, float> sin_and_cos(float radian);
 
 float opencv_fast_atan2(float dy, float dx);
 
+/**
+ * @brief element-wise versions of the functions above for contiguous arrays. The loops contain no
+ * branches so that the compiler can vectorize the arithmetic around the table lookups.
+ * @param size number of elements of every input and output array
+ */
+void sin(const float * radians, float * out, size_t size);
+void sin(const double * radians, double * out, size_t size);
+
+void cos(const float * radians, float * out, size_t size);
+void cos(const double * radians, double * out, size_t size);
+
+void sin_and_cos(const float * radians, float * sin_out, float * cos_out, size_t size);
+void sin_and_cos(const double * radians, double * sin_out, double * cos_out, size_t size);
+
+void opencv_fast_atan2(const float * dy, const float * dx, float * out, size_t size);
+void opencv_fast_atan2(const double * dy, const double * dx, double * out, size_t size);
+
 }  // namespace autoware::universe_utils
 
 #endif  // AUTOWARE__UNIVERSE_UTILS__MATH__TRIGONOMETRY_HPP_
@@ -16,9 +16,15 @@
 
 #include <rclcpp/rclcpp.hpp>
 
+#include <rcl/subscription.h>
+
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace autoware::universe_utils
@@ -35,6 +41,90 @@ inline rclcpp::SensorDataQoS SingleDepthSensorQoS()
   return qos;
 }
 
+/**
+ * @brief Metrics of the last message taken by a polling subscriber.
+ */
+struct TakeMetrics
+{
+  bool taken{false};                 ///< Whether the last takeData() received a new message
+  bool loaned{false};                ///< Whether the message was loaned by the middleware
+  bool reused_buffer{false};         ///< Whether a previously allocated buffer was reused
+  double staleness_ms{0.0};          ///< Time from publication to take
+  double transport_latency_ms{0.0};  ///< Time from publication to reception by the middleware
+  size_t message_size{0};            ///< Approximate size of the message payload in bytes
+  uint64_t take_count{0};            ///< Number of messages taken since construction
+};
+
+namespace detail
+{
+
+template <typename T, typename = void>
+struct has_data_field : std::false_type
+{
+};
+template <typename T>
+struct has_data_field<T, std::void_t<decltype(std::declval<T>().data.size())>> : std::true_type
+{
+};
+
+template <typename T, typename = void>
+struct has_objects_field : std::false_type
+{
+};
+template <typename T>
+struct has_objects_field<T, std::void_t<decltype(std::declval<T>().objects.size())>>
+: std::true_type
+{
+};
+
+template <typename T, typename = void>
+struct has_header_stamp : std::false_type
+{
+};
+template <typename T>
+struct has_header_stamp<T, std::void_t<decltype(std::declval<T>().header.stamp.nanosec)>>
+: std::true_type
+{
+};
+
+/**
+ * @brief Approximate the payload size of a message without serializing it. Large messages such as
+ * PointCloud2, OccupancyGrid and PredictedObjects keep their payload in a "data" or "objects"
+ * sequence, so only that sequence is taken into account besides the fixed part.
+ */
+template <typename MessageT>
+size_t estimateMessageSize(const MessageT & msg)
+{
+  if constexpr (has_data_field<MessageT>::value) {
+    return sizeof(MessageT) + msg.data.size() * sizeof(typename decltype(msg.data)::value_type);
+  } else if constexpr (has_objects_field<MessageT>::value) {
+    return sizeof(MessageT) +
+           msg.objects.size() * sizeof(typename decltype(msg.objects)::value_type);
+  } else {
+    return sizeof(MessageT);
+  }
+}
+
+/**
+ * @brief Time elapsed since the header stamp of the message, or 0 if it has no header.
+ */
+template <typename MessageT>
+double calcHeaderStalenessMs(const MessageT & msg)
+{
+  if constexpr (has_header_stamp<MessageT>::value) {
+    const int64_t stamp_ns = static_cast<int64_t>(msg.header.stamp.sec) * 1000000000LL +
+                             static_cast<int64_t>(msg.header.stamp.nanosec);
+    const int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::system_clock::now().time_since_epoch())
+                             .count();
+    return static_cast<double>(now_ns - stamp_ns) * 1e-6;
+  } else {
+    return 0.0;
+  }
+}
+
+}  // namespace detail
+
 namespace polling_policy
 {
 
@@ -53,6 +143,8 @@ private:
   typename MessageT::ConstSharedPtr data_{nullptr};  ///< Data pointer to store the latest data
 
 protected:
+  static constexpr bool keeps_data = true;  ///< Whether the policy holds the taken message
+
   /**
    * @brief Check the QoS settings for the subscription.
    *
@@ -86,6 +178,8 @@ template <typename MessageT>
 class Newest
 {
 protected:
+  static constexpr bool keeps_data = false;  ///< Whether the policy holds the taken message
+
   /**
    * @brief Check the QoS settings for the subscription.
    *
@@ -119,6 +213,8 @@ template <typename MessageT>
 class All
 {
 protected:
+  static constexpr bool keeps_data = false;  ///< Whether the policy holds the taken message
+
   /**
    * @brief Check the QoS settings for the subscription.
    *
@@ -150,6 +246,107 @@ class InterProcessPollingSubscriber : public PollingPolicy<MessageT>
 
 private:
   typename rclcpp::Subscription<MessageT>::SharedPtr subscriber_;  ///< Subscription object
+  std::vector<std::shared_ptr<MessageT>> buffers_;  ///< Message buffers reused between takes
+  size_t max_buffers_{2};                           ///< Maximum number of pooled buffers
+  TakeMetrics metrics_;                             ///< Metrics of the last take
+
+  /**
+   * @brief Get a message buffer that is not referenced outside of this subscriber. The buffers
+   * keep their sequence capacity, so taking a large message into them does not allocate.
+   */
+  std::shared_ptr<MessageT> acquireBuffer()
+  {
+    for (const auto & buffer : buffers_) {
+      if (buffer.use_count() == 1) {
+        metrics_.reused_buffer = true;
+        return buffer;
+      }
+    }
+    metrics_.reused_buffer = false;
+    auto buffer = std::make_shared<MessageT>();
+    if (buffers_.size() < max_buffers_) {
+      buffers_.push_back(buffer);
+    }
+    return buffer;
+  }
+
+  /**
+   * @brief Take a loaned message from the middleware. The loan must be given back with
+   * returnLoaned().
+   *
+   * @return const MessageT * The loaned message, or nullptr if none is available.
+   */
+  const MessageT * takeLoaned(rmw_message_info_t & rmw_message_info)
+  {
+    void * loaned_message = nullptr;
+    const auto ret = rcl_take_loaned_message(
+      subscriber_->get_subscription_handle().get(), &loaned_message, &rmw_message_info, nullptr);
+    if (ret != RCL_RET_OK || loaned_message == nullptr) {
+      return nullptr;
+    }
+    return static_cast<const MessageT *>(loaned_message);
+  }
+
+  /**
+   * @brief Give a loaned message back to the middleware.
+   */
+  static void returnLoaned(
+    const typename rclcpp::Subscription<MessageT>::SharedPtr & subscriber, const MessageT * msg)
+  {
+    rcl_return_loaned_message_from_subscription(
+      subscriber->get_subscription_handle().get(), const_cast<MessageT *>(msg));
+  }
+
+  /**
+   * @brief Take one message, either as a middleware loan or into a reused buffer. If the policy
+   * keeps the message, a loaned message is copied into a buffer and the loan is returned at once.
+   *
+   * @return std::shared_ptr<const MessageT> The taken message, or nullptr if none is available.
+   */
+  std::shared_ptr<const MessageT> takeOne()
+  {
+    rclcpp::MessageInfo message_info;
+    std::shared_ptr<const MessageT> msg{nullptr};
+    metrics_.loaned = subscriber_->can_loan_messages();
+    if (metrics_.loaned) {
+      const MessageT * loaned = takeLoaned(message_info.get_rmw_message_info());
+      if (loaned && PollingPolicy<MessageT>::keeps_data) {
+        // the policy holds the message until the next take, so copy it and return the loan now
+        auto buffer = acquireBuffer();
+        *buffer = *loaned;
+        returnLoaned(subscriber_, loaned);
+        msg = std::move(buffer);
+      } else if (loaned) {
+        // the loan is returned when the caller releases the message
+        metrics_.reused_buffer = false;
+        auto subscriber = subscriber_;
+        msg = std::shared_ptr<const MessageT>(loaned, [subscriber](const MessageT * loaned_msg) {
+          returnLoaned(subscriber, loaned_msg);
+        });
+      }
+    } else {
+      auto buffer = acquireBuffer();
+      if (subscriber_->take(*buffer, message_info)) {
+        msg = std::move(buffer);
+      }
+    }
+
+    metrics_.taken = msg != nullptr;
+    if (!metrics_.taken) {
+      return nullptr;
+    }
+
+    const auto & rmw_info = message_info.get_rmw_message_info();
+    const int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::system_clock::now().time_since_epoch())
+                             .count();
+    metrics_.staleness_ms = static_cast<double>(now_ns - rmw_info.source_timestamp) * 1e-6;
+    metrics_.transport_latency_ms =
+      static_cast<double>(rmw_info.received_timestamp - rmw_info.source_timestamp) * 1e-6;
+    metrics_.message_size = detail::estimateMessageSize(*msg);
+    ++metrics_.take_count;
+    return msg;
+  }
 
 public:
   using SharedPtr = std::shared_ptr<InterProcessPollingSubscriber<MessageT, PollingPolicy>>;
@@ -166,6 +363,9 @@ public:
   {
     this->checkQoS(qos);
 
+    // one buffer held by the policy or the caller, one being filled, and the queued messages
+    max_buffers_ = qos.get_rmw_qos_profile().depth + 2;
+
     auto noexec_callback_group =
       node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive, false);
 
@@ -194,6 +394,12 @@ public:
   }
 
   typename rclcpp::Subscription<MessageT>::SharedPtr subscriber() { return subscriber_; }
+
+  /**
+   * @brief Get the metrics of the last takeData() call. With the All policy, the metrics refer to
+   * the last message taken in the call.
+   */
+  const TakeMetrics & lastTakeMetrics() const { return metrics_; }
 };
 
 namespace polling_policy
@@ -202,13 +408,10 @@ namespace polling_policy
 template <typename MessageT>
 typename MessageT::ConstSharedPtr Latest<MessageT>::takeData()
 {
-  auto & subscriber =
-    static_cast<InterProcessPollingSubscriber<MessageT, Latest> *>(this)->subscriber_;
-  auto new_data = std::make_shared<MessageT>();
-  rclcpp::MessageInfo message_info;
-  const bool success = subscriber->take(*new_data, message_info);
-  if (success) {
-    data_ = new_data;
+  auto * subscriber = static_cast<InterProcessPollingSubscriber<MessageT, Latest> *>(this);
+  auto new_data = subscriber->takeOne();
+  if (new_data) {
+    data_ = std::move(new_data);
   }
 
   return data_;
@@ -217,31 +420,17 @@ typename MessageT::ConstSharedPtr Latest<MessageT>::takeData()
 template <typename MessageT>
 typename MessageT::ConstSharedPtr Newest<MessageT>::takeData()
 {
-  auto & subscriber =
-    static_cast<InterProcessPollingSubscriber<MessageT, Newest> *>(this)->subscriber_;
-  auto new_data = std::make_shared<MessageT>();
-  rclcpp::MessageInfo message_info;
-  const bool success = subscriber->take(*new_data, message_info);
-  if (success) {
-    return new_data;
-  }
-  return nullptr;
+  auto * subscriber = static_cast<InterProcessPollingSubscriber<MessageT, Newest> *>(this);
+  return subscriber->takeOne();
 }
 
 template <typename MessageT>
 std::vector<typename MessageT::ConstSharedPtr> All<MessageT>::takeData()
 {
-  auto & subscriber =
-    static_cast<InterProcessPollingSubscriber<MessageT, All> *>(this)->subscriber_;
+  auto * subscriber = static_cast<InterProcessPollingSubscriber<MessageT, All> *>(this);
   std::vector<typename MessageT::ConstSharedPtr> data;
-  rclcpp::MessageInfo message_info;
-  for (;;) {
-    auto datum = std::make_shared<MessageT>();
-    if (subscriber->take(*datum, message_info)) {
-      data.push_back(datum);
-    } else {
-      break;
-    }
+  while (auto datum = subscriber->takeOne()) {
+    data.push_back(std::move(datum));
   }
   return data;
 }
@@ -0,0 +1,86 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__UNIVERSE_UTILS__SYSTEM__PROC_FILE_HPP_
+#define AUTOWARE__UNIVERSE_UTILS__SYSTEM__PROC_FILE_HPP_
+
+#include <cstdint>
+#include <string>
+
+namespace autoware::universe_utils
+{
+/**
+ * @brief file kept open between the samples and read from its beginning with pread,
+ * so that sampling /proc and sysfs does not open, allocate or fork
+ */
+class PersistentFile
+{
+public:
+  /**
+   * @brief constructor
+   * @param [in] path path of the file, opened now or at the first successful read
+   */
+  explicit PersistentFile(const std::string & path);
+  ~PersistentFile();
+
+  PersistentFile(const PersistentFile &) = delete;
+  PersistentFile & operator=(const PersistentFile &) = delete;
+  PersistentFile(PersistentFile && other) noexcept;
+  PersistentFile & operator=(PersistentFile && other) noexcept;
+
+  /**
+   * @brief read the whole file
+   * @param [out] content content of the file
+   * @return true on success, otherwise the error is available with getError
+   */
+  bool read(std::string & content);
+
+  const std::string & getPath() const { return path_; }
+  const std::string & getError() const { return error_; }
+
+private:
+  void close();
+
+  std::string path_;   //!< @brief path of the file
+  int fd_;             //!< @brief file descriptor, -1 if not opened
+  std::string error_;  //!< @brief error of the last failed read
+};
+
+/**
+ * @brief memory information of /proc/meminfo, in bytes
+ */
+struct MemInfo
+{
+  uint64_t mem_total{0};
+  uint64_t mem_free{0};
+  uint64_t mem_available{0};
+  uint64_t buffers{0};
+  uint64_t cached{0};
+  uint64_t shmem{0};
+  uint64_t s_reclaimable{0};
+  uint64_t swap_total{0};
+  uint64_t swap_free{0};
+};
+
+/**
+ * @brief parse /proc/meminfo
+ * @param [in] content content of /proc/meminfo
+ * @param [out] mem_info memory information
+ * @return true if MemTotal and MemFree are found
+ */
+bool parseMemInfo(const std::string & content, MemInfo & mem_info);
+
+}  // namespace autoware::universe_utils
+
+#endif  // AUTOWARE__UNIVERSE_UTILS__SYSTEM__PROC_FILE_HPP_
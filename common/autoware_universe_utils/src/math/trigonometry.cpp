@@ -25,51 +25,62 @@ namespace autoware::universe_utils
 
 float sin(float radian)
 {
-  float degree = radian * (180.f / static_cast<float>(autoware::universe_utils::pi)) *
-                 (discrete_arcs_num_360 / 360.f);
-  size_t idx =
-    (static_cast<int>(std::round(degree)) % discrete_arcs_num_360 + discrete_arcs_num_360) %
-    discrete_arcs_num_360;
-
-  float mul = 1.f;
-  if (discrete_arcs_num_90 <= idx && idx < 2 * discrete_arcs_num_90) {
-    idx = 2 * discrete_arcs_num_90 - idx;
-  } else if (2 * discrete_arcs_num_90 <= idx && idx < 3 * discrete_arcs_num_90) {
-    mul = -1.f;
-    idx = idx - 2 * discrete_arcs_num_90;
-  } else if (3 * discrete_arcs_num_90 <= idx && idx < 4 * discrete_arcs_num_90) {
-    mul = -1.f;
-    idx = 4 * discrete_arcs_num_90 - idx;
-  }
-
-  return mul * g_sin_table[idx];
+  return g_sin_table.sin(radian);
 }
 
 float cos(float radian)
 {
-  return sin(radian + static_cast<float>(autoware::universe_utils::pi) / 2.f);
+  return g_sin_table.cos(radian);
 }
 
 std::pair<float, float> sin_and_cos(float radian)
 {
-  constexpr float tmp =
-    (180.f / static_cast<float>(autoware::universe_utils::pi)) * (discrete_arcs_num_360 / 360.f);
-  const float degree = radian * tmp;
-  size_t idx =
-    (static_cast<int>(std::round(degree)) % discrete_arcs_num_360 + discrete_arcs_num_360) %
-    discrete_arcs_num_360;
-
-  if (idx < discrete_arcs_num_90) {
-    return {g_sin_table[idx], g_sin_table[discrete_arcs_num_90 - idx]};
-  } else if (discrete_arcs_num_90 <= idx && idx < 2 * discrete_arcs_num_90) {
-    idx = 2 * discrete_arcs_num_90 - idx;
-    return {g_sin_table[idx], -g_sin_table[discrete_arcs_num_90 - idx]};
-  } else if (2 * discrete_arcs_num_90 <= idx && idx < 3 * discrete_arcs_num_90) {
-    idx = idx - 2 * discrete_arcs_num_90;
-    return {-g_sin_table[idx], -g_sin_table[discrete_arcs_num_90 - idx]};
-  } else {  // 3 * discrete_arcs_num_90 <= idx && idx < 4 * discrete_arcs_num_90
-    idx = 4 * discrete_arcs_num_90 - idx;
-    return {-g_sin_table[idx], g_sin_table[discrete_arcs_num_90 - idx]};
+  return g_sin_table.sin_and_cos(radian);
+}
+
+void sin(const float * radians, float * out, size_t size)
+{
+  for (size_t i = 0; i < size; ++i) {
+    out[i] = g_sin_table.sin(radians[i]);
+  }
+}
+
+void sin(const double * radians, double * out, size_t size)
+{
+  for (size_t i = 0; i < size; ++i) {
+    out[i] = g_sin_table.sin(radians[i]);
+  }
+}
+
+void cos(const float * radians, float * out, size_t size)
+{
+  for (size_t i = 0; i < size; ++i) {
+    out[i] = g_sin_table.cos(radians[i]);
+  }
+}
+
+void cos(const double * radians, double * out, size_t size)
+{
+  for (size_t i = 0; i < size; ++i) {
+    out[i] = g_sin_table.cos(radians[i]);
+  }
+}
+
+void sin_and_cos(const float * radians, float * sin_out, float * cos_out, size_t size)
+{
+  for (size_t i = 0; i < size; ++i) {
+    const auto [s, c] = g_sin_table.sin_and_cos(radians[i]);
+    sin_out[i] = s;
+    cos_out[i] = c;
+  }
+}
+
+void sin_and_cos(const double * radians, double * sin_out, double * cos_out, size_t size)
+{
+  for (size_t i = 0; i < size; ++i) {
+    const auto [s, c] = g_sin_table.sin_and_cos(radians[i]);
+    sin_out[i] = s;
+    cos_out[i] = c;
   }
 }
 
@@ -84,6 +95,7 @@ std::pair<float, float> sin_and_cos(float radian)
 // Modification:
 // 1. use autoware defined PI
 // 2. output of the function is changed from degrees to radians.
+// 3. branches are replaced with selects and the function is templated on the value type.
 namespace detail_fast_atan2
 {
 static const float atan2_p1 =
@@ -95,35 +107,45 @@ static const float atan2_p5 =
 static const float atan2_p7 =
   -0.04432655554792128f * static_cast<float>(180) / autoware::universe_utils::pi;
 static const float atan2_DBL_EPSILON = 2.2204460492503131e-016f;
+
+// branch-free form of the original implementation so that it vectorizes in the array versions
+template <typename T>
+inline T fast_atan2_impl(const T dy, const T dx)
+{
+  const T ax = std::abs(dx);
+  const T ay = std::abs(dy);
+  const bool x_major = ax >= ay;
+  const T c = (x_major ? ay : ax) / ((x_major ? ax : ay) + detail_fast_atan2::atan2_DBL_EPSILON);
+  const T c2 = c * c;
+  const T poly = (((detail_fast_atan2::atan2_p7 * c2 + detail_fast_atan2::atan2_p5) * c2 +
+                   detail_fast_atan2::atan2_p3) *
+                    c2 +
+                  detail_fast_atan2::atan2_p1) *
+                 c;
+  T a = x_major ? poly : T(90) - poly;
+  a = dx < 0 ? T(180) - a : a;
+  a = dy < 0 ? T(360) - a : a;
+  return a * static_cast<T>(autoware::universe_utils::pi) / T(180);
+}
 }  // namespace detail_fast_atan2
 
 float opencv_fast_atan2(float dy, float dx)
 {
-  float ax = std::abs(dx);
-  float ay = std::abs(dy);
-  float a, c, c2;
-  if (ax >= ay) {
-    c = ay / (ax + detail_fast_atan2::atan2_DBL_EPSILON);
-    c2 = c * c;
-    a = (((detail_fast_atan2::atan2_p7 * c2 + detail_fast_atan2::atan2_p5) * c2 +
-          detail_fast_atan2::atan2_p3) *
-           c2 +
-         detail_fast_atan2::atan2_p1) *
-        c;
-  } else {
-    c = ax / (ay + detail_fast_atan2::atan2_DBL_EPSILON);
-    c2 = c * c;
-    a = 90.f - (((detail_fast_atan2::atan2_p7 * c2 + detail_fast_atan2::atan2_p5) * c2 +
-                 detail_fast_atan2::atan2_p3) *
-                  c2 +
-                detail_fast_atan2::atan2_p1) *
-                 c;
+  return detail_fast_atan2::fast_atan2_impl(dy, dx);
+}
+
+void opencv_fast_atan2(const float * dy, const float * dx, float * out, size_t size)
+{
+  for (size_t i = 0; i < size; ++i) {
+    out[i] = detail_fast_atan2::fast_atan2_impl(dy[i], dx[i]);
   }
-  if (dx < 0) a = 180.f - a;
-  if (dy < 0) a = 360.f - a;
+}
 
-  a = a * autoware::universe_utils::pi / 180.f;
-  return a;
+void opencv_fast_atan2(const double * dy, const double * dx, double * out, size_t size)
+{
+  for (size_t i = 0; i < size; ++i) {
+    out[i] = detail_fast_atan2::fast_atan2_impl(dy[i], dx[i]);
+  }
 }
 
 }  // namespace autoware::universe_utils
@@ -0,0 +1,158 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/universe_utils/system/proc_file.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+
+namespace autoware::universe_utils
+{
+PersistentFile::PersistentFile(const std::string & path) : path_(path), fd_(-1)
+{
+  fd_ = open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+}
+
+PersistentFile::~PersistentFile()
+{
+  close();
+}
+
+PersistentFile::PersistentFile(PersistentFile && other) noexcept
+: path_(std::move(other.path_)), fd_(other.fd_), error_(std::move(other.error_))
+{
+  other.fd_ = -1;
+}
+
+PersistentFile & PersistentFile::operator=(PersistentFile && other) noexcept
+{
+  if (this != &other) {
+    close();
+    path_ = std::move(other.path_);
+    fd_ = other.fd_;
+    error_ = std::move(other.error_);
+    other.fd_ = -1;
+  }
+  return *this;
+}
+
+void PersistentFile::close()
+{
+  if (fd_ >= 0) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+}
+
+bool PersistentFile::read(std::string & content)
+{
+  content.clear();
+
+  // The file may not exist yet, or may have been removed
+  if (fd_ < 0) {
+    fd_ = open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd_ < 0) {
+      error_ = strerror(errno);
+      return false;
+    }
+  }
+
+  char buffer[4096];
+  off_t offset = 0;
+  while (true) {
+    const ssize_t size = pread(fd_, buffer, sizeof(buffer), offset);
+    if (size < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      error_ = strerror(errno);
+      // Reopen at the next read, e.g. when the device of a sysfs attribute is removed
+      close();
+      return false;
+    }
+    if (size == 0) {
+      break;
+    }
+    content.append(buffer, static_cast<size_t>(size));
+    offset += size;
+  }
+  return true;
+}
+
+bool parseMemInfo(const std::string & content, MemInfo & mem_info)
+{
+  mem_info = MemInfo{};
+  const std::pair<const char *, uint64_t *> fields[] = {
+    {"MemTotal", &mem_info.mem_total},
+    {"MemFree", &mem_info.mem_free},
+    {"MemAvailable", &mem_info.mem_available},
+    {"Buffers", &mem_info.buffers},
+    {"Cached", &mem_info.cached},
+    {"Shmem", &mem_info.shmem},
+    {"SReclaimable", &mem_info.s_reclaimable},
+    {"SwapTotal", &mem_info.swap_total},
+    {"SwapFree", &mem_info.swap_free},
+  };
+
+  bool has_total = false;
+  bool has_free = false;
+  bool has_available = false;
+
+  /*
+   Example of /proc/meminfo
+   MemTotal:       32809744 kB
+   MemFree:        13090376 kB
+   MemAvailable:   19622092 kB
+   */
+  size_t begin = 0;
+  while (begin < content.size()) {
+    size_t end = content.find('\n', begin);
+    if (end == std::string::npos) {
+      end = content.size();
+    }
+    const size_t colon = content.find(':', begin);
+    if (colon != std::string::npos && colon < end) {
+      for (const auto & [key, value] : fields) {
+        if (content.compare(begin, colon - begin, key) != 0) {
+          continue;
+        }
+        char * value_end = nullptr;
+        *value = std::strtoull(content.c_str() + colon + 1, &value_end, 10);
+        // The values are in kB except for the counts of huge pages
+        if (content.compare(value_end - content.c_str(), 3, " kB") == 0) {
+          *value *= 1024;
+        }
+        has_total |= (value == &mem_info.mem_total);
+        has_free |= (value == &mem_info.mem_free);
+        has_available |= (value == &mem_info.mem_available);
+        break;
+      }
+    }
+    begin = end + 1;
+  }
+
+  // MemAvailable is not provided by the kernels older than 3.14, same fallback as free
+  if (!has_available) {
+    mem_info.mem_available = mem_info.mem_free;
+  }
+  return has_total && has_free;
+}
+
+}  // namespace autoware::universe_utils
@@ -0,0 +1,64 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/universe_utils/math/quantile_accumulator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+TEST(quantile_accumulator, empty)
+{
+  autoware::universe_utils::QuantileAccumulator<double> acc(0.5);
+
+  EXPECT_TRUE(std::isnan(acc.quantile()));
+  EXPECT_EQ(acc.count(), 0);
+  EXPECT_THROW(autoware::universe_utils::QuantileAccumulator<double>(1.5), std::invalid_argument);
+}
+
+TEST(quantile_accumulator, fewValues)
+{
+  autoware::universe_utils::QuantileAccumulator<double> median(0.5);
+  autoware::universe_utils::QuantileAccumulator<double> max(1.0);
+  for (const double value : {30.0, 10.0, 20.0}) {
+    median.add(value);
+    max.add(value);
+  }
+
+  EXPECT_DOUBLE_EQ(median.quantile(), 20.0);
+  EXPECT_DOUBLE_EQ(max.quantile(), 30.0);
+  EXPECT_EQ(median.count(), 3);
+}
+
+TEST(quantile_accumulator, uniformValues)
+{
+  autoware::universe_utils::QuantileAccumulator<double> p50(0.5);
+  autoware::universe_utils::QuantileAccumulator<double> p95(0.95);
+  autoware::universe_utils::QuantileAccumulator<double> p99(0.99);
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> distribution(0.0, 100.0);
+  for (int i = 0; i < 100000; ++i) {
+    const double value = distribution(engine);
+    p50.add(value);
+    p95.add(value);
+    p99.add(value);
+  }
+
+  EXPECT_NEAR(p50.quantile(), 50.0, 1.0);
+  EXPECT_NEAR(p95.quantile(), 95.0, 1.0);
+  EXPECT_NEAR(p99.quantile(), 99.0, 1.0);
+  EXPECT_EQ(p50.count(), 100000);
+}
@@ -13,12 +13,18 @@
 // limitations under the License.
 
 #include "autoware/universe_utils/math/constants.hpp"
+#include "autoware/universe_utils/math/sin_table.hpp"
 #include "autoware/universe_utils/math/trigonometry.hpp"
+#include "autoware/universe_utils/system/stop_watch.hpp"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstdio>
 #include <random>
+#include <vector>
 
 TEST(trigonometry, sin)
 {
@@ -80,3 +86,147 @@ TEST(trigonometry, opencv_fast_atan2)
       << "fast atan2 = " << fast_atan << ", std::atan2 = " << std_atan;
   }
 }
+
+TEST(trigonometry, sin_table_interpolation)
+{
+  // Default initialization ensures a constant seed needed for reproducible tests
+  std::mt19937 gen{};
+  std::uniform_real_distribution<float> dis(-100.0f, 100.0f);
+
+  for (int i = 0; i < 10000; ++i) {
+    const float x = dis(gen);
+    const auto sin_and_cos = autoware::universe_utils::sin_and_cos(x);
+    ASSERT_NEAR(std::sin(static_cast<double>(x)), sin_and_cos.first, 5e-7) << "x = " << x;
+    ASSERT_NEAR(std::cos(static_cast<double>(x)), sin_and_cos.second, 5e-7) << "x = " << x;
+  }
+}
+
+TEST(trigonometry, sin_table_precision)
+{
+  constexpr autoware::universe_utils::SinTable<64> coarse_table{};
+  static_assert(coarse_table[0] == 0.f);
+  static_assert(coarse_table[64] == 1.f);
+
+  // the interpolation error is bounded by (pi / 2 / 64)^2 / 8
+  const double bound = std::pow(autoware::universe_utils::pi / 2.0 / 64.0, 2) / 8.0 + 1e-7;
+  for (int i = -1000; i < 1000; ++i) {
+    const double x = 0.0123 * i;
+    EXPECT_NEAR(std::sin(x), coarse_table.sin(x), bound);
+    EXPECT_NEAR(std::cos(x), coarse_table.cos(x), bound);
+  }
+}
+
+TEST(trigonometry, array)
+{
+  constexpr size_t size = 1000;
+  std::mt19937 gen{};
+  std::uniform_real_distribution<double> dis(-10.0, 10.0);
+
+  std::vector<double> x(size);
+  std::vector<double> y(size);
+  for (size_t i = 0; i < size; ++i) {
+    x[i] = dis(gen);
+    y[i] = dis(gen);
+  }
+  const std::vector<float> x_f(x.begin(), x.end());
+  const std::vector<float> y_f(y.begin(), y.end());
+
+  std::vector<double> sin_out(size);
+  std::vector<double> cos_out(size);
+  std::vector<double> atan_out(size);
+  std::vector<float> sin_out_f(size);
+  std::vector<float> cos_out_f(size);
+  std::vector<float> atan_out_f(size);
+  autoware::universe_utils::sin_and_cos(x.data(), sin_out.data(), cos_out.data(), size);
+  autoware::universe_utils::opencv_fast_atan2(y.data(), x.data(), atan_out.data(), size);
+  autoware::universe_utils::sin(x_f.data(), sin_out_f.data(), size);
+  autoware::universe_utils::cos(x_f.data(), cos_out_f.data(), size);
+  autoware::universe_utils::opencv_fast_atan2(y_f.data(), x_f.data(), atan_out_f.data(), size);
+
+  for (size_t i = 0; i < size; ++i) {
+    EXPECT_NEAR(std::sin(x[i]), sin_out[i], 5e-7);
+    EXPECT_NEAR(std::cos(x[i]), cos_out[i], 5e-7);
+    EXPECT_FLOAT_EQ(autoware::universe_utils::sin(x_f[i]), sin_out_f[i]);
+    EXPECT_FLOAT_EQ(autoware::universe_utils::cos(x_f[i]), cos_out_f[i]);
+    EXPECT_FLOAT_EQ(autoware::universe_utils::opencv_fast_atan2(y_f[i], x_f[i]), atan_out_f[i]);
+    EXPECT_NEAR(normalize_angle(std::atan2(y[i], x[i])), atan_out[i], 6e-3);
+  }
+}
+
+TEST(trigonometry, sinBenchmark)
+{
+  constexpr size_t size = 1000000;
+  std::mt19937 gen{};
+  std::uniform_real_distribution<float> dis(-10.0f, 10.0f);
+  std::vector<float> x(size);
+  for (auto & v : x) {
+    v = dis(gen);
+  }
+
+  // nearest-sample lookup into a 32769 entries quarter table, i.e. the previous implementation
+  constexpr size_t legacy_arcs_num_90 = 32768;
+  std::vector<float> legacy_table(legacy_arcs_num_90 + 1);
+  for (size_t i = 0; i <= legacy_arcs_num_90; ++i) {
+    legacy_table[i] = static_cast<float>(
+      std::sin(static_cast<double>(i) * autoware::universe_utils::pi / 2.0 / legacy_arcs_num_90));
+  }
+  const auto legacy_sin = [&](const float radian) {
+    const float arc = radian * static_cast<float>(4 * legacy_arcs_num_90) /
+                      (2.f * static_cast<float>(autoware::universe_utils::pi));
+    size_t idx = (static_cast<int>(std::round(arc)) % (4 * legacy_arcs_num_90) +
+                  4 * legacy_arcs_num_90) %
+                 (4 * legacy_arcs_num_90);
+    float mul = 1.f;
+    if (legacy_arcs_num_90 <= idx && idx < 2 * legacy_arcs_num_90) {
+      idx = 2 * legacy_arcs_num_90 - idx;
+    } else if (2 * legacy_arcs_num_90 <= idx && idx < 3 * legacy_arcs_num_90) {
+      mul = -1.f;
+      idx = idx - 2 * legacy_arcs_num_90;
+    } else if (3 * legacy_arcs_num_90 <= idx) {
+      mul = -1.f;
+      idx = 4 * legacy_arcs_num_90 - idx;
+    }
+    return mul * legacy_table[idx];
+  };
+
+  std::vector<float> std_out(size);
+  std::vector<float> legacy_out(size);
+  std::vector<float> scalar_out(size);
+  std::vector<float> array_out(size);
+
+  autoware::universe_utils::StopWatch<std::chrono::nanoseconds, std::chrono::nanoseconds> sw;
+  sw.tic();
+  for (size_t i = 0; i < size; ++i) {
+    std_out[i] = std::sin(x[i]);
+  }
+  const double std_ns = sw.toc();
+  sw.tic();
+  for (size_t i = 0; i < size; ++i) {
+    legacy_out[i] = legacy_sin(x[i]);
+  }
+  const double legacy_ns = sw.toc();
+  sw.tic();
+  for (size_t i = 0; i < size; ++i) {
+    scalar_out[i] = autoware::universe_utils::sin(x[i]);
+  }
+  const double scalar_ns = sw.toc();
+  sw.tic();
+  autoware::universe_utils::sin(x.data(), array_out.data(), size);
+  const double array_ns = sw.toc();
+
+  double legacy_max_error = 0.0;
+  double table_max_error = 0.0;
+  for (size_t i = 0; i < size; ++i) {
+    const double ground_truth = std::sin(static_cast<double>(x[i]));
+    legacy_max_error = std::max(legacy_max_error, std::abs(ground_truth - legacy_out[i]));
+    table_max_error = std::max(table_max_error, std::abs(ground_truth - array_out[i]));
+  }
+  EXPECT_LT(table_max_error, legacy_max_error);
+
+  std::printf("sin of %zu values\n", size);
+  std::printf(
+    "\tstd::sin = %2.2f ms\n\tlegacy table = %2.2f ms (max error %.2e)\n\tinterpolated table = "
+    "%2.2f ms (array: %2.2f ms, max error %.2e)\n",
+    std_ns / 1e6, legacy_ns / 1e6, legacy_max_error, scalar_ns / 1e6, array_ns / 1e6,
+    table_max_error);
+}
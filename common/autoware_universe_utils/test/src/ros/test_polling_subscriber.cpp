@@ -0,0 +1,160 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/universe_utils/ros/polling_subscriber.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <autoware_perception_msgs/msg/predicted_objects.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+using autoware::universe_utils::InterProcessPollingSubscriber;
+using autoware_perception_msgs::msg::PredictedObject;
+using autoware_perception_msgs::msg::PredictedObjects;
+
+class PollingSubscriberTest : public ::testing::Test
+{
+protected:
+  using NewestSubscriber = InterProcessPollingSubscriber<
+    PredictedObjects, autoware::universe_utils::polling_policy::Newest>;
+  using LatestSubscriber = InterProcessPollingSubscriber<
+    PredictedObjects, autoware::universe_utils::polling_policy::Latest>;
+
+  std::shared_ptr<rclcpp::Node> node_{nullptr};
+  std::shared_ptr<rclcpp::Publisher<PredictedObjects>> publisher_{nullptr};
+  std::string topic_name_;
+
+  void SetUp() override
+  {
+    const std::string test_name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    node_ = std::make_shared<rclcpp::Node>("polling_subscriber_" + test_name + "_node");
+    topic_name_ = "polling_subscriber_" + test_name + "_topic";
+    publisher_ = node_->create_publisher<PredictedObjects>(topic_name_, rclcpp::QoS{1});
+  }
+
+  // Publish a message with the given number of objects and wait until the subscriber can take it,
+  // so that every takeData() of the tests takes exactly one message
+  template <typename SubscriberT>
+  void publishAndWait(SubscriberT & subscriber, const size_t objects_num)
+  {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (publisher_->get_subscription_count() == 0 &&
+           std::chrono::steady_clock::now() < deadline) {
+      rclcpp::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_GT(publisher_->get_subscription_count(), 0u);
+
+    PredictedObjects msg;
+    msg.header.stamp = node_->now();
+    msg.objects.resize(objects_num);
+    publisher_->publish(msg);
+
+    rclcpp::WaitSet wait_set;
+    wait_set.add_subscription(subscriber.subscriber());
+    const auto result = wait_set.wait(std::chrono::seconds(5));
+    wait_set.remove_subscription(subscriber.subscriber());
+    ASSERT_EQ(result.kind(), rclcpp::WaitResultKind::Ready);
+  }
+};
+
+TEST_F(PollingSubscriberTest, ReuseReleasedBuffer)
+{
+  NewestSubscriber subscriber(node_.get(), topic_name_);
+  if (subscriber.subscriber()->can_loan_messages()) {
+    GTEST_SKIP() << "the middleware loans the messages, so no buffer is used";
+  }
+
+  publishAndWait(subscriber, 3);
+  auto first = subscriber.takeData();
+  ASSERT_NE(first, nullptr);
+  EXPECT_FALSE(subscriber.lastTakeMetrics().reused_buffer);
+  const auto * first_buffer = first.get();
+  first.reset();
+
+  publishAndWait(subscriber, 3);
+  const auto second = subscriber.takeData();
+  ASSERT_NE(second, nullptr);
+  EXPECT_TRUE(subscriber.lastTakeMetrics().reused_buffer);
+  EXPECT_EQ(second.get(), first_buffer);
+}
+
+TEST_F(PollingSubscriberTest, DoNotReuseHeldBuffer)
+{
+  NewestSubscriber subscriber(node_.get(), topic_name_);
+  if (subscriber.subscriber()->can_loan_messages()) {
+    GTEST_SKIP() << "the middleware loans the messages, so no buffer is used";
+  }
+
+  publishAndWait(subscriber, 3);
+  const auto held = subscriber.takeData();
+  ASSERT_NE(held, nullptr);
+
+  publishAndWait(subscriber, 5);
+  const auto second = subscriber.takeData();
+  ASSERT_NE(second, nullptr);
+  EXPECT_FALSE(subscriber.lastTakeMetrics().reused_buffer);
+  EXPECT_NE(second.get(), held.get());
+  EXPECT_EQ(held->objects.size(), 3u);
+  EXPECT_EQ(second->objects.size(), 5u);
+}
+
+TEST_F(PollingSubscriberTest, LatestKeepsBufferOfLastMessage)
+{
+  LatestSubscriber subscriber(node_.get(), topic_name_);
+
+  publishAndWait(subscriber, 3);
+  const auto first = subscriber.takeData();
+  ASSERT_NE(first, nullptr);
+
+  // the kept message is returned again, and its buffer is not overwritten by the next take
+  const auto kept = subscriber.takeData();
+  EXPECT_FALSE(subscriber.lastTakeMetrics().taken);
+  EXPECT_EQ(kept.get(), first.get());
+
+  publishAndWait(subscriber, 5);
+  const auto second = subscriber.takeData();
+  ASSERT_NE(second, nullptr);
+  EXPECT_NE(second.get(), first.get());
+  EXPECT_EQ(first->objects.size(), 3u);
+  EXPECT_EQ(second->objects.size(), 5u);
+}
+
+TEST_F(PollingSubscriberTest, TakeMetrics)
+{
+  NewestSubscriber subscriber(node_.get(), topic_name_);
+
+  EXPECT_EQ(subscriber.takeData(), nullptr);
+  EXPECT_FALSE(subscriber.lastTakeMetrics().taken);
+  EXPECT_EQ(subscriber.lastTakeMetrics().take_count, 0u);
+
+  publishAndWait(subscriber, 4);
+  const auto msg = subscriber.takeData();
+  ASSERT_NE(msg, nullptr);
+  const auto & metrics = subscriber.lastTakeMetrics();
+  EXPECT_TRUE(metrics.taken);
+  EXPECT_EQ(metrics.loaned, subscriber.subscriber()->can_loan_messages());
+  EXPECT_EQ(metrics.take_count, 1u);
+  EXPECT_EQ(metrics.message_size, sizeof(PredictedObjects) + 4 * sizeof(PredictedObject));
+  EXPECT_GE(metrics.staleness_ms, 0.0);
+  EXPECT_GE(metrics.transport_latency_ms, 0.0);
+  EXPECT_GE(metrics.staleness_ms, metrics.transport_latency_ms);
+
+  EXPECT_EQ(subscriber.takeData(), nullptr);
+  EXPECT_FALSE(subscriber.lastTakeMetrics().taken);
+  EXPECT_EQ(subscriber.lastTakeMetrics().take_count, 1u);
+}
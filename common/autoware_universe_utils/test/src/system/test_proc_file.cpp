@@ -0,0 +1,74 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/universe_utils/system/proc_file.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using autoware::universe_utils::MemInfo;
+using autoware::universe_utils::parseMemInfo;
+using autoware::universe_utils::PersistentFile;
+
+TEST(system, ParseMemInfo)
+{
+  const std::string content =
+    "MemTotal:       32809744 kB\n"
+    "MemFree:        13090376 kB\n"
+    "MemAvailable:   19622092 kB\n"
+    "Buffers:          600000 kB\n"
+    "Cached:          6000000 kB\n"
+    "SwapCached:        10000 kB\n"
+    "Shmem:            292840 kB\n"
+    "SReclaimable:     564588 kB\n"
+    "SwapTotal:      33554428 kB\n"
+    "SwapFree:       31786748 kB\n"
+    "HugePages_Total:       0\n";
+
+  MemInfo mem_info;
+  ASSERT_TRUE(parseMemInfo(content, mem_info));
+  EXPECT_EQ(mem_info.mem_total, 32809744ull * 1024);
+  EXPECT_EQ(mem_info.mem_free, 13090376ull * 1024);
+  EXPECT_EQ(mem_info.mem_available, 19622092ull * 1024);
+  EXPECT_EQ(mem_info.buffers, 600000ull * 1024);
+  EXPECT_EQ(mem_info.cached, 6000000ull * 1024);
+  EXPECT_EQ(mem_info.shmem, 292840ull * 1024);
+  EXPECT_EQ(mem_info.s_reclaimable, 564588ull * 1024);
+  EXPECT_EQ(mem_info.swap_total, 33554428ull * 1024);
+  EXPECT_EQ(mem_info.swap_free, 31786748ull * 1024);
+}
+
+TEST(system, ParseMemInfoWithoutMemAvailable)
+{
+  MemInfo mem_info;
+  ASSERT_TRUE(parseMemInfo("MemTotal: 2048 kB\nMemFree: 1024 kB\n", mem_info));
+  EXPECT_EQ(mem_info.mem_available, mem_info.mem_free);
+
+  EXPECT_FALSE(parseMemInfo("MemTotal: 2048 kB\n", mem_info));
+}
+
+TEST(system, PersistentFileReadsAgain)
+{
+  PersistentFile file("/proc/self/stat");
+  std::string content;
+  ASSERT_TRUE(file.read(content));
+  EXPECT_FALSE(content.empty());
+  ASSERT_TRUE(file.read(content));
+  EXPECT_FALSE(content.empty());
+
+  PersistentFile missing("/nonexistent/file");
+  EXPECT_FALSE(missing.read(content));
+  EXPECT_FALSE(missing.getError().empty());
+}
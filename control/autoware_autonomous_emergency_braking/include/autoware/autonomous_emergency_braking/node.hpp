@@ -17,6 +17,7 @@
 
 #include "autoware_utils/system/time_keeper.hpp"
 
+#include <autoware/agnocast_wrapper/polling_subscriber.hpp>
 #include <autoware/motion_utils/trajectory/trajectory.hpp>
 #include <autoware_utils/geometry/geometry.hpp>
 #include <autoware_utils/ros/polling_subscriber.hpp>
@@ -331,14 +332,14 @@ public:
   explicit AEB(const rclcpp::NodeOptions & node_options);
 
   // subscriber
-  autoware_utils::InterProcessPollingSubscriber<PointCloud2> sub_point_cloud_{
+  autoware::agnocast_wrapper::PollingSubscriber<PointCloud2> sub_point_cloud_{
     this, "~/input/pointcloud", autoware_utils::single_depth_sensor_qos()};
   autoware_utils::InterProcessPollingSubscriber<VelocityReport> sub_velocity_{
     this, "~/input/velocity"};
   autoware_utils::InterProcessPollingSubscriber<Imu> sub_imu_{this, "~/input/imu"};
   autoware_utils::InterProcessPollingSubscriber<Trajectory> sub_predicted_traj_{
     this, "~/input/predicted_trajectory"};
-  autoware_utils::InterProcessPollingSubscriber<PredictedObjects> predicted_objects_sub_{
+  autoware::agnocast_wrapper::PollingSubscriber<PredictedObjects> predicted_objects_sub_{
     this, "~/input/objects"};
   autoware_utils::InterProcessPollingSubscriber<AutowareState> sub_autoware_state_{
     this, "/autoware/state"};
@@ -454,6 +455,19 @@ public:
     const Path & ego_path, const rclcpp::Time & stamp,
     const PointCloud::Ptr points_belonging_to_cluster_hulls, std::vector<ObjectData> & objects);
 
+  /**
+   * @brief Create object data using the clusters of a grid aligned with the ego path. The cloud is
+   * bucketized in a single pass, so this replaces the cropping, clustering and closest point search
+   * @param ego_path Ego vehicle path
+   * @param stamp Timestamp of the data
+   * @param obstacle_points_ptr Pointer to the point cloud of obstacles
+   * @param objects Vector to store the created object data
+   * @param cluster_points output: points of the clusters, filled if the debug pointcloud is enabled
+   */
+  void getClosestObjectsOnPathWithGrid(
+    const Path & ego_path, const rclcpp::Time & stamp, const PointCloud::Ptr obstacle_points_ptr,
+    std::vector<ObjectData> & objects, const PointCloud::Ptr cluster_points);
+
   /**
    * @brief Create object data using point cloud clusters
    * @param obstacle_points_ptr Pointer to the point cloud of obstacles
@@ -558,6 +572,7 @@ public:
   bool limit_imu_path_lat_dev_;
   bool limit_imu_path_length_;
   bool use_pointcloud_data_;
+  bool use_path_aligned_grid_;
   bool use_predicted_object_data_;
   bool use_object_velocity_calculation_;
   bool check_autoware_state_;
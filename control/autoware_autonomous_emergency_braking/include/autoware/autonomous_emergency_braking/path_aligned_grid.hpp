@@ -0,0 +1,147 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__AUTONOMOUS_EMERGENCY_BRAKING__PATH_ALIGNED_GRID_HPP_
+#define AUTOWARE__AUTONOMOUS_EMERGENCY_BRAKING__PATH_ALIGNED_GRID_HPP_
+
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace autoware::motion::control::autonomous_emergency_braking
+{
+using geometry_msgs::msg::Pose;
+
+/**
+ * @brief point expressed in the frenet frame of the ego path
+ */
+struct PathAlignedPoint
+{
+  pcl::PointXYZ point;
+  double arc_length;      // distance along the path from its first pose
+  double lateral_offset;  // signed distance to the path, positive on the left side
+};
+
+/**
+ * @brief cells of a connected component of the grid, sorted by arc length
+ */
+struct PathAlignedCluster
+{
+  std::vector<size_t> cell_indices;
+  size_t num_points{0};
+};
+
+/**
+ * @brief occupancy grid aligned with the ego path (arc length x lateral offset bins).
+ * The points are bucketized in a single pass, clustering is done with connected components of the
+ * occupied cells and the closest point of a cluster is found by scanning its cells along the arc
+ * length. Each point is projected on every segment of the path, so the cost is proportional to the
+ * number of points times the number of path segments, plus the number of cells. The worst case
+ * latency is thus bounded by the size of the input cloud, the path and the grid dimensions.
+ */
+class PathAlignedGrid
+{
+public:
+  /**
+   * @brief construct an empty grid along the path
+   * @param path ego path, at least 2 poses are needed for the grid to be valid
+   * @param cell_size longitudinal and lateral size of a cell
+   * @param half_width points farther than this from the path are ignored
+   * @param max_arc_length points farther than this along the path are ignored
+   */
+  PathAlignedGrid(
+    const std::vector<Pose> & path, const double cell_size, const double half_width,
+    const double max_arc_length);
+
+  /**
+   * @brief bucketize the points of the cloud which are inside the grid, replacing previous ones
+   * @param points input point cloud in the same frame as the path
+   */
+  void setInputCloud(const pcl::PointCloud<pcl::PointXYZ> & points);
+
+  /**
+   * @brief get the 8-connected components of the occupied cells
+   * @param minimum_cluster_size clusters with less points are discarded
+   * @param maximum_cluster_size clusters with more points are discarded
+   * @param cluster_minimum_height clusters without a point higher than this are discarded
+   */
+  std::vector<PathAlignedCluster> extractClusters(
+    const size_t minimum_cluster_size, const size_t maximum_cluster_size,
+    const double cluster_minimum_height) const;
+
+  /**
+   * @brief get the point of the cluster closest to the ego front along the path, within the
+   * lateral limit
+   * @param cluster cluster returned by extractClusters
+   * @param max_lateral_offset points with a larger absolute lateral offset are ignored
+   * @param longitudinal_offset arc length of the ego front, the distance to a point is the
+   * absolute difference of their arc lengths
+   */
+  std::optional<PathAlignedPoint> getClosestPoint(
+    const PathAlignedCluster & cluster, const double max_lateral_offset,
+    const double longitudinal_offset) const;
+
+  /**
+   * @brief get all the points of the cluster
+   */
+  std::vector<PathAlignedPoint> getPoints(const PathAlignedCluster & cluster) const;
+
+  bool isValid() const { return num_rows_ > 0 && num_cols_ > 0; }
+  size_t getNumRows() const { return num_rows_; }
+  size_t getNumCols() const { return num_cols_; }
+  size_t getNumPoints() const { return points_.size(); }
+
+  /**
+   * @brief project a point to the path
+   * @return point in the frenet frame, or nullopt if it is outside the grid
+   */
+  std::optional<PathAlignedPoint> project(const pcl::PointXYZ & p) const;
+
+private:
+  struct Segment
+  {
+    double x;
+    double y;
+    double dir_x;
+    double dir_y;
+    double length;
+    double start_arc_length;
+  };
+
+  std::vector<Segment> segments_;
+  double cell_size_;
+  double half_width_;
+  double max_arc_length_;
+  size_t num_rows_{0};
+  size_t num_cols_{0};
+
+  // axis aligned bounding box of the grid, to reject far points without projecting them
+  double min_x_{0.0};
+  double min_y_{0.0};
+  double max_x_{0.0};
+  double max_y_{0.0};
+
+  // points sorted by cell, the points of cell i are in [cell_begin_[i], cell_begin_[i + 1])
+  std::vector<PathAlignedPoint> points_;
+  std::vector<size_t> cell_begin_;
+  std::vector<float> cell_max_z_;
+};
+}  // namespace autoware::motion::control::autonomous_emergency_braking
+
+#endif  // AUTOWARE__AUTONOMOUS_EMERGENCY_BRAKING__PATH_ALIGNED_GRID_HPP_
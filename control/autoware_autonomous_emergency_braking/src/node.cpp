@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <autoware/autonomous_emergency_braking/node.hpp>
+#include <autoware/autonomous_emergency_braking/path_aligned_grid.hpp>
 #include <autoware/autonomous_emergency_braking/utils.hpp>
 #include <autoware/motion_utils/marker/marker_helper.hpp>
 #include <autoware/motion_utils/trajectory/trajectory.hpp>
@@ -164,6 +165,7 @@ AEB::AEB(const rclcpp::NodeOptions & node_options)
   limit_imu_path_lat_dev_ = declare_parameter<bool>("limit_imu_path_lat_dev");
   limit_imu_path_length_ = declare_parameter<bool>("limit_imu_path_length");
   use_pointcloud_data_ = declare_parameter<bool>("use_pointcloud_data");
+  use_path_aligned_grid_ = declare_parameter<bool>("use_path_aligned_grid");
   use_predicted_object_data_ = declare_parameter<bool>("use_predicted_object_data");
   use_object_velocity_calculation_ = declare_parameter<bool>("use_object_velocity_calculation");
   check_autoware_state_ = declare_parameter<bool>("check_autoware_state");
@@ -227,6 +229,7 @@ rcl_interfaces::msg::SetParametersResult AEB::onParameter(
   update_param<bool>(parameters, "limit_imu_path_lat_dev", limit_imu_path_lat_dev_);
   update_param<bool>(parameters, "limit_imu_path_length", limit_imu_path_length_);
   update_param<bool>(parameters, "use_pointcloud_data", use_pointcloud_data_);
+  update_param<bool>(parameters, "use_path_aligned_grid", use_path_aligned_grid_);
   update_param<bool>(parameters, "use_predicted_object_data", use_predicted_object_data_);
   update_param<bool>(
     parameters, "use_object_velocity_calculation", use_object_velocity_calculation_);
@@ -348,7 +351,7 @@ bool AEB::fetchLatestData()
   }
 
   if (use_pointcloud_data_) {
-    const auto pointcloud_ptr = sub_point_cloud_.take_data();
+    const auto pointcloud_ptr = sub_point_cloud_.takeData();
     if (!pointcloud_ptr) {
       return missing("object pointcloud message");
     }
@@ -362,7 +365,7 @@ bool AEB::fetchLatestData()
   }
 
   if (use_predicted_object_data_) {
-    predicted_objects_ptr_ = predicted_objects_sub_.take_data();
+    predicted_objects_ptr_ = predicted_objects_sub_.takeData();
     if (!predicted_objects_ptr_) {
       return missing("predicted objects");
     }
@@ -471,6 +474,9 @@ bool AEB::checkCollision(MarkerArray & debug_markers)
     return false;
   }
 
+  // points shown in the debug pointcloud
+  PointCloud::Ptr filtered_objects = pcl::make_shared<PointCloud>();
+
   auto merge_expanded_path_polys = [&](const std::vector<Path> & paths) {
     std::vector<Polygon2d> merged_expanded_path_polygons;
     for (const auto & path : paths) {
@@ -481,17 +487,19 @@ bool AEB::checkCollision(MarkerArray & debug_markers)
   };
 
   auto get_objects_on_path = [&](
-                               const auto & path, PointCloud::Ptr points_belonging_to_cluster_hulls,
+                               const auto & path, PointCloud::Ptr obstacle_points,
                                const colorTuple & debug_colors, const std::string & debug_ns) {
     // Check which points of the cropped point cloud are on the ego path, and get the closest one
     const auto ego_polys = generatePathFootprint(path, expand_width_);
     std::vector<ObjectData> objects;
-    // Crop out Pointcloud using an extra wide ego path
-    if (
-      use_pointcloud_data_ && points_belonging_to_cluster_hulls &&
-      !points_belonging_to_cluster_hulls->empty()) {
+    if (use_pointcloud_data_ && obstacle_points && !obstacle_points->empty()) {
       const auto current_time = obstacle_ros_pointcloud_ptr_->header.stamp;
-      getClosestObjectsOnPath(path, current_time, points_belonging_to_cluster_hulls, objects);
+      if (use_path_aligned_grid_) {
+        getClosestObjectsOnPathWithGrid(
+          path, current_time, obstacle_points, objects, filtered_objects);
+      } else {
+        getClosestObjectsOnPath(path, current_time, obstacle_points, objects);
+      }
     }
     if (use_predicted_object_data_) {
       createObjectDataUsingPredictedObjects(path, ego_polys, objects);
@@ -554,7 +562,8 @@ bool AEB::checkCollision(MarkerArray & debug_markers)
                               ? std::nullopt
                               : generateEgoPath(*predicted_traj_ptr_);
 
-  PointCloud::Ptr filtered_objects = pcl::make_shared<PointCloud>();
+  // input of the object search: the full cloud for the path aligned grid, or the cluster hulls
+  PointCloud::Ptr obstacle_points = pcl::make_shared<PointCloud>();
   if (use_pointcloud_data_) {
     const std::vector<Path> paths = [&]() {
       std::vector<Path> paths;
@@ -566,25 +575,27 @@ bool AEB::checkCollision(MarkerArray & debug_markers)
     }();
 
     if (paths.empty()) return false;
-    const std::vector<Polygon2d> merged_path_polygons = merge_expanded_path_polys(paths);
-    // Data of filtered point cloud
-    cropPointCloudWithEgoFootprintPath(merged_path_polygons, filtered_objects);
+    if (use_path_aligned_grid_) {
+      // the grid of each path does the cropping and clustering in a single pass over the cloud
+      pcl::fromROSMsg(*obstacle_ros_pointcloud_ptr_, *obstacle_points);
+      filtered_objects->header = obstacle_points->header;
+    } else {
+      const std::vector<Polygon2d> merged_path_polygons = merge_expanded_path_polys(paths);
+      // Data of filtered point cloud
+      cropPointCloudWithEgoFootprintPath(merged_path_polygons, filtered_objects);
+      getPointsBelongingToClusterHulls(filtered_objects, obstacle_points, debug_markers);
+    }
   }
 
-  PointCloud::Ptr points_belonging_to_cluster_hulls = pcl::make_shared<PointCloud>();
-  getPointsBelongingToClusterHulls(
-    filtered_objects, points_belonging_to_cluster_hulls, debug_markers);
-
   const auto imu_path_objects =
     (!use_imu_path_ || !angular_velocity_ptr_)
       ? std::vector<ObjectData>{}
-      : get_objects_on_path(ego_imu_path, points_belonging_to_cluster_hulls, IMU_PATH_COLOR, "imu");
+      : get_objects_on_path(ego_imu_path, obstacle_points, IMU_PATH_COLOR, "imu");
 
   const auto mpc_path_objects =
     (!use_predicted_trajectory_ || !predicted_traj_ptr_ || !ego_mpc_path.has_value())
       ? std::vector<ObjectData>{}
-      : get_objects_on_path(
-          ego_mpc_path.value(), points_belonging_to_cluster_hulls, MPC_PATH_COLOR, "mpc");
+      : get_objects_on_path(ego_mpc_path.value(), obstacle_points, MPC_PATH_COLOR, "mpc");
 
   // merge object data which comes from the ego (imu) path and predicted path
   auto merge_objects =
@@ -951,6 +962,69 @@ void AEB::getClosestObjectsOnPath(
   }
 }
 
+void AEB::getClosestObjectsOnPathWithGrid(
+  const Path & ego_path, const rclcpp::Time & stamp, const PointCloud::Ptr obstacle_points_ptr,
+  std::vector<ObjectData> & objects, const PointCloud::Ptr cluster_points)
+{
+  autoware_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  if (ego_path.size() < 2 || obstacle_points_ptr->empty()) {
+    return;
+  }
+
+  const auto longitudinal_offset_opt = utils::getLongitudinalOffset(
+    ego_path, vehicle_info_.max_longitudinal_offset_m, vehicle_info_.rear_overhang_m);
+
+  if (!longitudinal_offset_opt.has_value()) return;
+  const auto longitudinal_offset = longitudinal_offset_opt.value();
+  const auto path_length = autoware::motion_utils::calcArcLength(ego_path);
+  const auto path_width = vehicle_info_.vehicle_width_m / 2.0 + expand_width_;
+  const auto speed_calculation_width = path_width + speed_calculation_expansion_margin_;
+  // the grid is as wide as the rough filtering area, so that clusters are not cut at the border of
+  // the speed calculation area
+  const auto grid_half_width =
+    std::max(path_width + path_footprint_extra_margin_, speed_calculation_width);
+
+  PathAlignedGrid grid(
+    ego_path, cluster_tolerance_, grid_half_width, path_length + longitudinal_offset);
+  grid.setInputCloud(*obstacle_points_ptr);
+  const auto clusters = grid.extractClusters(
+    static_cast<size_t>(std::max(minimum_cluster_size_, 0)),
+    static_cast<size_t>(std::max(maximum_cluster_size_, 0)), cluster_minimum_height_);
+
+  const auto add_object = [&](const PathAlignedPoint & p) {
+    ObjectData obj;
+    obj.stamp = stamp;
+    obj.position = autoware_utils::create_point(p.point.x, p.point.y, p.point.z);
+    obj.velocity = 0.0;
+    obj.distance_to_object = std::abs(p.arc_length - longitudinal_offset);
+    obj.is_target = (std::abs(p.lateral_offset) < path_width);
+    objects.push_back(obj);
+  };
+
+  for (const auto & cluster : clusters) {
+    const auto closest_point =
+      grid.getClosestPoint(cluster, speed_calculation_width, longitudinal_offset);
+    if (!closest_point.has_value()) continue;
+    add_object(closest_point.value());
+    // target objects have priority in the collision check, so the closest point inside the ego
+    // footprint is also needed when the closest point of the cluster is outside of it
+    if (std::abs(closest_point->lateral_offset) >= path_width) {
+      const auto closest_target_point =
+        grid.getClosestPoint(cluster, path_width, longitudinal_offset);
+      if (
+        closest_target_point.has_value() &&
+        std::abs(closest_target_point->lateral_offset) < path_width) {
+        add_object(closest_target_point.value());
+      }
+    }
+    if (publish_debug_pointcloud_ && cluster_points) {
+      for (const auto & p : grid.getPoints(cluster)) {
+        cluster_points->push_back(p.point);
+      }
+    }
+  }
+}
+
 void AEB::cropPointCloudWithEgoFootprintPath(
   const std::vector<Polygon2d> & ego_polys, PointCloud::Ptr filtered_objects)
 {
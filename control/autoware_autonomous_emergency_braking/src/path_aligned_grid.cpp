@@ -0,0 +1,231 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/autonomous_emergency_braking/path_aligned_grid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace autoware::motion::control::autonomous_emergency_braking
+{
+PathAlignedGrid::PathAlignedGrid(
+  const std::vector<Pose> & path, const double cell_size, const double half_width,
+  const double max_arc_length)
+: cell_size_(cell_size), half_width_(half_width), max_arc_length_(max_arc_length)
+{
+  if (path.size() < 2 || cell_size <= 0.0 || half_width <= 0.0 || max_arc_length <= 0.0) {
+    return;
+  }
+
+  constexpr double epsilon = 1e-6;
+  double arc_length = 0.0;
+  for (size_t i = 0; i + 1 < path.size(); ++i) {
+    const auto & p0 = path.at(i).position;
+    const auto & p1 = path.at(i + 1).position;
+    const double dx = p1.x - p0.x;
+    const double dy = p1.y - p0.y;
+    const double length = std::hypot(dx, dy);
+    // skip duplicated poses, their direction is undefined
+    if (length < epsilon) continue;
+    segments_.push_back({p0.x, p0.y, dx / length, dy / length, length, arc_length});
+    arc_length += length;
+  }
+  if (segments_.empty()) return;
+
+  // the last segment is extended up to max_arc_length
+  const auto & last = segments_.back();
+  const double extension = std::max(max_arc_length_ - arc_length, 0.0);
+  const double end_x = last.x + last.dir_x * (last.length + extension);
+  const double end_y = last.y + last.dir_y * (last.length + extension);
+
+  min_x_ = std::min(end_x, segments_.front().x);
+  max_x_ = std::max(end_x, segments_.front().x);
+  min_y_ = std::min(end_y, segments_.front().y);
+  max_y_ = std::max(end_y, segments_.front().y);
+  for (const auto & s : segments_) {
+    min_x_ = std::min(min_x_, s.x);
+    max_x_ = std::max(max_x_, s.x);
+    min_y_ = std::min(min_y_, s.y);
+    max_y_ = std::max(max_y_, s.y);
+  }
+  min_x_ -= half_width_;
+  max_x_ += half_width_;
+  min_y_ -= half_width_;
+  max_y_ += half_width_;
+
+  num_rows_ = static_cast<size_t>(std::ceil(max_arc_length_ / cell_size_));
+  num_cols_ = static_cast<size_t>(std::ceil(2.0 * half_width_ / cell_size_));
+  cell_begin_.assign(num_rows_ * num_cols_ + 1, 0);
+  cell_max_z_.assign(num_rows_ * num_cols_, std::numeric_limits<float>::lowest());
+}
+
+std::optional<PathAlignedPoint> PathAlignedGrid::project(const pcl::PointXYZ & p) const
+{
+  if (!isValid() || p.x < min_x_ || p.x > max_x_ || p.y < min_y_ || p.y > max_y_) {
+    return std::nullopt;
+  }
+
+  // find the nearest segment, the first and last segments are not bounded behind and ahead
+  double min_dist2 = std::numeric_limits<double>::max();
+  double arc_length = 0.0;
+  double lateral_offset = 0.0;
+  for (size_t i = 0; i < segments_.size(); ++i) {
+    const auto & s = segments_[i];
+    const double rx = p.x - s.x;
+    const double ry = p.y - s.y;
+    double t = rx * s.dir_x + ry * s.dir_y;
+    if (i != 0) t = std::max(t, 0.0);
+    if (i + 1 != segments_.size()) t = std::min(t, s.length);
+    const double ex = rx - t * s.dir_x;
+    const double ey = ry - t * s.dir_y;
+    const double dist2 = ex * ex + ey * ey;
+    if (dist2 < min_dist2) {
+      min_dist2 = dist2;
+      arc_length = s.start_arc_length + t;
+      lateral_offset = s.dir_x * ry - s.dir_y * rx;
+    }
+  }
+
+  if (
+    arc_length < 0.0 || arc_length > max_arc_length_ || std::abs(lateral_offset) > half_width_) {
+    return std::nullopt;
+  }
+  return PathAlignedPoint{p, arc_length, lateral_offset};
+}
+
+void PathAlignedGrid::setInputCloud(const pcl::PointCloud<pcl::PointXYZ> & points)
+{
+  points_.clear();
+  if (!isValid()) return;
+  std::fill(cell_begin_.begin(), cell_begin_.end(), 0);
+  std::fill(cell_max_z_.begin(), cell_max_z_.end(), std::numeric_limits<float>::lowest());
+
+  // single pass over the cloud: project the points and count the points of each cell
+  std::vector<std::pair<size_t, PathAlignedPoint>> projected_points;
+  projected_points.reserve(points.size());
+  for (const auto & p : points) {
+    const auto projected = project(p);
+    if (!projected) continue;
+    const auto row = std::min(
+      static_cast<size_t>(projected->arc_length / cell_size_), num_rows_ - 1);
+    const auto col = std::min(
+      static_cast<size_t>((projected->lateral_offset + half_width_) / cell_size_), num_cols_ - 1);
+    const size_t cell = row * num_cols_ + col;
+    ++cell_begin_[cell + 1];
+    cell_max_z_[cell] = std::max(cell_max_z_[cell], p.z);
+    projected_points.emplace_back(cell, *projected);
+  }
+
+  // counting sort of the points by cell
+  for (size_t i = 1; i < cell_begin_.size(); ++i) {
+    cell_begin_[i] += cell_begin_[i - 1];
+  }
+  std::vector<size_t> cell_end(cell_begin_.begin(), cell_begin_.end() - 1);
+  points_.resize(projected_points.size());
+  for (const auto & [cell, projected] : projected_points) {
+    points_[cell_end[cell]++] = projected;
+  }
+}
+
+std::vector<PathAlignedCluster> PathAlignedGrid::extractClusters(
+  const size_t minimum_cluster_size, const size_t maximum_cluster_size,
+  const double cluster_minimum_height) const
+{
+  std::vector<PathAlignedCluster> clusters;
+  if (!isValid() || points_.empty()) return clusters;
+
+  const size_t num_cells = num_rows_ * num_cols_;
+  const auto is_occupied = [&](const size_t cell) {
+    return cell_begin_[cell + 1] > cell_begin_[cell];
+  };
+
+  std::vector<uint8_t> is_visited(num_cells, 0);
+  std::vector<size_t> stack;
+  for (size_t seed = 0; seed < num_cells; ++seed) {
+    if (is_visited[seed] || !is_occupied(seed)) continue;
+
+    PathAlignedCluster cluster;
+    float max_z = std::numeric_limits<float>::lowest();
+    is_visited[seed] = 1;
+    stack.push_back(seed);
+    while (!stack.empty()) {
+      const size_t cell = stack.back();
+      stack.pop_back();
+      cluster.cell_indices.push_back(cell);
+      cluster.num_points += cell_begin_[cell + 1] - cell_begin_[cell];
+      max_z = std::max(max_z, cell_max_z_[cell]);
+
+      const size_t row = cell / num_cols_;
+      const size_t col = cell % num_cols_;
+      for (size_t r = (row > 0 ? row - 1 : 0); r <= std::min(row + 1, num_rows_ - 1); ++r) {
+        for (size_t c = (col > 0 ? col - 1 : 0); c <= std::min(col + 1, num_cols_ - 1); ++c) {
+          const size_t neighbor = r * num_cols_ + c;
+          if (is_visited[neighbor] || !is_occupied(neighbor)) continue;
+          is_visited[neighbor] = 1;
+          stack.push_back(neighbor);
+        }
+      }
+    }
+
+    if (
+      cluster.num_points < minimum_cluster_size || cluster.num_points > maximum_cluster_size ||
+      !(max_z > cluster_minimum_height)) {
+      continue;
+    }
+    std::sort(cluster.cell_indices.begin(), cluster.cell_indices.end());
+    clusters.push_back(std::move(cluster));
+  }
+  return clusters;
+}
+
+std::optional<PathAlignedPoint> PathAlignedGrid::getClosestPoint(
+  const PathAlignedCluster & cluster, const double max_lateral_offset,
+  const double longitudinal_offset) const
+{
+  // the cells are sorted by row, so the scan can stop at the first row starting farther than the
+  // closest point found
+  std::optional<PathAlignedPoint> closest_point;
+  double min_distance = std::numeric_limits<double>::max();
+  for (const auto cell : cluster.cell_indices) {
+    const double row_arc_length = static_cast<double>(cell / num_cols_) * cell_size_;
+    if (closest_point && row_arc_length - longitudinal_offset > min_distance) break;
+    for (size_t i = cell_begin_[cell]; i < cell_begin_[cell + 1]; ++i) {
+      const auto & p = points_[i];
+      if (std::abs(p.lateral_offset) > max_lateral_offset) continue;
+      const double distance = std::abs(p.arc_length - longitudinal_offset);
+      if (distance < min_distance) {
+        closest_point = p;
+        min_distance = distance;
+      }
+    }
+  }
+  return closest_point;
+}
+
+std::vector<PathAlignedPoint> PathAlignedGrid::getPoints(const PathAlignedCluster & cluster) const
+{
+  std::vector<PathAlignedPoint> cluster_points;
+  cluster_points.reserve(cluster.num_points);
+  for (const auto cell : cluster.cell_indices) {
+    cluster_points.insert(
+      cluster_points.end(), points_.begin() + cell_begin_[cell],
+      points_.begin() + cell_begin_[cell + 1]);
+  }
+  return cluster_points;
+}
+}  // namespace autoware::motion::control::autonomous_emergency_braking
@@ -15,6 +15,7 @@
 #include "test.hpp"
 
 #include "autoware/autonomous_emergency_braking/node.hpp"
+#include "autoware/autonomous_emergency_braking/path_aligned_grid.hpp"
 #include "autoware_utils/geometry/geometry.hpp"
 
 #include <rclcpp/rclcpp.hpp>
@@ -28,6 +29,7 @@
 #include <pcl/memory.h>
 #include <tf2/LinearMath/Transform.h>
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <thread>
@@ -422,4 +424,95 @@ TEST_F(TestAEB, TestCropPointCloud)
   ASSERT_TRUE(filtered_objects->points.size() == 2 * n_points);
 }
 
+TEST_F(TestAEB, TestPathAlignedGridClustering)
+{
+  constexpr double longitudinal_velocity = 3.0;
+  constexpr double yaw_rate = 0.0;
+  const auto imu_path = aeb_node_->generateEgoPath(longitudinal_velocity, yaw_rate);
+  ASSERT_FALSE(imu_path.empty());
+
+  constexpr double cell_size{0.15};
+  constexpr double half_width{2.0};
+  constexpr double max_arc_length{5.0};
+  PathAlignedGrid grid(imu_path, cell_size, half_width, max_arc_length);
+  ASSERT_TRUE(grid.isValid());
+
+  PointCloud obstacle_points;
+  // object on the path: a 3 x 4 block of points spaced by 0.1 [m]
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 4; ++j) {
+      obstacle_points.push_back(pcl::PointXYZ(3.0 + 0.1 * i, -0.15 + 0.1 * j, 0.5));
+    }
+  }
+  // object next to the path, but too low to be a target
+  for (size_t i = 0; i < 10; ++i) {
+    obstacle_points.push_back(pcl::PointXYZ(2.0 + 0.1 * i, 1.5, 0.05));
+  }
+  // isolated noise point
+  obstacle_points.push_back(pcl::PointXYZ(1.0, -1.0, 0.5));
+  // points outside of the grid
+  obstacle_points.push_back(pcl::PointXYZ(1.0, 3.0, 0.5));
+  obstacle_points.push_back(pcl::PointXYZ(-1.0, 0.0, 0.5));
+  obstacle_points.push_back(pcl::PointXYZ(6.0, 0.0, 0.5));
+
+  grid.setInputCloud(obstacle_points);
+  ASSERT_EQ(grid.getNumPoints(), 23U);
+
+  const auto clusters = grid.extractClusters(10, 10000, 0.1);
+  ASSERT_EQ(clusters.size(), 1U);
+  EXPECT_EQ(clusters.front().num_points, 12U);
+
+  const auto closest_point = grid.getClosestPoint(clusters.front(), 1.0, 0.0);
+  ASSERT_TRUE(closest_point.has_value());
+  EXPECT_NEAR(closest_point->arc_length, 3.0, 1e-3);
+  EXPECT_NEAR(closest_point->point.x, 3.0, 1e-3);
+  EXPECT_FALSE(grid.getClosestPoint(clusters.front(), 0.01, 0.0).has_value());
+
+  // the closest point is the one nearest to the ego front, even if other points are behind it
+  const auto closest_point_to_front = grid.getClosestPoint(clusters.front(), 1.0, 3.18);
+  ASSERT_TRUE(closest_point_to_front.has_value());
+  EXPECT_NEAR(closest_point_to_front->arc_length, 3.2, 1e-3);
+
+  // the low object is kept when the height threshold is lower than its points
+  EXPECT_EQ(grid.extractClusters(10, 10000, 0.0).size(), 2U);
+  // the object on the path is discarded when it is larger than the maximum cluster size
+  EXPECT_TRUE(grid.extractClusters(10, 11, 0.1).empty());
+}
+
+TEST_F(TestAEB, TestGetClosestObjectsOnPathWithGrid)
+{
+  constexpr double longitudinal_velocity = 3.0;
+  constexpr double yaw_rate = 0.05;
+  const auto imu_path = aeb_node_->generateEgoPath(longitudinal_velocity, yaw_rate);
+  ASSERT_FALSE(imu_path.empty());
+
+  PointCloud::Ptr obstacle_points_ptr = pcl::make_shared<PointCloud>();
+  for (size_t i = 0; i < 4; ++i) {
+    for (size_t j = 0; j < 4; ++j) {
+      obstacle_points_ptr->push_back(pcl::PointXYZ(2.0 + 0.1 * i, 0.1 * j, 0.5));
+    }
+  }
+  obstacle_points_ptr->push_back(pcl::PointXYZ(100.0, 100.0, 0.5));
+
+  std::vector<ObjectData> objects;
+  PointCloud::Ptr cluster_points = pcl::make_shared<PointCloud>();
+  aeb_node_->getClosestObjectsOnPathWithGrid(
+    imu_path, aeb_node_->now(), obstacle_points_ptr, objects, cluster_points);
+  ASSERT_EQ(objects.size(), 1U);
+  EXPECT_TRUE(objects.front().is_target);
+  EXPECT_NEAR(objects.front().position.x, 2.0, 1e-3);
+
+  // the result is consistent with the search on the points of the clusters
+  std::vector<ObjectData> expected_objects;
+  aeb_node_->getClosestObjectsOnPath(
+    imu_path, aeb_node_->now(), obstacle_points_ptr, expected_objects);
+  const auto closest_expected_object = std::min_element(
+    expected_objects.begin(), expected_objects.end(), [](const auto & o1, const auto & o2) {
+      return o1.distance_to_object < o2.distance_to_object;
+    });
+  ASSERT_NE(closest_expected_object, expected_objects.end());
+  EXPECT_NEAR(
+    objects.front().distance_to_object, closest_expected_object->distance_to_object, 1e-2);
+}
+
 }  // namespace autoware::motion::control::autonomous_emergency_braking::test
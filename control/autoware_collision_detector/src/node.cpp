@@ -339,8 +339,8 @@ void CollisionDetectorNode::checkCollision(diagnostic_updater::DiagnosticStatusW
     return;
   }
 
-  pointcloud_ptr_ = sub_pointcloud_.take_data();
-  object_ptr_ = sub_dynamic_objects_.take_data();
+  pointcloud_ptr_ = sub_pointcloud_.takeData();
+  object_ptr_ = sub_dynamic_objects_.takeData();
   operation_mode_ptr_ = sub_operation_mode_.take_data();
 
   if (node_param_.use_pointcloud && !pointcloud_ptr_) {
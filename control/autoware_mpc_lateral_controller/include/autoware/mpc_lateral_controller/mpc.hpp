@@ -30,6 +30,7 @@
 #include "geometry_msgs/msg/pose.hpp"
 #include "nav_msgs/msg/odometry.hpp"
 
+#include <array>
 #include <deque>
 #include <memory>
 #include <string>
@@ -191,6 +192,39 @@ struct MPCMatrix
   MPCMatrix() = default;
 };
 
+/**
+ * Work buffers for the MPC matrix generation and the QP problem. They are allocated when the
+ * prediction horizon or the vehicle model dimension changes and reused in the other control cycles.
+ */
+struct MPCWorkspace
+{
+  int horizon{0};
+  int dim_x{0};
+  int dim_u{0};
+  int dim_y{0};
+
+  // discrete vehicle model of a prediction step
+  MatrixXd Ad;
+  MatrixXd Bd;
+  MatrixXd Wd;
+  MatrixXd Cd;
+  MatrixXd Uref;
+
+  // condensed QP problem
+  MatrixXd CB;
+  MatrixXd QCB;
+  MatrixXd H;
+  MatrixXd f;
+  MatrixXd f_vec;
+  MatrixXd A;
+  VectorXd X;
+  VectorXd Y;
+  VectorXd lb;
+  VectorXd ub;
+  VectorXd lbA;
+  VectorXd ubA;
+};
+
 struct ResultWithReason
 {
   bool result{false};
@@ -227,6 +261,14 @@ private:
 
   bool m_is_forward_shift = true;  // Flag indicating if the shift is in the forward direction.
 
+  MPCMatrix m_mpc_matrix;       // MPC matrix of the latest control cycle.
+  MPCWorkspace m_mpc_workspace;  // Buffers reused across the control cycles.
+
+  // Upper edges of the QP solve time histogram bins [ms]. The last bin has no upper edge.
+  static constexpr std::array<double, 5> m_qp_solve_time_bin_edges_ms{1.0, 2.0, 5.0, 10.0, 20.0};
+  double m_qp_solve_time_ms = 0.0;  // QP solve time of the latest control cycle [ms].
+  std::array<int64_t, m_qp_solve_time_bin_edges_ms.size() + 1> m_qp_solve_time_histogram{};
+
   rclcpp::Publisher<Trajectory>::SharedPtr m_debug_frenet_predicted_trajectory_pub;
   rclcpp::Publisher<Trajectory>::SharedPtr m_debug_resampled_reference_trajectory_pub;
   /**
@@ -257,13 +299,19 @@ private:
   std::pair<bool, VectorXd> updateStateForDelayCompensation(
     const MPCTrajectory & traj, const double & start_time, const VectorXd & x0_orig);
 
+  /**
+   * @brief Allocate the MPC matrix and the work buffers if the horizon or the vehicle model
+   * dimension has changed.
+   */
+  void resizeMPCWorkspace();
+
   /**
    * @brief Generate the MPC matrix using the reference trajectory and vehicle model.
    * @param reference_trajectory The reference trajectory used for linearization.
    * @param prediction_dt The prediction time step.
-   * @return The generated MPC matrix.
+   * @return The generated MPC matrix, which is valid until the next call.
    */
-  MPCMatrix generateMPCMatrix(
+  const MPCMatrix & generateMPCMatrix(
     const MPCTrajectory & reference_trajectory, const double prediction_dt);
 
   /**
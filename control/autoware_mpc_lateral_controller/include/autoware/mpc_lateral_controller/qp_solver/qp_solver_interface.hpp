@@ -49,6 +49,7 @@ public:
   virtual int64_t getTakenIter() const { return 0; }
   virtual double getRunTime() const { return 0.0; }
   virtual double getObjVal() const { return 0.0; }
+  virtual bool isFallbackUsed() const { return false; }
 };
 }  // namespace autoware::motion::control::mpc_lateral_controller
 #endif  // AUTOWARE__MPC_LATERAL_CONTROLLER__QP_SOLVER__QP_SOLVER_INTERFACE_HPP_
@@ -16,12 +16,25 @@
 #define AUTOWARE__MPC_LATERAL_CONTROLLER__QP_SOLVER__QP_SOLVER_OSQP_HPP_
 
 #include "autoware/mpc_lateral_controller/qp_solver/qp_solver_interface.hpp"
+#include "autoware/mpc_lateral_controller/qp_solver/qp_solver_unconstraint_fast.hpp"
 #include "autoware/osqp_interface/osqp_interface.hpp"
 #include "rclcpp/rclcpp.hpp"
 
+#include <memory>
+#include <vector>
+
 namespace autoware::motion::control::mpc_lateral_controller
 {
 
+/// Parameters of QPSolverOSQP
+struct QPSolverOSQPParam
+{
+  bool enable_warm_start{true};  //!< @brief start from the previous solution shifted by one step
+  int max_iter{4000};            //!< @brief maximum number of ADMM iterations
+  double time_limit_ms{0.0};     //!< @brief solve time budget [ms] (disabled if not positive)
+  bool enable_fallback{false};   //!< @brief use the unconstrained solver if osqp does not converge
+};
+
 /// Solver for QP problems using the OSQP library
 class QPSolverOSQP : public QPSolverInterface
 {
@@ -29,7 +42,9 @@ public:
   /**
    * @brief constructor
    */
-  QPSolverOSQP(const rclcpp::Logger & logger, rclcpp::Clock::SharedPtr clock_);
+  QPSolverOSQP(
+    const rclcpp::Logger & logger, rclcpp::Clock::SharedPtr clock_,
+    const QPSolverOSQPParam & param = QPSolverOSQPParam{});
 
   /**
    * @brief destructor
@@ -38,6 +53,11 @@ public:
 
   /**
    * @brief solve QP problem : minimize j = u' * h_mat * u + f_vec' * u without constraint
+   * @details The osqp workspace is kept while the problem size and the sparsity pattern of the
+   * constraint matrix are unchanged, and only the values are updated. The iteration limit is
+   * reduced so that the solve fits in time_limit_ms. If enabled, the fallback when osqp does not
+   * converge is the unconstrained solution, made to satisfy the constraints row by row when the
+   * constraint matrix is lower triangular with a unit diagonal.
    * @param [in] h_mat parameter matrix in object function
    * @param [in] f_vec parameter matrix in object function
    * @param [in] a parameter matrix for constraint lb_a < a*u < ub_a (not used here)
@@ -53,14 +73,53 @@ public:
     const Eigen::VectorXd & lb, const Eigen::VectorXd & ub, const Eigen::VectorXd & lb_a,
     const Eigen::VectorXd & ub_a, Eigen::VectorXd & u) override;
 
-  int64_t getTakenIter() const override { return osqpsolver_.getTakenIter(); }
-  double getRunTime() const override { return osqpsolver_.getRunTime(); }
-  double getObjVal() const override { return osqpsolver_.getObjVal(); }
+  int64_t getTakenIter() const override
+  {
+    return osqpsolver_ptr_ ? osqpsolver_ptr_->getTakenIter() : 0;
+  }
+  double getRunTime() const override
+  {
+    return osqpsolver_ptr_ ? osqpsolver_ptr_->getRunTime() : 0.0;
+  }
+  double getObjVal() const override
+  {
+    return osqpsolver_ptr_ ? osqpsolver_ptr_->getObjVal() : 0.0;
+  }
+  bool isFallbackUsed() const override { return is_fallback_used_; }
 
 private:
-  autoware::osqp_interface::OSQPInterface osqpsolver_;
+  /**
+   * @brief set the problem to the osqp workspace, which is created only if the structure changes
+   */
+  void setProblem(
+    const Eigen::MatrixXd & h_mat, const Eigen::MatrixXd & a, const std::vector<double> & f,
+    const std::vector<double> & lower_bound, const std::vector<double> & upper_bound);
+
+  /**
+   * @brief set the initial guess from the previous solution shifted by one step
+   */
+  void setWarmStart();
+
+  /**
+   * @brief limit the iteration number from the time per iteration of the previous solve
+   */
+  void updateIterationLimit();
+
+  std::unique_ptr<autoware::osqp_interface::OSQPInterface> osqpsolver_ptr_;
+  QPSolverEigenLeastSquareLLT fallback_solver_;
+  QPSolverOSQPParam param_;
   rclcpp::Logger logger_;
   rclcpp::Clock::SharedPtr clock_;
+
+  // problem in the CSC format, whose sparsity pattern is reused between the calls
+  autoware::osqp_interface::CSC_Matrix p_csc_;
+  autoware::osqp_interface::CSC_Matrix a_csc_;
+
+  // previous solution for the warm start
+  std::vector<double> prev_primal_;
+  std::vector<double> prev_dual_;
+  bool has_prev_solution_{false};
+  bool is_fallback_used_{false};
 };
 }  // namespace autoware::motion::control::mpc_lateral_controller
 #endif  // AUTOWARE__MPC_LATERAL_CONTROLLER__QP_SOLVER__QP_SOLVER_OSQP_HPP_
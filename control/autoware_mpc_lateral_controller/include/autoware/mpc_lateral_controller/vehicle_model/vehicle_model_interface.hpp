@@ -96,6 +96,8 @@ public:
    * @param [out] c_d coefficient matrix
    * @param [out] w_d coefficient matrix
    * @param [in] dt Discretization time [s]
+   * @note the implementations discretize with fixed-size matrices of the model dimension, not to
+   * allocate memory in every prediction step
    */
   virtual void calculateDiscreteMatrix(
     Eigen::MatrixXd & a_d, Eigen::MatrixXd & b_d, Eigen::MatrixXd & c_d, Eigen::MatrixXd & w_d,
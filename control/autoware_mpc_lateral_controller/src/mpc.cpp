@@ -23,6 +23,7 @@
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <limits>
 #include <string>
@@ -83,7 +84,7 @@ ResultWithReason MPC::calculateMPC(
   }
 
   // generate mpc matrix : predict equation Xec = Aex * x0 + Bex * Uex + Wex
-  const auto mpc_matrix = generateMPCMatrix(mpc_resampled_ref_trajectory, prediction_dt);
+  const auto & mpc_matrix = generateMPCMatrix(mpc_resampled_ref_trajectory, prediction_dt);
 
   // solve Optimization problem
   const auto [opt_result, Uex] = executeOptimization(
@@ -192,6 +193,13 @@ Float32MultiArrayStamped MPC::generateDiagData(
   append_diag(iteration_num);             // [18] iteration number
   append_diag(runtime);                   // [19] runtime of the latest problem solved
   append_diag(objective_value);           // [20] objective value of the latest problem solved
+  append_diag(m_qp_solve_time_ms);        // [21] qp solve time of the latest problem [ms]
+  append_diag(m_qpsolver_ptr->isFallbackUsed());  // [22] fallback solver is used or not
+  // [23]-[28] number of the qp solves whose time is in [0, 1), [1, 2), [2, 5), [5, 10), [10, 20)
+  // and [20, inf) [ms]
+  for (const auto count : m_qp_solve_time_histogram) {
+    append_diag(count);
+  }
 
   return diagnostic;
 }
@@ -432,21 +440,24 @@ MPCTrajectory MPC::applyVelocityDynamicsFilter(
   return output;
 }
 
-/*
- * predict equation: Xec = Aex * x0 + Bex * Uex + Wex
- * cost function: J = Xex' * Qex * Xex + (Uex - Uref)' * R1ex * (Uex - Uref_ex) + Uex' * R2ex * Uex
- * Qex = diag([Q,Q,...]), R1ex = diag([R,R,...])
- */
-MPCMatrix MPC::generateMPCMatrix(
-  const MPCTrajectory & reference_trajectory, const double prediction_dt)
+void MPC::resizeMPCWorkspace()
 {
   const int N = m_param.prediction_horizon;
-  const double DT = prediction_dt;
   const int DIM_X = m_vehicle_model_ptr->getDimX();
   const int DIM_U = m_vehicle_model_ptr->getDimU();
   const int DIM_Y = m_vehicle_model_ptr->getDimY();
 
-  MPCMatrix m;
+  auto & w = m_mpc_workspace;
+  if (w.horizon == N && w.dim_x == DIM_X && w.dim_u == DIM_U && w.dim_y == DIM_Y) {
+    return;
+  }
+  w.horizon = N;
+  w.dim_x = DIM_X;
+  w.dim_u = DIM_U;
+  w.dim_y = DIM_Y;
+
+  // the blocks which are not written in generateMPCMatrix() stay zero
+  auto & m = m_mpc_matrix;
   m.Aex = MatrixXd::Zero(DIM_X * N, DIM_X);
   m.Bex = MatrixXd::Zero(DIM_X * N, DIM_U * N);
   m.Wex = MatrixXd::Zero(DIM_X * N, 1);
@@ -456,17 +467,52 @@ MPCMatrix MPC::generateMPCMatrix(
   m.R2ex = MatrixXd::Zero(DIM_U * N, DIM_U * N);
   m.Uref_ex = MatrixXd::Zero(DIM_U * N, 1);
 
-  // weight matrix depends on the vehicle model
-  MatrixXd Q = MatrixXd::Zero(DIM_Y, DIM_Y);
-  MatrixXd R = MatrixXd::Zero(DIM_U, DIM_U);
-  MatrixXd Q_adaptive = MatrixXd::Zero(DIM_Y, DIM_Y);
-  MatrixXd R_adaptive = MatrixXd::Zero(DIM_U, DIM_U);
+  w.Ad = MatrixXd::Zero(DIM_X, DIM_X);
+  w.Bd = MatrixXd::Zero(DIM_X, DIM_U);
+  w.Wd = MatrixXd::Zero(DIM_X, 1);
+  w.Cd = MatrixXd::Zero(DIM_Y, DIM_X);
+  w.Uref = MatrixXd::Zero(DIM_U, 1);
+
+  const int DIM_U_N = DIM_U * N;
+  w.CB = MatrixXd::Zero(DIM_Y * N, DIM_U_N);
+  w.QCB = MatrixXd::Zero(DIM_Y * N, DIM_U_N);
+  w.H = MatrixXd::Zero(DIM_U_N, DIM_U_N);
+  w.f = MatrixXd::Zero(1, DIM_U_N);
+  w.f_vec = MatrixXd::Zero(DIM_U_N, 1);
+  w.X = VectorXd::Zero(DIM_X);
+  w.Y = VectorXd::Zero(DIM_Y);
+  w.lb = VectorXd::Zero(DIM_U_N);
+  w.ub = VectorXd::Zero(DIM_U_N);
+  w.lbA = VectorXd::Zero(DIM_U_N);
+  w.ubA = VectorXd::Zero(DIM_U_N);
+
+  w.A = MatrixXd::Identity(DIM_U_N, DIM_U_N);
+  for (int i = 1; i < DIM_U_N; i++) {
+    w.A(i, i - 1) = -1.0;
+  }
+}
 
-  MatrixXd Ad(DIM_X, DIM_X);
-  MatrixXd Bd(DIM_X, DIM_U);
-  MatrixXd Wd(DIM_X, 1);
-  MatrixXd Cd(DIM_Y, DIM_X);
-  MatrixXd Uref(DIM_U, 1);
+/*
+ * predict equation: Xec = Aex * x0 + Bex * Uex + Wex
+ * cost function: J = Xex' * Qex * Xex + (Uex - Uref)' * R1ex * (Uex - Uref_ex) + Uex' * R2ex * Uex
+ * Qex = diag([Q,Q,...]), R1ex = diag([R,R,...])
+ */
+const MPCMatrix & MPC::generateMPCMatrix(
+  const MPCTrajectory & reference_trajectory, const double prediction_dt)
+{
+  const int N = m_param.prediction_horizon;
+  const double DT = prediction_dt;
+  const int DIM_X = m_vehicle_model_ptr->getDimX();
+  const int DIM_U = m_vehicle_model_ptr->getDimU();
+  const int DIM_Y = m_vehicle_model_ptr->getDimY();
+
+  resizeMPCWorkspace();
+  auto & m = m_mpc_matrix;
+  auto & w = m_mpc_workspace;
+
+  // the steering weights are accumulated on the band of R1ex and R2ex
+  m.R1ex.setZero();
+  m.R2ex.setZero();
 
   const double sign_vx = m_is_forward_shift ? 1 : -1;
 
@@ -482,54 +528,53 @@ MPCMatrix MPC::generateMPCMatrix(
     // get discrete state matrix A, B, C, W
     m_vehicle_model_ptr->setVelocity(ref_vx);
     m_vehicle_model_ptr->setCurvature(ref_k);
-    m_vehicle_model_ptr->calculateDiscreteMatrix(Ad, Bd, Cd, Wd, DT);
+    m_vehicle_model_ptr->calculateDiscreteMatrix(w.Ad, w.Bd, w.Cd, w.Wd, DT);
 
-    Q = MatrixXd::Zero(DIM_Y, DIM_Y);
-    R = MatrixXd::Zero(DIM_U, DIM_U);
+    // update mpc matrix
+    const int idx_x_i = i * DIM_X;
+    const int idx_u_i = i * DIM_U;
+    const int idx_y_i = i * DIM_Y;
+
+    // weight matrix depends on the vehicle model. Qex and R1ex are block diagonal, so the weights
+    // are written into the diagonal blocks directly.
     const auto mpc_weight = getWeight(ref_k);
+    auto Q = m.Qex.block(idx_y_i, idx_y_i, DIM_Y, DIM_Y);
+    auto R = m.R1ex.block(idx_u_i, idx_u_i, DIM_U, DIM_U);
+    Q.setZero();
     Q(0, 0) = mpc_weight.lat_error;
     Q(1, 1) = mpc_weight.heading_error;
     R(0, 0) = mpc_weight.steering_input;
-
-    Q_adaptive = Q;
-    R_adaptive = R;
     if (i == N - 1) {
-      Q_adaptive(0, 0) = m_param.nominal_weight.terminal_lat_error;
-      Q_adaptive(1, 1) = m_param.nominal_weight.terminal_heading_error;
+      Q(0, 0) = m_param.nominal_weight.terminal_lat_error;
+      Q(1, 1) = m_param.nominal_weight.terminal_heading_error;
     }
-    Q_adaptive(1, 1) += ref_vx_squared * mpc_weight.heading_error_squared_vel;
-    R_adaptive(0, 0) += ref_vx_squared * mpc_weight.steering_input_squared_vel;
+    Q(1, 1) += ref_vx_squared * mpc_weight.heading_error_squared_vel;
+    R(0, 0) += ref_vx_squared * mpc_weight.steering_input_squared_vel;
 
-    // update mpc matrix
-    int idx_x_i = i * DIM_X;
-    int idx_u_i = i * DIM_U;
-    int idx_y_i = i * DIM_Y;
     if (i == 0) {
-      m.Aex.block(0, 0, DIM_X, DIM_X) = Ad;
-      m.Bex.block(0, 0, DIM_X, DIM_U) = Bd;
-      m.Wex.block(0, 0, DIM_X, 1) = Wd;
+      m.Aex.block(0, 0, DIM_X, DIM_X) = w.Ad;
+      m.Wex.block(0, 0, DIM_X, 1) = w.Wd;
     } else {
-      int idx_x_i_prev = (i - 1) * DIM_X;
-      m.Aex.block(idx_x_i, 0, DIM_X, DIM_X) = Ad * m.Aex.block(idx_x_i_prev, 0, DIM_X, DIM_X);
-      for (int j = 0; j < i; ++j) {
-        int idx_u_j = j * DIM_U;
-        m.Bex.block(idx_x_i, idx_u_j, DIM_X, DIM_U) =
-          Ad * m.Bex.block(idx_x_i_prev, idx_u_j, DIM_X, DIM_U);
-      }
-      m.Wex.block(idx_x_i, 0, DIM_X, 1) = Ad * m.Wex.block(idx_x_i_prev, 0, DIM_X, 1) + Wd;
+      // Bex is block lower triangular, so only the non-zero blocks of the previous step are
+      // propagated by Ad.
+      const int idx_x_i_prev = (i - 1) * DIM_X;
+      m.Aex.block(idx_x_i, 0, DIM_X, DIM_X).noalias() =
+        w.Ad * m.Aex.block(idx_x_i_prev, 0, DIM_X, DIM_X);
+      m.Bex.block(idx_x_i, 0, DIM_X, idx_u_i).noalias() =
+        w.Ad * m.Bex.block(idx_x_i_prev, 0, DIM_X, idx_u_i);
+      m.Wex.block(idx_x_i, 0, DIM_X, 1).noalias() = w.Ad * m.Wex.block(idx_x_i_prev, 0, DIM_X, 1);
+      m.Wex.block(idx_x_i, 0, DIM_X, 1) += w.Wd;
     }
-    m.Bex.block(idx_x_i, idx_u_i, DIM_X, DIM_U) = Bd;
-    m.Cex.block(idx_y_i, idx_x_i, DIM_Y, DIM_X) = Cd;
-    m.Qex.block(idx_y_i, idx_y_i, DIM_Y, DIM_Y) = Q_adaptive;
-    m.R1ex.block(idx_u_i, idx_u_i, DIM_U, DIM_U) = R_adaptive;
+    m.Bex.block(idx_x_i, idx_u_i, DIM_X, DIM_U) = w.Bd;
+    m.Cex.block(idx_y_i, idx_x_i, DIM_Y, DIM_X) = w.Cd;
 
     // get reference input (feed-forward)
     m_vehicle_model_ptr->setCurvature(ref_smooth_k);
-    m_vehicle_model_ptr->calculateReferenceInput(Uref);
-    if (std::fabs(Uref(0, 0)) < autoware_utils::deg2rad(m_param.zero_ff_steer_deg)) {
-      Uref(0, 0) = 0.0;  // ignore curvature noise
+    m_vehicle_model_ptr->calculateReferenceInput(w.Uref);
+    if (std::fabs(w.Uref(0, 0)) < autoware_utils::deg2rad(m_param.zero_ff_steer_deg)) {
+      w.Uref(0, 0) = 0.0;  // ignore curvature noise
     }
-    m.Uref_ex.block(i * DIM_U, 0, DIM_U, 1) = Uref;
+    m.Uref_ex.block(i * DIM_U, 0, DIM_U, 1) = w.Uref;
   }
 
   // add lateral jerk : weight for (v * {u(i) - u(i-1)} )^2
@@ -578,48 +623,76 @@ std::pair<ResultWithReason, VectorXd> MPC::executeOptimization(
     return {ResultWithReason{false, "invalid model matrix"}, {}};
   }
 
-  const int DIM_U_N = m_param.prediction_horizon * m_vehicle_model_ptr->getDimU();
+  const int N = m_param.prediction_horizon;
+  const int DIM_X = m_vehicle_model_ptr->getDimX();
+  const int DIM_U = m_vehicle_model_ptr->getDimU();
+  const int DIM_Y = m_vehicle_model_ptr->getDimY();
+
+  resizeMPCWorkspace();
+  auto & w = m_mpc_workspace;
 
   // cost function: 1/2 * Uex' * H * Uex + f' * Uex,  H = B' * C' * Q * C * B + R
-  const MatrixXd CB = m.Cex * m.Bex;
-  const MatrixXd QCB = m.Qex * CB;
-  // MatrixXd H = CB.transpose() * QCB + m.R1ex + m.R2ex; // This calculation is heavy. looking for
-  // a good way.  //NOLINT
-  MatrixXd H = MatrixXd::Zero(DIM_U_N, DIM_U_N);
-  H.triangularView<Eigen::Upper>() = CB.transpose() * QCB;
-  H.triangularView<Eigen::Upper>() += m.R1ex + m.R2ex;
-  H.triangularView<Eigen::Lower>() = H.transpose();
-  MatrixXd f = (m.Cex * (m.Aex * x0 + m.Wex)).transpose() * QCB - m.Uref_ex.transpose() * m.R1ex;
-  addSteerWeightF(prediction_dt, f);
-
-  MatrixXd A = MatrixXd::Identity(DIM_U_N, DIM_U_N);
-  for (int i = 1; i < DIM_U_N; i++) {
-    A(i, i - 1) = -1.0;
-  }
+  // Cex and Qex are block diagonal and Bex is block lower triangular, so the products are
+  // accumulated block row by block row only over the non-zero block columns. The remaining blocks
+  // of CB and QCB stay zero.
+  w.H.setZero();
+  w.f.setZero();
+  for (int i = 0; i < N; ++i) {
+    const int idx_x_i = i * DIM_X;
+    const int idx_y_i = i * DIM_Y;
+    const int cols = (i + 1) * DIM_U;
+    const auto C_i = m.Cex.block(idx_y_i, idx_x_i, DIM_Y, DIM_X);
+    const auto Q_i = m.Qex.block(idx_y_i, idx_y_i, DIM_Y, DIM_Y);
+    auto CB_i = w.CB.block(idx_y_i, 0, DIM_Y, cols);
+    auto QCB_i = w.QCB.block(idx_y_i, 0, DIM_Y, cols);
+    CB_i.noalias() = C_i * m.Bex.block(idx_x_i, 0, DIM_X, cols);
+    QCB_i.noalias() = Q_i * CB_i;
+    w.H.topLeftCorner(cols, cols).noalias() += CB_i.transpose() * QCB_i;
+
+    // output of the free response: C * (Aex * x0 + Wex)
+    w.X.noalias() = m.Aex.block(idx_x_i, 0, DIM_X, DIM_X) * x0;
+    w.X += m.Wex.block(idx_x_i, 0, DIM_X, 1);
+    w.Y.noalias() = C_i * w.X;
+    w.f.leftCols(cols).noalias() += w.Y.transpose() * QCB_i;
+  }
+  w.H.triangularView<Eigen::Upper>() += m.R1ex + m.R2ex;
+  w.H.triangularView<Eigen::Lower>() = w.H.transpose();
+  w.f.noalias() -= m.Uref_ex.transpose() * m.R1ex;
+  addSteerWeightF(prediction_dt, w.f);
+  w.f_vec = w.f.transpose();
+
+  const auto & H = w.H;
+  const auto & A = w.A;
 
   // steering angle limit
-  VectorXd lb = VectorXd::Constant(DIM_U_N, -m_steer_lim);  // min steering angle
-  VectorXd ub = VectorXd::Constant(DIM_U_N, m_steer_lim);   // max steering angle
+  auto & lb = w.lb;
+  auto & ub = w.ub;
+  lb.setConstant(-m_steer_lim);  // min steering angle
+  ub.setConstant(m_steer_lim);   // max steering angle
 
   // steering angle rate limit
-  VectorXd steer_rate_limits = calcSteerRateLimitOnTrajectory(traj, current_velocity);
-  VectorXd ubA = steer_rate_limits * prediction_dt;
-  VectorXd lbA = -steer_rate_limits * prediction_dt;
+  const VectorXd steer_rate_limits = calcSteerRateLimitOnTrajectory(traj, current_velocity);
+  auto & ubA = w.ubA;
+  auto & lbA = w.lbA;
+  ubA = steer_rate_limits * prediction_dt;
+  lbA = -steer_rate_limits * prediction_dt;
   ubA(0) = m_raw_steer_cmd_prev + steer_rate_limits(0) * m_ctrl_period;
   lbA(0) = m_raw_steer_cmd_prev - steer_rate_limits(0) * m_ctrl_period;
 
-  auto t_start = std::chrono::system_clock::now();
-  bool solve_result = m_qpsolver_ptr->solve(H, f.transpose(), A, lb, ub, lbA, ubA, Uex);
-  auto t_end = std::chrono::system_clock::now();
+  auto t_start = std::chrono::steady_clock::now();
+  bool solve_result = m_qpsolver_ptr->solve(H, w.f_vec, A, lb, ub, lbA, ubA, Uex);
+  auto t_end = std::chrono::steady_clock::now();
+
+  m_qp_solve_time_ms = std::chrono::duration<double, std::milli>(t_end - t_start).count();
+  const auto bin = std::upper_bound(
+    m_qp_solve_time_bin_edges_ms.begin(), m_qp_solve_time_bin_edges_ms.end(), m_qp_solve_time_ms);
+  ++m_qp_solve_time_histogram.at(std::distance(m_qp_solve_time_bin_edges_ms.begin(), bin));
+  RCLCPP_DEBUG(m_logger, "qp solver calculation time = %f [ms]", m_qp_solve_time_ms);
+
   if (!solve_result) {
     return {ResultWithReason{false, "qp solver error"}, {}};
   }
 
-  {
-    auto t = std::chrono::duration_cast<std::chrono::milliseconds>(t_end - t_start).count();
-    RCLCPP_DEBUG(m_logger, "qp solver calculation time = %ld [ms]", t);
-  }
-
   if (Uex.array().isNaN().any()) {
     return {ResultWithReason{false, "model Uex including NaN"}, {}};
   }
@@ -210,7 +210,12 @@ std::shared_ptr<QPSolverInterface> MpcLateralController::createQPSolverInterface
   }
 
   if (qp_solver_type == "osqp") {
-    qpsolver_ptr = std::make_shared<QPSolverOSQP>(logger_, clock_);
+    QPSolverOSQPParam param;
+    param.enable_warm_start = node.declare_parameter<bool>("osqp_enable_warm_start");
+    param.max_iter = node.declare_parameter<int>("osqp_max_iter");
+    param.time_limit_ms = node.declare_parameter<double>("osqp_time_limit_ms");
+    param.enable_fallback = node.declare_parameter<bool>("osqp_enable_fallback");
+    qpsolver_ptr = std::make_shared<QPSolverOSQP>(logger_, clock_, param);
     return qpsolver_ptr;
   }
 
@@ -283,8 +288,6 @@ trajectory_follower::LateralOutput MpcLateralController::run(
   }
   m_mpc_solved_status = mpc_solved_status;  // for diagnostic updater
 
-  diag_updater_->force_update();
-
   // reset previous MPC result
   // Note: When a large deviation from the trajectory occurs, the optimization stops and
   // the vehicle will return to the path by re-planning the trajectory or external operation.
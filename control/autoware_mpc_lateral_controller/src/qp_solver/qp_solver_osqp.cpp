@@ -14,46 +14,213 @@
 
 #include "autoware/mpc_lateral_controller/qp_solver/qp_solver_osqp.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace autoware::motion::control::mpc_lateral_controller
 {
-QPSolverOSQP::QPSolverOSQP(const rclcpp::Logger & logger, rclcpp::Clock::SharedPtr clock)
-: logger_{logger}, clock_{clock}
+using autoware::osqp_interface::CSC_Matrix;
+
+namespace
+{
+// Keep all the entries of the upper triangular part so that the sparsity pattern does not depend
+// on the values, e.g. some entries of the hessian become zero when the vehicle stops.
+void toUpperTriangularCSC(const Eigen::MatrixXd & mat, CSC_Matrix & csc)
+{
+  const Eigen::Index n = mat.cols();
+  csc.m_vals.clear();
+  csc.m_row_idxs.clear();
+  csc.m_col_idxs.clear();
+  csc.m_col_idxs.push_back(0);
+  for (Eigen::Index j = 0; j < n; ++j) {
+    for (Eigen::Index i = 0; i <= j; ++i) {
+      csc.m_vals.push_back(mat(i, j));
+      csc.m_row_idxs.push_back(static_cast<c_int>(i));
+    }
+    csc.m_col_idxs.push_back(static_cast<c_int>(csc.m_vals.size()));
+  }
+}
+
+// CSC matrix of [I; a] for the constraints lb < u < ub and lb_a < a * u < ub_a
+void toStackedConstraintCSC(const Eigen::MatrixXd & a, CSC_Matrix & csc)
+{
+  const Eigen::Index n = a.cols();
+  csc.m_vals.clear();
+  csc.m_row_idxs.clear();
+  csc.m_col_idxs.clear();
+  csc.m_col_idxs.push_back(0);
+  for (Eigen::Index j = 0; j < n; ++j) {
+    csc.m_vals.push_back(1.0);
+    csc.m_row_idxs.push_back(static_cast<c_int>(j));
+    for (Eigen::Index i = 0; i < a.rows(); ++i) {
+      if (a(i, j) != 0.0) {
+        csc.m_vals.push_back(a(i, j));
+        csc.m_row_idxs.push_back(static_cast<c_int>(n + i));
+      }
+    }
+    csc.m_col_idxs.push_back(static_cast<c_int>(csc.m_vals.size()));
+  }
+}
+
+bool hasSamePattern(const CSC_Matrix & lhs, const CSC_Matrix & rhs)
+{
+  return lhs.m_row_idxs == rhs.m_row_idxs && lhs.m_col_idxs == rhs.m_col_idxs;
+}
+
+// shift the values of each block of size n by one step, the last value is kept
+void shiftByOneStep(std::vector<double> & values, const size_t n)
+{
+  for (size_t offset = 0; offset + n <= values.size(); offset += n) {
+    std::rotate(
+      values.begin() + static_cast<std::ptrdiff_t>(offset),
+      values.begin() + static_cast<std::ptrdiff_t>(offset + 1),
+      values.begin() + static_cast<std::ptrdiff_t>(offset + n));
+    values.at(offset + n - 1) = values.at(offset + n - 2);
+  }
+}
+
+// Make u satisfy lb < u < ub and lb_a < a * u < ub_a, for a lower triangular a with a unit
+// diagonal, e.g. the steering rate constraints starting from the previous command. The constraint
+// of each row is satisfied in order by moving only its diagonal variable, so that the variables of
+// the previous rows are already fixed. The box constraint is applied last and prevails in case of
+// conflict.
+bool projectOnLowerTriangularConstraints(
+  const Eigen::MatrixXd & a, const Eigen::VectorXd & lb, const Eigen::VectorXd & ub,
+  const Eigen::VectorXd & lb_a, const Eigen::VectorXd & ub_a, Eigen::VectorXd & u)
+{
+  const Eigen::Index n = u.size();
+  if (a.rows() != n || a.cols() != n) {
+    return false;
+  }
+  for (Eigen::Index i = 0; i < n; ++i) {
+    if (a(i, i) != 1.0 || (a.row(i).tail(n - i - 1).array() != 0.0).any()) {
+      return false;
+    }
+    const double offset = a.row(i).head(i).dot(u.head(i));
+    u(i) = std::clamp(std::clamp(u(i), lb_a(i) - offset, ub_a(i) - offset), lb(i), ub(i));
+  }
+  return true;
+}
+}  // namespace
+
+QPSolverOSQP::QPSolverOSQP(
+  const rclcpp::Logger & logger, rclcpp::Clock::SharedPtr clock, const QPSolverOSQPParam & param)
+: param_{param}, logger_{logger}, clock_{clock}
+{
+}
+
+void QPSolverOSQP::setProblem(
+  const Eigen::MatrixXd & h_mat, const Eigen::MatrixXd & a, const std::vector<double> & f,
+  const std::vector<double> & lower_bound, const std::vector<double> & upper_bound)
 {
+  const bool is_same_size =
+    osqpsolver_ptr_ && p_csc_.m_col_idxs.size() == static_cast<size_t>(h_mat.cols() + 1);
+  toUpperTriangularCSC(h_mat, p_csc_);
+
+  CSC_Matrix a_csc;
+  toStackedConstraintCSC(a, a_csc);
+  const bool is_same_structure = is_same_size && hasSamePattern(a_csc, a_csc_);
+  a_csc_ = std::move(a_csc);
+
+  if (is_same_structure) {
+    osqpsolver_ptr_->updateCscP(p_csc_);
+    osqpsolver_ptr_->updateQ(f);
+    osqpsolver_ptr_->updateCscA(a_csc_);
+    osqpsolver_ptr_->updateBounds(lower_bound, upper_bound);
+    return;
+  }
+
+  constexpr double eps_abs = 1.0e-4;  // same as the default of OSQPInterface
+  osqpsolver_ptr_ = std::make_unique<autoware::osqp_interface::OSQPInterface>(
+    p_csc_, a_csc_, f, lower_bound, upper_bound, eps_abs);
+  has_prev_solution_ = false;
 }
+
+void QPSolverOSQP::setWarmStart()
+{
+  if (!param_.enable_warm_start || !has_prev_solution_) {
+    return;
+  }
+
+  // the input of each prediction step is a scalar, and the constraints consist of the blocks of
+  // the horizon length
+  const size_t n = prev_primal_.size();
+  if (n < 2 || prev_dual_.size() % n != 0) {
+    return;
+  }
+  shiftByOneStep(prev_primal_, n);
+  shiftByOneStep(prev_dual_, n);
+  osqpsolver_ptr_->setWarmStart(prev_primal_, prev_dual_);
+}
+
+void QPSolverOSQP::updateIterationLimit()
+{
+  int max_iter = param_.max_iter;
+  const int64_t prev_iter = osqpsolver_ptr_->getTakenIter();
+  const double prev_run_time_ms = osqpsolver_ptr_->getRunTime() * 1.0e3;
+  if (param_.time_limit_ms > 0.0 && has_prev_solution_ && prev_iter > 0 && prev_run_time_ms > 0) {
+    const double time_per_iter_ms = prev_run_time_ms / static_cast<double>(prev_iter);
+    const double iter_in_time_limit = std::floor(param_.time_limit_ms / time_per_iter_ms);
+    max_iter = static_cast<int>(std::clamp(iter_in_time_limit, 1.0, static_cast<double>(max_iter)));
+  }
+  osqpsolver_ptr_->updateMaxIter(max_iter);
+}
+
 bool QPSolverOSQP::solve(
   const Eigen::MatrixXd & h_mat, const Eigen::MatrixXd & f_vec, const Eigen::MatrixXd & a,
   const Eigen::VectorXd & lb, const Eigen::VectorXd & ub, const Eigen::VectorXd & lb_a,
   const Eigen::VectorXd & ub_a, Eigen::VectorXd & u)
 {
-  const Eigen::Index raw_a = a.rows();
-  const Eigen::Index col_a = a.cols();
   const Eigen::Index dim_u = ub.size();
-  Eigen::MatrixXd Identity = Eigen::MatrixXd::Identity(dim_u, dim_u);
+  is_fallback_used_ = false;
 
   // convert matrix to vector for osqpsolver
   std::vector<double> f(&f_vec(0), f_vec.data() + f_vec.cols() * f_vec.rows());
 
   std::vector<double> lower_bound;
   std::vector<double> upper_bound;
+  lower_bound.reserve(dim_u + a.rows());
+  upper_bound.reserve(dim_u + a.rows());
 
   for (int i = 0; i < dim_u; ++i) {
     lower_bound.push_back(lb(i));
     upper_bound.push_back(ub(i));
   }
 
-  for (int i = 0; i < col_a; ++i) {
+  for (int i = 0; i < a.rows(); ++i) {
     lower_bound.push_back(lb_a(i));
     upper_bound.push_back(ub_a(i));
   }
 
-  Eigen::MatrixXd osqpA = Eigen::MatrixXd(dim_u + col_a, raw_a);
-  osqpA << Identity, a;
-
   /* execute optimization */
-  auto result = osqpsolver_.optimize(h_mat, osqpA, f, lower_bound, upper_bound);
+  setProblem(h_mat, a, f, lower_bound, upper_bound);
+  setWarmStart();
+  updateIterationLimit();
+  auto result = osqpsolver_ptr_->optimize();
+
+  // The previous solution is kept for the warm start and the iteration limit of the next solve
+  const auto fallback = [&](const std::string & reason) {
+    if (!param_.enable_fallback) {
+      RCLCPP_WARN(logger_, "optimization failed : %s", reason.c_str());
+      return false;
+    }
+    if (
+      !fallback_solver_.solve(h_mat, f_vec, a, lb, ub, lb_a, ub_a, u) ||
+      !projectOnLowerTriangularConstraints(a, lb, ub, lb_a, ub_a, u)) {
+      RCLCPP_WARN(logger_, "optimization failed : %s, and the fallback failed", reason.c_str());
+      return false;
+    }
+    is_fallback_used_ = true;
+    RCLCPP_WARN_THROTTLE(
+      logger_, *clock_, 1000,
+      "optimization failed : %s. Use the unconstrained solution projected on the constraints "
+      "instead.",
+      reason.c_str());
+    return true;
+  };
 
   std::vector<double> U_osqp = result.primal_solution;
   u = Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, 1>>(
@@ -61,16 +228,18 @@ bool QPSolverOSQP::solve(
 
   const int status_val = result.solution_status;
   if (status_val != 1) {
-    RCLCPP_WARN(logger_, "optimization failed : %s", osqpsolver_.getStatusMessage().c_str());
-    return false;
+    return fallback(osqpsolver_ptr_->getStatusMessage());
   }
   const auto has_nan =
     std::any_of(U_osqp.begin(), U_osqp.end(), [](const auto v) { return std::isnan(v); });
   if (has_nan) {
-    RCLCPP_WARN(logger_, "optimization failed: result contains NaN values");
-    return false;
+    return fallback("result contains NaN values");
   }
 
+  prev_primal_ = std::move(U_osqp);
+  prev_dual_ = result.dual_solution;
+  has_prev_solution_ = true;
+
   // polish status: successful (1), unperformed (0), (-1) unsuccessful
   int status_polish = result.polish_status;
   if (status_polish == -1 || status_polish == 0) {
@@ -54,10 +54,11 @@ void DynamicsBicycleModel::calculateDiscreteMatrix(
   a_d(3, 2) = (m_lf * m_cf - m_lr * m_cr) / m_iz;
   a_d(3, 3) = -(m_lf * m_lf * m_cf + m_lr * m_lr * m_cr) / (m_iz * vel);
 
-  Eigen::MatrixXd I = Eigen::MatrixXd::Identity(m_dim_x, m_dim_x);
-  Eigen::MatrixXd a_d_inverse = (I - dt * 0.5 * a_d).inverse();
+  const Eigen::Matrix4d a_c = a_d;
+  const Eigen::Matrix4d I = Eigen::Matrix4d::Identity();
+  const Eigen::Matrix4d a_d_inverse = (I - dt * 0.5 * a_c).inverse();
 
-  a_d = a_d_inverse * (I + dt * 0.5 * a_d);  // bilinear discretization
+  a_d = a_d_inverse * (I + dt * 0.5 * a_c);  // bilinear discretization
 
   b_d = Eigen::MatrixXd::Zero(m_dim_x, m_dim_u);
   b_d(0, 0) = 0.0;
@@ -71,8 +72,10 @@ void DynamicsBicycleModel::calculateDiscreteMatrix(
   w_d(2, 0) = 0.0;
   w_d(3, 0) = -(m_lf * m_lf * m_cf + m_lr * m_lr * m_cr) / (m_iz * vel);
 
-  b_d = (a_d_inverse * dt) * b_d;
-  w_d = (a_d_inverse * dt * m_curvature * vel) * w_d;
+  const Eigen::Vector4d b_c = b_d;
+  const Eigen::Vector4d w_c = w_d;
+  b_d = (a_d_inverse * dt) * b_c;
+  w_d = (a_d_inverse * dt * m_curvature * vel) * w_c;
 
   c_d = Eigen::MatrixXd::Zero(m_dim_y, m_dim_x);
   c_d(0, 0) = 1.0;
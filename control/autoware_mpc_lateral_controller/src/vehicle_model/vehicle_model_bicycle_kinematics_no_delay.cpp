@@ -48,11 +48,15 @@ void KinematicsBicycleModelNoDelay::calculateDiscreteMatrix(
 
   // bilinear discretization for ZOH system
   // no discretization is needed for Cd
-  Eigen::MatrixXd I = Eigen::MatrixXd::Identity(m_dim_x, m_dim_x);
-  const Eigen::MatrixXd i_dt2a_inv = (I - dt * 0.5 * a_d).inverse();
-  a_d = i_dt2a_inv * (I + dt * 0.5 * a_d);
-  b_d = i_dt2a_inv * b_d * dt;
-  w_d = i_dt2a_inv * w_d * dt;
+  using MatrixX = Eigen::Matrix<double, 2, 2>;
+  const MatrixX a_c = a_d;
+  const MatrixX I = MatrixX::Identity();
+  const MatrixX i_dt2a_inv = (I - dt * 0.5 * a_c).inverse();
+  a_d = i_dt2a_inv * (I + dt * 0.5 * a_c);
+  const Eigen::Vector2d b_c = b_d;
+  const Eigen::Vector2d w_c = w_d;
+  b_d = i_dt2a_inv * b_c * dt;
+  w_d = i_dt2a_inv * w_c * dt;
 }
 
 void KinematicsBicycleModelNoDelay::calculateReferenceInput(Eigen::MatrixXd & u_ref)
@@ -323,6 +323,93 @@ TEST_F(MPCTest, OsqpCalculateRightTurn)
   EXPECT_LT(ctrl_cmd_horizon.controls.front().steering_tire_rotation_rate, 0.0f);
 }
 
+TEST_F(MPCTest, OsqpMultiSolveWithWarmStart)
+{
+  auto node = rclcpp::Node("mpc_test_node", rclcpp::NodeOptions{});
+  auto mpc = std::make_unique<MPC>(node);
+  initializeMPC(*mpc);
+  const auto current_kinematics =
+    makeOdometry(dummy_right_turn_trajectory.points.front().pose, 0.0);
+  mpc->setReferenceTrajectory(dummy_right_turn_trajectory, trajectory_param, current_kinematics);
+
+  std::shared_ptr<VehicleModelInterface> vehicle_model_ptr =
+    std::make_shared<KinematicsBicycleModel>(wheelbase, steer_limit, steer_tau);
+  mpc->setVehicleModel(vehicle_model_ptr);
+
+  QPSolverOSQPParam osqp_param;
+  osqp_param.enable_warm_start = true;
+  osqp_param.enable_fallback = true;
+  std::shared_ptr<QPSolverInterface> qpsolver_ptr =
+    std::make_shared<QPSolverOSQP>(logger, node.get_clock(), osqp_param);
+  mpc->setQPSolver(qpsolver_ptr);
+
+  // The second and later problems reuse the workspace and start from the previous solution
+  Lateral ctrl_cmd;
+  Trajectory pred_traj;
+  Float32MultiArrayStamped diag;
+  LateralHorizon ctrl_cmd_horizon;
+  const auto odom = makeOdometry(pose_zero, default_velocity);
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_TRUE(
+      mpc->calculateMPC(neutral_steer, odom, ctrl_cmd, pred_traj, diag, ctrl_cmd_horizon).result);
+    EXPECT_LT(ctrl_cmd.steering_tire_angle, 0.0f);
+    EXPECT_FALSE(qpsolver_ptr->isFallbackUsed());
+    ASSERT_GE(diag.data.size(), size_t(29));
+    EXPECT_GE(diag.data.at(21), 0.0f);
+    EXPECT_EQ(diag.data.at(22), 0.0f);
+  }
+}
+
+TEST_F(MPCTest, OsqpFallbackRespectsSteerRateLimit)
+{
+  auto node = rclcpp::Node("mpc_test_node", rclcpp::NodeOptions{});
+
+  // One iteration is not enough for osqp to converge, so the fallback is used
+  QPSolverOSQPParam osqp_param;
+  osqp_param.max_iter = 1;
+  osqp_param.enable_fallback = true;
+  QPSolverOSQP qpsolver(logger, node.get_clock(), osqp_param);
+
+  // The unconstrained solution alternates between -1 and 1, beyond the steering rate limits
+  constexpr int n = 10;
+  const Eigen::MatrixXd h_mat = Eigen::MatrixXd::Identity(n, n);
+  Eigen::MatrixXd f_vec(n, 1);
+  for (int i = 0; i < n; ++i) {
+    f_vec(i, 0) = (i % 2 == 0) ? 1.0 : -1.0;
+  }
+  Eigen::MatrixXd a = Eigen::MatrixXd::Identity(n, n);
+  for (int i = 1; i < n; ++i) {
+    a(i, i - 1) = -1.0;
+  }
+  const Eigen::VectorXd lb = Eigen::VectorXd::Constant(n, -0.5);
+  const Eigen::VectorXd ub = Eigen::VectorXd::Constant(n, 0.5);
+  Eigen::VectorXd lb_a = Eigen::VectorXd::Constant(n, -0.1);
+  Eigen::VectorXd ub_a = Eigen::VectorXd::Constant(n, 0.1);
+  const double prev_steer = 0.2;
+  lb_a(0) = prev_steer - 0.05;
+  ub_a(0) = prev_steer + 0.05;
+
+  Eigen::VectorXd u;
+  ASSERT_TRUE(qpsolver.solve(h_mat, f_vec, a, lb, ub, lb_a, ub_a, u));
+  ASSERT_TRUE(qpsolver.isFallbackUsed());
+  ASSERT_EQ(u.size(), n);
+  constexpr double eps = 1e-9;
+  const Eigen::VectorXd a_u = a * u;
+  for (int i = 0; i < n; ++i) {
+    EXPECT_GE(u(i), lb(i) - eps);
+    EXPECT_LE(u(i), ub(i) + eps);
+    EXPECT_GE(a_u(i), lb_a(i) - eps);
+    EXPECT_LE(a_u(i), ub_a(i) + eps);
+  }
+
+  // The fallback is disabled by default
+  QPSolverOSQPParam default_param;
+  default_param.max_iter = 1;
+  QPSolverOSQP qpsolver_without_fallback(logger, node.get_clock(), default_param);
+  EXPECT_FALSE(qpsolver_without_fallback.solve(h_mat, f_vec, a, lb, ub, lb_a, ub_a, u));
+  EXPECT_FALSE(qpsolver_without_fallback.isFallbackUsed());
+}
+
 TEST_F(MPCTest, KinematicsNoDelayCalculate)
 {
   auto node = rclcpp::Node("mpc_test_node", rclcpp::NodeOptions{});
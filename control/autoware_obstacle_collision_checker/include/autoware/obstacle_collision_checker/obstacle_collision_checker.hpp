@@ -65,6 +65,9 @@ struct Output
   std::vector<LinearRing2d> vehicle_passing_areas;
 };
 
+//! obstacle points grouped by the index of their nearest trajectory point
+using TrajectoryIndexedPointCloud = std::vector<pcl::PointCloud<pcl::PointXYZ>>;
+
 Output check_for_collisions(const Input & input);
 
 //! This function assumes the input trajectory is sampled dense enough
@@ -87,6 +90,13 @@ bool will_collide(
   const pcl::PointCloud<pcl::PointXYZ> & obstacle_pointcloud,
   const std::vector<LinearRing2d> & vehicle_footprints);
 
+//! Only the points near each passing area are checked, the passing area i being between the
+//! trajectory points i and i + 1
+bool will_collide(
+  const TrajectoryIndexedPointCloud & obstacle_pointcloud,
+  const autoware_planning_msgs::msg::Trajectory & trajectory,
+  const std::vector<LinearRing2d> & vehicle_passing_areas);
+
 bool has_collision(
   const pcl::PointCloud<pcl::PointXYZ> & obstacle_pointcloud,
   const LinearRing2d & vehicle_footprint);
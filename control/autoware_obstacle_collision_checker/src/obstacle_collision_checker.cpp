@@ -14,54 +14,151 @@
 
 #include "autoware/obstacle_collision_checker/obstacle_collision_checker.hpp"
 
+#include <autoware/boundary_departure_checker/footprint_sweep.hpp>
 #include <autoware_utils/geometry/geometry.hpp>
 #include <autoware_utils/math/normalization.hpp>
 #include <autoware_utils/math/unit_conversion.hpp>
 #include <autoware_utils/system/stop_watch.hpp>
-#include <pcl_ros/transforms.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <tf2_eigen/tf2_eigen.hpp>
 
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
 #include <boost/geometry.hpp>
 
 #include <pcl_conversions/pcl_conversions.h>
 #include <tf2/utils.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace
 {
-pcl::PointCloud<pcl::PointXYZ> get_transformed_point_cloud(
-  const sensor_msgs::msg::PointCloud2 & pointcloud_msg,
-  const geometry_msgs::msg::Transform & transform)
+/**
+ * @brief uniform grid of the trajectory points, to find the trajectory points near a position
+ * without iterating over the whole trajectory
+ */
+class TrajectoryPointGrid
 {
-  const Eigen::Matrix4f transform_matrix = tf2::transformToEigen(transform).matrix().cast<float>();
+public:
+  TrajectoryPointGrid(
+    const autoware_planning_msgs::msg::Trajectory & trajectory, const double cell_size)
+  : cell_size_(cell_size)
+  {
+    positions_.reserve(trajectory.points.size());
+    for (size_t i = 0; i < trajectory.points.size(); ++i) {
+      const auto & p = trajectory.points[i].pose.position;
+      positions_.emplace_back(p.x, p.y);
+      cells_[to_key(to_cell(p.x), to_cell(p.y))].push_back(i);
+    }
+  }
+
+  /**
+   * @brief call f(index, distance) for the trajectory points closer than radius to (x, y)
+   * @return true if f returned true, which stops the search
+   */
+  template <typename F>
+  bool for_each_within(const double x, const double y, const double radius, F && f) const
+  {
+    const auto visit = [&](const size_t idx) {
+      const double distance = std::hypot(positions_[idx].first - x, positions_[idx].second - y);
+      return distance < radius && f(idx, distance);
+    };
+
+    const auto range = static_cast<int64_t>(std::ceil(radius / cell_size_));
+    // a large radius would visit more cells than there are trajectory points
+    if ((2 * range + 1) * (2 * range + 1) > static_cast<int64_t>(positions_.size())) {
+      for (size_t idx = 0; idx < positions_.size(); ++idx) {
+        if (visit(idx)) return true;
+      }
+      return false;
+    }
+
+    const auto cell_x = to_cell(x);
+    const auto cell_y = to_cell(y);
+    for (auto cx = cell_x - range; cx <= cell_x + range; ++cx) {
+      for (auto cy = cell_y - range; cy <= cell_y + range; ++cy) {
+        const auto itr = cells_.find(to_key(cx, cy));
+        if (itr == cells_.end()) continue;
+        for (const auto idx : itr->second) {
+          if (visit(idx)) return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  std::optional<size_t> find_nearest(const double x, const double y, const double radius) const
+  {
+    std::optional<size_t> nearest_idx;
+    double min_distance = std::numeric_limits<double>::max();
+    for_each_within(x, y, radius, [&](const size_t idx, const double distance) {
+      if (distance < min_distance || (distance == min_distance && idx < *nearest_idx)) {
+        min_distance = distance;
+        nearest_idx = idx;
+      }
+      return false;
+    });
+    return nearest_idx;
+  }
 
-  sensor_msgs::msg::PointCloud2 transformed_msg;
-  pcl_ros::transformPointCloud(transform_matrix, pointcloud_msg, transformed_msg);
+private:
+  int64_t to_cell(const double v) const { return static_cast<int64_t>(std::floor(v / cell_size_)); }
 
-  pcl::PointCloud<pcl::PointXYZ> transformed_pointcloud;
-  pcl::fromROSMsg(transformed_msg, transformed_pointcloud);
+  static uint64_t to_key(const int64_t cell_x, const int64_t cell_y)
+  {
+    return (static_cast<uint64_t>(cell_x) << 32) ^ static_cast<uint32_t>(cell_y);
+  }
+
+  double cell_size_;
+  std::vector<std::pair<double, double>> positions_;
+  std::unordered_map<uint64_t, std::vector<size_t>> cells_;
+};
 
-  return transformed_pointcloud;
+//! call f(point) for each point of the message transformed, without copying the cloud
+template <typename F>
+void for_each_transformed_point(
+  const sensor_msgs::msg::PointCloud2 & pointcloud_msg,
+  const geometry_msgs::msg::Transform & transform, F && f)
+{
+  if (pointcloud_msg.data.empty()) return;
+  const Eigen::Matrix4f transform_matrix = tf2::transformToEigen(transform).matrix().cast<float>();
+
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(pointcloud_msg, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(pointcloud_msg, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(pointcloud_msg, "z");
+  for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    const Eigen::Vector4f p = transform_matrix * Eigen::Vector4f(*iter_x, *iter_y, *iter_z, 1.0f);
+    f(pcl::PointXYZ(p.x(), p.y(), p.z()));
+  }
 }
 
-pcl::PointCloud<pcl::PointXYZ> filter_point_cloud_by_trajectory(
-  const pcl::PointCloud<pcl::PointXYZ> & pointcloud,
+//! transform the points and group them by their nearest trajectory point in a single pass, the
+//! points farther than radius from the trajectory are removed
+autoware::obstacle_collision_checker::TrajectoryIndexedPointCloud
+get_trajectory_indexed_point_cloud(
+  const sensor_msgs::msg::PointCloud2 & pointcloud_msg,
+  const geometry_msgs::msg::Transform & transform,
   const autoware_planning_msgs::msg::Trajectory & trajectory, const double radius)
 {
-  pcl::PointCloud<pcl::PointXYZ> filtered_pointcloud;
-  for (const auto & point : pointcloud.points) {
-    for (const auto & trajectory_point : trajectory.points) {
-      const double dx = trajectory_point.pose.position.x - point.x;
-      const double dy = trajectory_point.pose.position.y - point.y;
-      if (std::hypot(dx, dy) < radius) {
-        filtered_pointcloud.points.push_back(point);
-        break;
-      }
+  autoware::obstacle_collision_checker::TrajectoryIndexedPointCloud indexed_pointcloud(
+    trajectory.points.size());
+  if (radius <= 0.0) return indexed_pointcloud;
+
+  const TrajectoryPointGrid trajectory_grid(trajectory, radius);
+  for_each_transformed_point(pointcloud_msg, transform, [&](const pcl::PointXYZ & p) {
+    const auto nearest_idx = trajectory_grid.find_nearest(p.x, p.y, radius);
+    if (nearest_idx) {
+      indexed_pointcloud[*nearest_idx].push_back(p);
     }
-  }
-  return filtered_pointcloud;
+  });
+  return indexed_pointcloud;
 }
 
 double calc_braking_distance(
@@ -92,11 +189,11 @@ Output check_for_collisions(const Input & input)
     braking_distance);
   output.processing_time_map["resampleTrajectory"] = stop_watch.toc(true);
 
-  // resample pointcloud
-  const auto obstacle_pointcloud =
-    get_transformed_point_cloud(*input.obstacle_pointcloud, input.obstacle_transform->transform);
-  const auto filtered_obstacle_pointcloud = filter_point_cloud_by_trajectory(
-    obstacle_pointcloud, output.resampled_trajectory, input.param.search_radius);
+  // transform and filter pointcloud
+  const auto obstacle_pointcloud = get_trajectory_indexed_point_cloud(
+    *input.obstacle_pointcloud, input.obstacle_transform->transform, output.resampled_trajectory,
+    input.param.search_radius);
+  output.processing_time_map["filterPointCloud"] = stop_watch.toc(true);
 
   output.vehicle_footprints =
     create_vehicle_footprints(output.resampled_trajectory, input.param, input.vehicle_info);
@@ -105,7 +202,8 @@ Output check_for_collisions(const Input & input)
   output.vehicle_passing_areas = create_vehicle_passing_areas(output.vehicle_footprints);
   output.processing_time_map["createVehiclePassingAreas"] = stop_watch.toc(true);
 
-  output.will_collide = will_collide(filtered_obstacle_pointcloud, output.vehicle_passing_areas);
+  output.will_collide =
+    will_collide(obstacle_pointcloud, output.resampled_trajectory, output.vehicle_passing_areas);
   output.processing_time_map["willCollide"] = stop_watch.toc(true);
 
   return output;
@@ -179,17 +277,17 @@ std::vector<LinearRing2d> create_vehicle_footprints(
   const autoware_planning_msgs::msg::Trajectory & trajectory, const Param & param,
   const autoware::vehicle_info_utils::VehicleInfo & vehicle_info)
 {
-  // Create vehicle footprint in base_link coordinate
-  const auto local_vehicle_footprint = vehicle_info.createFootprint(param.footprint_margin);
+  using autoware::boundary_departure_checker::FootprintSweep;
 
-  // Create vehicle footprint on each TrajectoryPoint
-  std::vector<LinearRing2d> vehicle_footprints;
+  std::vector<geometry_msgs::msg::Pose> poses;
+  poses.reserve(trajectory.points.size());
   for (const auto & p : trajectory.points) {
-    vehicle_footprints.push_back(autoware_utils::transform_vector<autoware_utils::LinearRing2d>(
-      local_vehicle_footprint, autoware_utils::pose2transform(p.pose)));
+    poses.push_back(p.pose);
   }
 
-  return vehicle_footprints;
+  const auto margin = param.footprint_margin;
+  const FootprintSweep footprint_sweep(poses, vehicle_info, {{margin, margin}});
+  return footprint_sweep.getFootprints(0);
 }
 
 std::vector<LinearRing2d> create_vehicle_passing_areas(
@@ -236,6 +334,60 @@ bool will_collide(
   return false;
 }
 
+bool will_collide(
+  const TrajectoryIndexedPointCloud & obstacle_pointcloud,
+  const autoware_planning_msgs::msg::Trajectory & trajectory,
+  const std::vector<LinearRing2d> & vehicle_passing_areas)
+{
+  if (vehicle_passing_areas.size() < 2) return false;
+
+  // A point inside the passing area i is at most at a distance r from the trajectory point i, r
+  // being the distance to the farthest vertex of the area. Its nearest trajectory point is then at
+  // most at 2 * r from the trajectory point i, so only these buckets need to be checked.
+  std::vector<double> area_radii(vehicle_passing_areas.size(), 0.0);
+  for (size_t i = 1; i < vehicle_passing_areas.size(); ++i) {
+    const auto & center = trajectory.points.at(i).pose.position;
+    for (const auto & p : vehicle_passing_areas.at(i)) {
+      area_radii.at(i) = std::max(area_radii.at(i), std::hypot(p.x() - center.x, p.y() - center.y));
+    }
+  }
+  const auto max_area_radius = *std::max_element(area_radii.begin(), area_radii.end());
+  if (max_area_radius <= 0.0) return false;
+  const TrajectoryPointGrid trajectory_grid(trajectory, max_area_radius);
+
+  constexpr double epsilon = 1e-6;
+  for (size_t i = 1; i < vehicle_passing_areas.size(); i++) {
+    // skip first footprint because surround obstacle checker handle it
+    const auto & vehicle_passing_area = vehicle_passing_areas.at(i);
+    autoware_utils::Box2d envelope;
+    boost::geometry::envelope(vehicle_passing_area, envelope);
+
+    const auto & center = trajectory.points.at(i).pose.position;
+    const bool is_colliding = trajectory_grid.for_each_within(
+      center.x, center.y, 2.0 * area_radii.at(i) + epsilon, [&](const size_t idx, const double) {
+        for (const auto & point : obstacle_pointcloud.at(idx)) {
+          const autoware_utils::Point2d p{point.x, point.y};
+          if (
+            !boost::geometry::covered_by(p, envelope) ||
+            !boost::geometry::within(p, vehicle_passing_area)) {
+            continue;
+          }
+          RCLCPP_WARN(
+            rclcpp::get_logger("obstacle_collision_checker"), "Collide to Point x: %f y: %f",
+            point.x, point.y);
+          return true;
+        }
+        return false;
+      });
+    if (is_colliding) {
+      RCLCPP_WARN(rclcpp::get_logger("obstacle_collision_checker"), "willCollide");
+      return true;
+    }
+  }
+
+  return false;
+}
+
 bool has_collision(
   const pcl::PointCloud<pcl::PointXYZ> & obstacle_pointcloud,
   const LinearRing2d & vehicle_footprint)
@@ -51,6 +51,27 @@ pcl::PointCloud<pcl::PointXYZ> pcl_pointcloud(const std::vector<std::pair<float,
   return pcl;
 }
 
+// all the points of the indexed point cloud, in the order of the trajectory points
+pcl::PointCloud<pcl::PointXYZ> flatten(
+  const autoware::obstacle_collision_checker::TrajectoryIndexedPointCloud & indexed_pcd)
+{
+  pcl::PointCloud<pcl::PointXYZ> pcd;
+  for (const auto & points : indexed_pcd) {
+    pcd += points;
+  }
+  return pcd;
+}
+
+// transformed points, grouped in the bucket of a trajectory with a single point
+pcl::PointCloud<pcl::PointXYZ> get_transformed_point_cloud(
+  const sensor_msgs::msg::PointCloud2 & pcd_msg, const geometry_msgs::msg::Transform & transform)
+{
+  autoware_planning_msgs::msg::Trajectory trajectory;
+  trajectory.points.resize(1);
+  constexpr double radius = 100.0;
+  return flatten(get_trajectory_indexed_point_cloud(pcd_msg, transform, trajectory, radius));
+}
+
 bool point_in_pcl_pointcloud(const pcl::PointXYZ & pt, const pcl::PointCloud<pcl::PointXYZ> & pcd)
 {
   for (const auto & p : pcd) {
@@ -62,7 +83,7 @@ bool point_in_pcl_pointcloud(const pcl::PointXYZ & pt, const pcl::PointCloud<pcl
 }
 }  // namespace
 
-TEST(test_obstacle_collision_checker, filterPointCloudByTrajectory)
+TEST(test_obstacle_collision_checker, getTrajectoryIndexedPointCloud)
 {
   pcl::PointCloud<pcl::PointXYZ> pcl;
   autoware_planning_msgs::msg::Trajectory trajectory;
@@ -76,18 +97,25 @@ TEST(test_obstacle_collision_checker, filterPointCloudByTrajectory)
     trajectory.points.push_back(traj_point);
     pcl.push_back(pcl_point);
   }
+  sensor_msgs::msg::PointCloud2 pcd_msg;
+  pcl::toROSMsg(pcl, pcd_msg);
+  const geometry_msgs::msg::Transform transform;
   // radius < 1: all points are filtered
   for (auto radius = 0.0; radius <= 0.99; radius += 0.1) {
-    const auto filtered_pcl = filter_point_cloud_by_trajectory(pcl, trajectory, radius);
-    EXPECT_EQ(filtered_pcl.size(), 0ul);
+    const auto indexed_pcl =
+      get_trajectory_indexed_point_cloud(pcd_msg, transform, trajectory, radius);
+    ASSERT_EQ(indexed_pcl.size(), trajectory.points.size());
+    EXPECT_EQ(flatten(indexed_pcl).size(), 0ul);
   }
-  // radius >= 1.0: all points are kept
+  // radius >= 1.0: all points are kept, each one with its nearest trajectory point
   for (auto radius = 1.0; radius < 10.0; radius += 0.1) {
-    const auto filtered_pcl = filter_point_cloud_by_trajectory(pcl, trajectory, radius);
-    ASSERT_EQ(pcl.size(), filtered_pcl.size());
+    const auto indexed_pcl =
+      get_trajectory_indexed_point_cloud(pcd_msg, transform, trajectory, radius);
+    ASSERT_EQ(indexed_pcl.size(), trajectory.points.size());
     for (size_t i = 0; i < pcl.size(); ++i) {
-      EXPECT_EQ(pcl[i].x, filtered_pcl[i].x);
-      EXPECT_EQ(pcl[i].y, filtered_pcl[i].y);
+      ASSERT_EQ(indexed_pcl[i].size(), 1ul);
+      EXPECT_EQ(pcl[i].x, indexed_pcl[i][0].x);
+      EXPECT_EQ(pcl[i].y, indexed_pcl[i][0].y);
     }
   }
 }
@@ -253,3 +281,41 @@ TEST(test_obstacle_collision_checker, check_for_collisions)
     EXPECT_FALSE(output.will_collide);
   }
 }
+
+TEST(test_obstacle_collision_checker, willCollideWithTrajectoryIndexedPointCloud)
+{
+  autoware::obstacle_collision_checker::Param param;
+  param.footprint_margin = 0.0;
+  autoware::vehicle_info_utils::VehicleInfo vehicle_info;
+  // 2mx2m footprint
+  vehicle_info.front_overhang_m = 1.0;
+  vehicle_info.wheel_base_m = 0.0;
+  vehicle_info.rear_overhang_m = 1.0;
+  vehicle_info.left_overhang_m = 1.0;
+  vehicle_info.right_overhang_m = 1.0;
+  autoware_planning_msgs::msg::Trajectory trajectory;
+  autoware_planning_msgs::msg::TrajectoryPoint point;
+  for (auto x = 0.0; x < 6.0; x += 0.5) {
+    point.pose.position.x = x;
+    point.pose.position.y = 0.1 * x * x;
+    trajectory.points.push_back(point);
+  }
+  using autoware::obstacle_collision_checker::create_vehicle_footprints;
+  using autoware::obstacle_collision_checker::create_vehicle_passing_areas;
+  const auto passing_areas =
+    create_vehicle_passing_areas(create_vehicle_footprints(trajectory, param, vehicle_info));
+
+  // same result as checking all the points against all the passing areas
+  constexpr double search_radius = 5.0;
+  geometry_msgs::msg::Transform transform;
+  for (auto y = -2.0; y < 6.0; y += 0.25) {
+    sensor_msgs::msg::PointCloud2 pcd_msg;
+    pcl::toROSMsg(pcl_pointcloud({{3.0, y}, {8.0, y}}), pcd_msg);
+    const auto indexed_pcd =
+      get_trajectory_indexed_point_cloud(pcd_msg, transform, trajectory, search_radius);
+    ASSERT_EQ(indexed_pcd.size(), trajectory.points.size());
+    EXPECT_EQ(
+      autoware::obstacle_collision_checker::will_collide(indexed_pcd, trajectory, passing_areas),
+      autoware::obstacle_collision_checker::will_collide(flatten(indexed_pcd), passing_areas));
+  }
+}
@@ -0,0 +1,103 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "nearest_index_tracker.hpp"
+
+#include <autoware/motion_utils/trajectory/trajectory.hpp>
+#include <autoware_utils/geometry/geometry.hpp>
+#include <autoware_utils/geometry/pose_deviation.hpp>
+#include <autoware_utils/math/normalization.hpp>
+
+#include <tf2/utils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace autoware::operation_mode_transition_manager
+{
+
+using autoware_utils::calc_squared_distance2d;
+
+std::optional<size_t> NearestIndexTracker::find(
+  const std::vector<TrajectoryPoint> & points, const geometry_msgs::msg::Pose & pose)
+{
+  if (points.empty()) {
+    prev_index_.reset();
+    return std::nullopt;
+  }
+
+  if (prev_index_) {
+    size_t idx = std::min(*prev_index_, points.size() - 1);
+    double squared_dist = calc_squared_distance2d(points.at(idx), pose);
+    const auto is_closer = [&](const size_t next) {
+      const double next_squared_dist = calc_squared_distance2d(points.at(next), pose);
+      if (next_squared_dist >= squared_dist) {
+        return false;
+      }
+      idx = next;
+      squared_dist = next_squared_dist;
+      return true;
+    };
+    // descend the distance forward, then backward
+    while (idx + 1 < points.size() && is_closer(idx + 1)) {
+    }
+    while (idx > 0 && is_closer(idx - 1)) {
+    }
+
+    const double yaw_deviation = autoware_utils::calc_yaw_deviation(points.at(idx).pose, pose);
+    if (squared_dist <= max_dist_ * max_dist_ && std::abs(yaw_deviation) <= max_yaw_) {
+      prev_index_ = idx;
+      return idx;
+    }
+  }
+
+  prev_index_ = autoware::motion_utils::findNearestIndex(points, pose, max_dist_, max_yaw_);
+  return prev_index_;
+}
+
+TrajectoryDeviation calcDeviation(
+  const std::vector<TrajectoryPoint> & points, const geometry_msgs::msg::Pose & pose,
+  const size_t nearest_idx)
+{
+  constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+  if (points.size() < 2 || nearest_idx >= points.size()) {
+    return {nan, nan};
+  }
+
+  size_t seg_idx = nearest_idx;
+  if (nearest_idx == points.size() - 1) {
+    seg_idx = points.size() - 2;
+  } else if (
+    nearest_idx > 0 && autoware::motion_utils::calcLongitudinalOffsetToSegment(
+                         points, nearest_idx, pose.position) <= 0.0) {
+    seg_idx = nearest_idx - 1;
+  }
+
+  // Degenerated segments are skipped by the functions on the whole trajectory
+  if (calc_squared_distance2d(points.at(seg_idx), points.at(seg_idx + 1)) < 1e-12) {
+    return {
+      autoware::motion_utils::calcLateralOffset(points, pose.position),
+      autoware::motion_utils::calcYawDeviation(points, pose)};
+  }
+
+  const double lateral = autoware::motion_utils::calcLateralOffset(points, pose.position, seg_idx);
+  const double path_yaw = autoware_utils::calc_azimuth_angle(
+    points.at(seg_idx).pose.position, points.at(seg_idx + 1).pose.position);
+  const double yaw = autoware_utils::normalize_radian(tf2::getYaw(pose.orientation) - path_yaw);
+  return {lateral, yaw};
+}
+
+}  // namespace autoware::operation_mode_transition_manager
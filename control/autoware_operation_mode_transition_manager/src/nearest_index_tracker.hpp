@@ -0,0 +1,76 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NEAREST_INDEX_TRACKER_HPP_
+#define NEAREST_INDEX_TRACKER_HPP_
+
+#include <autoware_planning_msgs/msg/trajectory_point.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace autoware::operation_mode_transition_manager
+{
+
+using autoware_planning_msgs::msg::TrajectoryPoint;
+
+/**
+ * @brief Nearest trajectory point search, starting from the point found at the previous call.
+ * @details The search descends the distance to the pose from the previous index, which is the
+ * nearest point as long as the trajectory does not overlap itself around the ego. If the point
+ * found does not satisfy the distance and yaw constraints, the whole trajectory is searched.
+ */
+class NearestIndexTracker
+{
+public:
+  NearestIndexTracker(const double max_dist, const double max_yaw)
+  : max_dist_(max_dist), max_yaw_(max_yaw)
+  {
+  }
+
+  /**
+   * @brief find the nearest point satisfying the distance and yaw constraints
+   * @return index of the point, or std::nullopt if no point satisfies the constraints
+   */
+  std::optional<size_t> find(
+    const std::vector<TrajectoryPoint> & points, const geometry_msgs::msg::Pose & pose);
+
+  void reset() { prev_index_.reset(); }
+
+private:
+  double max_dist_;  // [m]
+  double max_yaw_;   // [rad]
+  std::optional<size_t> prev_index_;
+};
+
+struct TrajectoryDeviation
+{
+  double lateral;  // [m] signed lateral offset, NaN if it cannot be calculated
+  double yaw;      // [rad] signed yaw deviation, NaN if it cannot be calculated
+};
+
+/**
+ * @brief calculate the deviation of the pose from the segment around the nearest point
+ * @details the segment is chosen as in autoware::motion_utils::findNearestSegmentIndex, but from
+ * the given nearest point instead of a search of the whole trajectory
+ */
+TrajectoryDeviation calcDeviation(
+  const std::vector<TrajectoryPoint> & points, const geometry_msgs::msg::Pose & pose,
+  const size_t nearest_idx);
+
+}  // namespace autoware::operation_mode_transition_manager
+
+#endif  // NEAREST_INDEX_TRACKER_HPP_
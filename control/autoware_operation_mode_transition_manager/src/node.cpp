@@ -258,7 +258,7 @@ InputData OperationModeTransitionManager::subscribeData()
     if (input_timeout_ < (now() - kinematics_ptr->header.stamp).seconds()) {
       RCLCPP_WARN_THROTTLE(get_logger(), *get_clock(), 3000, "Subscribed kinematics is timed out.");
     } else {
-      input_data.kinematics = *kinematics_ptr;
+      input_data.kinematics = kinematics_ptr;
     }
   }
 
@@ -267,7 +267,7 @@ InputData OperationModeTransitionManager::subscribeData()
     if (input_timeout_ < (now() - trajectory_ptr->header.stamp).seconds()) {
       RCLCPP_WARN_THROTTLE(get_logger(), *get_clock(), 3000, "Subscribed trajectory is timed out.");
     } else {
-      input_data.trajectory = *trajectory_ptr;
+      input_data.trajectory = trajectory_ptr;
     }
   }
 
@@ -278,7 +278,7 @@ InputData OperationModeTransitionManager::subscribeData()
         get_logger(), *get_clock(), 3000,
         "Subscribed trajectory_follower_control_cmd is timed out.");
     } else {
-      input_data.trajectory_follower_control_cmd = *trajectory_follower_control_cmd_ptr;
+      input_data.trajectory_follower_control_cmd = trajectory_follower_control_cmd_ptr;
     }
   }
 
@@ -288,7 +288,7 @@ InputData OperationModeTransitionManager::subscribeData()
       RCLCPP_WARN_THROTTLE(
         get_logger(), *get_clock(), 3000, "Subscribed control_cmd is timed out.");
     } else {
-      input_data.control_cmd = *control_cmd_ptr;
+      input_data.control_cmd = control_cmd_ptr;
     }
   }
 
@@ -16,7 +16,6 @@
 
 #include "util.hpp"
 
-#include <autoware/motion_utils/trajectory/trajectory.hpp>
 #include <autoware_utils/geometry/geometry.hpp>
 #include <autoware_utils/geometry/pose_deviation.hpp>
 
@@ -28,7 +27,6 @@
 namespace autoware::operation_mode_transition_manager
 {
 
-using autoware::motion_utils::findNearestIndex;
 using autoware_utils::calc_distance2d;
 using autoware_utils::calc_yaw_deviation;
 
@@ -43,6 +41,8 @@ AutonomousMode::AutonomousMode(rclcpp::Node * node)
     node->declare_parameter<double>("nearest_dist_deviation_threshold");
   nearest_yaw_deviation_threshold_ =
     node->declare_parameter<double>("nearest_yaw_deviation_threshold");
+  nearest_index_tracker_.emplace(
+    nearest_dist_deviation_threshold_, nearest_yaw_deviation_threshold_);
 
   // params for mode change available
   {
@@ -84,8 +84,8 @@ bool AutonomousMode::isModeChangeCompleted(const InputData & input_data)
 {
   if (!input_data.kinematics) return false;
   if (!input_data.trajectory) return false;
-  const auto & kinematics = input_data.kinematics.value();
-  const auto & trajectory = input_data.trajectory.value();
+  const auto & kinematics = *input_data.kinematics;
+  const auto & trajectory = *input_data.trajectory;
 
   if (!check_engage_condition_) {
     return true;
@@ -109,19 +109,17 @@ bool AutonomousMode::isModeChangeCompleted(const InputData & input_data)
     return unstable();
   }
 
-  const auto closest_idx = findNearestIndex(
-    trajectory.points, kinematics.pose.pose, nearest_dist_deviation_threshold_,
-    nearest_yaw_deviation_threshold_);
+  const auto closest_idx = nearest_index_tracker_->find(trajectory.points, kinematics.pose.pose);
   if (!closest_idx) {
     RCLCPP_INFO_THROTTLE(logger_, *clock_, 3000, "Not stable yet: closest point not found");
     return unstable();
   }
 
-  const auto closest_point = trajectory.points.at(*closest_idx);
+  const auto & closest_point = trajectory.points.at(*closest_idx);
+  const auto deviation = calcDeviation(trajectory.points, kinematics.pose.pose, *closest_idx);
 
   // check for lateral deviation
-  const auto dist_deviation =
-    autoware::motion_utils::calcLateralOffset(trajectory.points, kinematics.pose.pose.position);
+  const auto dist_deviation = deviation.lateral;
   if (std::isnan(dist_deviation)) {
     RCLCPP_INFO_THROTTLE(
       logger_, *clock_, 3000, "Not stable yet: lateral offset calculation failed.");
@@ -135,8 +133,7 @@ bool AutonomousMode::isModeChangeCompleted(const InputData & input_data)
   }
 
   // check for yaw deviation
-  const auto yaw_deviation =
-    autoware::motion_utils::calcYawDeviation(trajectory.points, kinematics.pose.pose);
+  const auto yaw_deviation = deviation.yaw;
   if (std::isnan(yaw_deviation)) {
     RCLCPP_INFO_THROTTLE(
       logger_, *clock_, 3000, "Not stable yet: lateral offset calculation failed.");
@@ -219,10 +216,10 @@ bool AutonomousMode::isModeChangeAvailable(const InputData & input_data)
   if (!input_data.trajectory) return false;
   if (!input_data.trajectory_follower_control_cmd) return false;
   if (!input_data.control_cmd) return false;
-  const auto & kinematics = input_data.kinematics.value();
-  const auto & trajectory = input_data.trajectory.value();
-  const auto & trajectory_follower_control_cmd = input_data.trajectory_follower_control_cmd.value();
-  const auto & control_cmd = input_data.control_cmd.value();
+  const auto & kinematics = *input_data.kinematics;
+  const auto & trajectory = *input_data.trajectory;
+  const auto & trajectory_follower_control_cmd = *input_data.trajectory_follower_control_cmd;
+  const auto & control_cmd = *input_data.control_cmd;
 
   if (!check_engage_condition_) {
     setAllOk(debug_info_);
@@ -249,15 +246,13 @@ bool AutonomousMode::isModeChangeAvailable(const InputData & input_data)
     return false;
   }
 
-  const auto closest_idx = findNearestIndex(
-    trajectory.points, kinematics.pose.pose, nearest_dist_deviation_threshold_,
-    nearest_yaw_deviation_threshold_);
+  const auto closest_idx = nearest_index_tracker_->find(trajectory.points, kinematics.pose.pose);
   if (!closest_idx) {
     RCLCPP_INFO_THROTTLE(logger_, *clock_, 3000, "Engage unavailable: closest point not found");
     debug_info_ = DebugInfo{};  // all false
     return false;               // closest trajectory point not found.
   }
-  const auto closest_point = trajectory.points.at(*closest_idx);
+  const auto & closest_point = trajectory.points.at(*closest_idx);
   const auto target_planning_speed = closest_point.longitudinal_velocity_mps;
   debug_info_.trajectory_available_ok = true;
 
@@ -17,6 +17,7 @@
 
 #include "autoware_operation_mode_transition_manager/msg/operation_mode_transition_manager_debug.hpp"
 #include "data.hpp"
+#include "nearest_index_tracker.hpp"
 
 #include <autoware_vehicle_info_utils/vehicle_info_utils.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -26,6 +27,7 @@
 #include <nav_msgs/msg/odometry.hpp>
 
 #include <memory>
+#include <optional>
 #include <utility>
 
 namespace autoware::operation_mode_transition_manager
@@ -37,10 +39,10 @@ using Trajectory = autoware_planning_msgs::msg::Trajectory;
 
 struct InputData
 {
-  std::optional<Odometry> kinematics;
-  std::optional<Trajectory> trajectory;
-  std::optional<Control> trajectory_follower_control_cmd;
-  std::optional<Control> control_cmd;
+  Odometry::ConstSharedPtr kinematics;
+  Trajectory::ConstSharedPtr trajectory;
+  Control::ConstSharedPtr trajectory_follower_control_cmd;
+  Control::ConstSharedPtr control_cmd;
   OperationModeState gate_operation_mode;
 };
 
@@ -89,6 +91,7 @@ private:
   StableCheckParam stable_check_param_;
   Trajectory trajectory_;
   autoware::vehicle_info_utils::VehicleInfo vehicle_info_;
+  std::optional<NearestIndexTracker> nearest_index_tracker_;  // shared by the checks
 
   DebugInfo debug_info_;
   std::shared_ptr<rclcpp::Time> stable_start_time_;  // Reset every transition start.
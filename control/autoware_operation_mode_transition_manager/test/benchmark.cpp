@@ -0,0 +1,86 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "drive_generator.hpp"
+#include "nearest_index_tracker.hpp"
+
+#include <autoware/motion_utils/trajectory/trajectory.hpp>
+#include <autoware_utils/system/stop_watch.hpp>
+
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <cmath>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+using autoware::operation_mode_transition_manager::calcDeviation;
+using autoware::operation_mode_transition_manager::NearestIndexTracker;
+using autoware::operation_mode_transition_manager::test::generateDrive;
+using autoware::operation_mode_transition_manager::test::generateTrajectory;
+
+int main()
+{
+  constexpr double max_dist = 3.0;
+  constexpr double max_yaw = 1.046;
+  autoware_utils::StopWatch<std::chrono::milliseconds> stopwatch;
+
+  std::cout << "#TrajectorySize Ticks full_search_ms tracked_search_ms mismatches\n";
+  for (const size_t size : {100, 1000, 10000}) {
+    const auto points = generateTrajectory(size, 1.0);
+    const auto poses = generateDrive(points, 0.1);
+
+    double full_sum = 0.0;
+    stopwatch.tic("full");
+    for (const auto & pose : poses) {
+      const auto idx = autoware::motion_utils::findNearestIndex(points, pose, max_dist, max_yaw);
+      if (idx) {
+        full_sum += autoware::motion_utils::calcLateralOffset(points, pose.position) +
+                    autoware::motion_utils::calcYawDeviation(points, pose);
+      }
+    }
+    const double full_ms = stopwatch.toc("full");
+
+    double tracked_sum = 0.0;
+    size_t mismatches = 0;
+    NearestIndexTracker tracker(max_dist, max_yaw);
+    stopwatch.tic("tracked");
+    for (const auto & pose : poses) {
+      const auto idx = tracker.find(points, pose);
+      if (idx) {
+        const auto deviation = calcDeviation(points, pose, *idx);
+        tracked_sum += deviation.lateral + deviation.yaw;
+      }
+    }
+    const double tracked_ms = stopwatch.toc("tracked");
+
+    // Compare the results outside of the measurements
+    tracker.reset();
+    for (const auto & pose : poses) {
+      if (
+        tracker.find(points, pose) !=
+        autoware::motion_utils::findNearestIndex(points, pose, max_dist, max_yaw)) {
+        ++mismatches;
+      }
+    }
+
+    std::cout << size << " " << poses.size() << " " << full_ms << " " << tracked_ms << " "
+              << mismatches << "\n";
+    if (std::abs(full_sum - tracked_sum) > 1e-6 * static_cast<double>(poses.size())) {
+      std::cout << "# deviations differ: " << full_sum << " " << tracked_sum << "\n";
+    }
+  }
+  return 0;
+}
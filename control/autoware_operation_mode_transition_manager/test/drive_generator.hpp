@@ -0,0 +1,67 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DRIVE_GENERATOR_HPP_
+#define DRIVE_GENERATOR_HPP_
+
+#include <autoware/motion_utils/trajectory/trajectory.hpp>
+#include <autoware_utils/geometry/geometry.hpp>
+
+#include <autoware_planning_msgs/msg/trajectory_point.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace autoware::operation_mode_transition_manager::test
+{
+
+using autoware_planning_msgs::msg::TrajectoryPoint;
+
+// Curved trajectory: a sinusoid along x, with one point every interval [m]
+inline std::vector<TrajectoryPoint> generateTrajectory(const size_t size, const double interval)
+{
+  std::vector<TrajectoryPoint> points(size);
+  for (size_t i = 0; i < size; ++i) {
+    const double x = static_cast<double>(i) * interval;
+    const double y = 20.0 * std::sin(x / 50.0);
+    const double yaw = std::atan(20.0 / 50.0 * std::cos(x / 50.0));
+    points.at(i).pose = autoware_utils::calc_offset_pose(
+      geometry_msgs::msg::Pose{}, x, y, 0.0, yaw);
+    points.at(i).longitudinal_velocity_mps = 5.0;
+  }
+  return points;
+}
+
+// Poses of the ego driving along the trajectory with a small lateral and yaw error, one per tick
+inline std::vector<geometry_msgs::msg::Pose> generateDrive(
+  const std::vector<TrajectoryPoint> & points, const double step)
+{
+  std::default_random_engine engine(0);
+  std::uniform_real_distribution<double> lateral_error(-0.3, 0.3);
+  std::uniform_real_distribution<double> yaw_error(-0.1, 0.1);
+  std::vector<geometry_msgs::msg::Pose> poses;
+  const double length = autoware::motion_utils::calcArcLength(points);
+  for (double s = 0.0; s < length; s += step) {
+    const auto pose = autoware::motion_utils::calcInterpolatedPose(points, s);
+    poses.push_back(
+      autoware_utils::calc_offset_pose(pose, 0.0, lateral_error(engine), 0.0, yaw_error(engine)));
+  }
+  return poses;
+}
+
+}  // namespace autoware::operation_mode_transition_manager::test
+
+#endif  // DRIVE_GENERATOR_HPP_
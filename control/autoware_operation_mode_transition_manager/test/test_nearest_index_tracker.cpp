@@ -0,0 +1,101 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "drive_generator.hpp"
+#include "nearest_index_tracker.hpp"
+
+#include <autoware/motion_utils/trajectory/trajectory.hpp>
+#include <autoware_utils/geometry/geometry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace autoware::operation_mode_transition_manager
+{
+
+using test::generateDrive;
+using test::generateTrajectory;
+
+constexpr double max_dist = 3.0;
+constexpr double max_yaw = 1.046;
+
+TEST(NearestIndexTracker, FindEqualsFullSearchAlongDrive)
+{
+  const auto points = generateTrajectory(1000, 1.0);
+  const auto poses = generateDrive(points, 0.1);
+
+  NearestIndexTracker tracker(max_dist, max_yaw);
+  for (size_t i = 0; i < poses.size(); ++i) {
+    EXPECT_EQ(
+      tracker.find(points, poses.at(i)),
+      autoware::motion_utils::findNearestIndex(points, poses.at(i), max_dist, max_yaw))
+      << "tick " << i;
+  }
+}
+
+TEST(NearestIndexTracker, FallsBackToFullSearchAfterJump)
+{
+  const auto points = generateTrajectory(1000, 1.0);
+  const auto poses = generateDrive(points, 0.1);
+
+  NearestIndexTracker tracker(max_dist, max_yaw);
+  tracker.find(points, poses.front());
+  const auto & far_pose = poses.at(poses.size() / 2);
+  EXPECT_EQ(
+    tracker.find(points, far_pose),
+    autoware::motion_utils::findNearestIndex(points, far_pose, max_dist, max_yaw));
+}
+
+TEST(NearestIndexTracker, NoPointSatisfiesConstraints)
+{
+  const auto points = generateTrajectory(100, 1.0);
+  const auto pose = autoware_utils::calc_offset_pose(points.at(50).pose, 0.0, 10.0, 0.0);
+
+  NearestIndexTracker tracker(max_dist, max_yaw);
+  EXPECT_FALSE(tracker.find(points, pose).has_value());
+  EXPECT_FALSE(tracker.find({}, pose).has_value());
+}
+
+TEST(NearestIndexTracker, CalcDeviationEqualsFullSearchAlongDrive)
+{
+  const auto points = generateTrajectory(1000, 1.0);
+  const auto poses = generateDrive(points, 0.1);
+
+  NearestIndexTracker tracker(max_dist, max_yaw);
+  for (size_t i = 0; i < poses.size(); ++i) {
+    const auto & pose = poses.at(i);
+    const auto idx = tracker.find(points, pose);
+    ASSERT_TRUE(idx.has_value()) << "tick " << i;
+
+    const auto deviation = calcDeviation(points, pose, *idx);
+    EXPECT_NEAR(
+      deviation.lateral, autoware::motion_utils::calcLateralOffset(points, pose.position), 1e-9)
+      << "tick " << i;
+    EXPECT_NEAR(deviation.yaw, autoware::motion_utils::calcYawDeviation(points, pose), 1e-9)
+      << "tick " << i;
+  }
+}
+
+TEST(NearestIndexTracker, CalcDeviationOfInvalidInput)
+{
+  const auto points = generateTrajectory(100, 1.0);
+  const auto & pose = points.at(10).pose;
+
+  EXPECT_TRUE(std::isnan(calcDeviation({}, pose, 0).lateral));
+  EXPECT_TRUE(std::isnan(calcDeviation(points, pose, points.size()).yaw));
+}
+
+}  // namespace autoware::operation_mode_transition_manager
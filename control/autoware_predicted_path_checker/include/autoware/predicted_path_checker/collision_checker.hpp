@@ -32,10 +32,12 @@
 #include <boost/assert.hpp>
 #include <boost/assign/list_of.hpp>
 #include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
 
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <deque>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -47,6 +49,7 @@ using autoware_planning_msgs::msg::TrajectoryPoint;
 using TrajectoryPoints = std::vector<TrajectoryPoint>;
 using autoware_perception_msgs::msg::PredictedObject;
 using autoware_perception_msgs::msg::PredictedObjects;
+using autoware_utils::Box2d;
 using autoware_utils::Point2d;
 using autoware_utils::Polygon2d;
 using geometry_msgs::msg::Pose;
@@ -54,6 +57,10 @@ using geometry_msgs::msg::TransformStamped;
 using PointArray = std::vector<geometry_msgs::msg::Point>;
 
 namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+using ObjectFootprintNode = std::pair<Box2d, size_t>;
+using ObjectFootprintRtree = bgi::rtree<ObjectFootprintNode, bgi::rstar<16>>;
 
 struct CollisionCheckerParam
 {
@@ -76,6 +83,18 @@ struct PredictedObjectWithDetectionTime
   PredictedObject object;
 };
 
+/**
+ * @brief footprints of the dynamic objects of one cycle, indexed by their bounding box so that
+ * each trajectory segment is only checked against the objects near it
+ */
+struct ObjectFootprints
+{
+  explicit ObjectFootprints(const PredictedObjects & objects);
+
+  std::vector<Polygon2d> polygons;  // same order as the objects, empty for unsupported shapes
+  ObjectFootprintRtree rtree;
+};
+
 class CollisionChecker
 {
 public:
@@ -98,19 +117,17 @@ private:
 
   boost::optional<std::pair<geometry_msgs::msg::Point, PredictedObject>> checkDynamicObjects(
     const Pose & base_pose, PredictedObjects::ConstSharedPtr dynamic_objects,
-    const Polygon2d & one_step_move_vehicle_polygon2d, const double z_min, const double z_max);
+    const ObjectFootprints & object_footprints, const Polygon2d & one_step_move_vehicle_polygon2d,
+    const double z_min, const double z_max);
 
   void updatePredictedObjectHistory(const rclcpp::Time & now)
   {
-    for (auto itr = predicted_object_history_.begin(); itr != predicted_object_history_.end();) {
-      const auto expired = (now - itr->detection_time).seconds() > param_.chattering_threshold;
-
-      if (expired) {
-        itr = predicted_object_history_.erase(itr);
-        continue;
-      }
-
-      itr++;
+    // the history is filled in chronological order, so the expired objects are at the front
+    while (
+      !predicted_object_history_.empty() &&
+      (now - predicted_object_history_.front().detection_time).seconds() >
+        param_.chattering_threshold) {
+      predicted_object_history_.pop_front();
     }
   }
 
@@ -121,7 +138,7 @@ private:
   std::shared_ptr<PredictedPathCheckerDebugNode> debug_ptr_;
   rclcpp::Node * node_;
   autoware::vehicle_info_utils::VehicleInfo vehicle_info_;
-  std::vector<PredictedObjectWithDetectionTime> predicted_object_history_{};
+  std::deque<PredictedObjectWithDetectionTime> predicted_object_history_{};
 };
 }  // namespace autoware::predicted_path_checker
 
@@ -17,6 +17,8 @@
 #include <autoware_utils/ros/marker_helper.hpp>
 #include <rclcpp/logging.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -24,6 +26,22 @@
 
 namespace autoware::predicted_path_checker
 {
+ObjectFootprints::ObjectFootprints(const PredictedObjects & objects)
+{
+  std::vector<ObjectFootprintNode> nodes;
+  polygons.reserve(objects.objects.size());
+  nodes.reserve(objects.objects.size());
+  for (size_t i = 0; i < objects.objects.size(); ++i) {
+    polygons.push_back(convertObjToPolygon(objects.objects.at(i)));
+    if (polygons.back().outer().empty()) {
+      // unsupported type
+      continue;
+    }
+    nodes.emplace_back(bg::return_envelope<Box2d>(polygons.back()), i);
+  }
+  rtree = ObjectFootprintRtree(nodes.begin(), nodes.end());
+}
+
 CollisionChecker::CollisionChecker(
   rclcpp::Node * node, std::shared_ptr<PredictedPathCheckerDebugNode> debug_ptr)
 : debug_ptr_(std::move(debug_ptr)),
@@ -51,6 +69,9 @@ CollisionChecker::checkTrajectoryForCollision(
     return boost::none;
   }
 
+  // the object footprints do not depend on the trajectory, they are computed once per cycle
+  const ObjectFootprints object_footprints(*dynamic_objects);
+
   for (size_t i = 0; i < predicted_trajectory_array.size() - 1; i++) {
     // create one step circle center for vehicle
     const auto & p_front = predicted_trajectory_array.at(i).pose;
@@ -74,8 +95,8 @@ CollisionChecker::checkTrajectoryForCollision(
     auto found_collision_at_history =
       checkObstacleHistory(p_front, one_step_move_vehicle_polygon2d, z_min, z_max);
 
-    auto found_collision_at_dynamic_objects =
-      checkDynamicObjects(p_front, dynamic_objects, one_step_move_vehicle_polygon2d, z_min, z_max);
+    auto found_collision_at_dynamic_objects = checkDynamicObjects(
+      p_front, dynamic_objects, object_footprints, one_step_move_vehicle_polygon2d, z_min, z_max);
 
     if (found_collision_at_dynamic_objects || found_collision_at_history) {
       double distance_to_current = std::numeric_limits<double>::max();
@@ -123,15 +144,19 @@ CollisionChecker::checkObstacleHistory(
     return boost::none;
   }
 
+  const auto vehicle_envelope = bg::return_envelope<Box2d>(one_step_move_vehicle_polygon2d);
   std::vector<std::pair<geometry_msgs::msg::Point, PredictedObject>> collision_points_in_history;
   for (const auto & obj_history : predicted_object_history_) {
+    const auto & point = obj_history.point;
+    const Point2d point2d(point.x, point.y);
+    if (!bg::covered_by(point2d, vehicle_envelope)) {
+      continue;
+    }
     if (param_.enable_z_axis_obstacle_filtering) {
       if (!intersectsInZAxis(obj_history.object, z_min, z_max)) {
         continue;
       }
     }
-    const auto & point = obj_history.point;
-    const Point2d point2d(point.x, point.y);
     if (bg::within(point2d, one_step_move_vehicle_polygon2d)) {
       collision_points_in_history.emplace_back(point, obj_history.object);
     }
@@ -156,7 +181,8 @@ CollisionChecker::checkObstacleHistory(
 boost::optional<std::pair<geometry_msgs::msg::Point, PredictedObject>>
 CollisionChecker::checkDynamicObjects(
   const Pose & base_pose, PredictedObjects::ConstSharedPtr dynamic_objects,
-  const Polygon2d & one_step_move_vehicle_polygon2d, const double z_min, const double z_max)
+  const ObjectFootprints & object_footprints, const Polygon2d & one_step_move_vehicle_polygon2d,
+  const double z_min, const double z_max)
 {
   if (dynamic_objects->objects.empty()) {
     return boost::none;
@@ -166,18 +192,25 @@ CollisionChecker::checkDynamicObjects(
   size_t nearest_collision_object_index = 0;
   geometry_msgs::msg::Point nearest_collision_point;
 
-  for (size_t i = 0; i < dynamic_objects->objects.size(); ++i) {
+  // broad phase: only the objects whose bounding box intersects the one of the swept vehicle
+  std::vector<ObjectFootprintNode> candidates;
+  object_footprints.rtree.query(
+    bgi::intersects(bg::return_envelope<Box2d>(one_step_move_vehicle_polygon2d)),
+    std::back_inserter(candidates));
+  // keep the object order so that the nearest object is the same as when checking all of them
+  std::sort(candidates.begin(), candidates.end(), [](const auto & a, const auto & b) {
+    return a.second < b.second;
+  });
+
+  for (const auto & candidate : candidates) {
+    const size_t i = candidate.second;
     const auto & obj = dynamic_objects->objects.at(i);
     if (param_.enable_z_axis_obstacle_filtering) {
       if (!intersectsInZAxis(obj, z_min, z_max)) {
         continue;
       }
     }
-    const auto object_polygon = convertObjToPolygon(obj);
-    if (object_polygon.outer().empty()) {
-      // unsupported type
-      continue;
-    }
+    const auto & object_polygon = object_footprints.polygons.at(i);
 
     const auto found_collision_points =
       bg::intersects(one_step_move_vehicle_polygon2d, object_polygon);
@@ -217,7 +250,7 @@ CollisionChecker::checkDynamicObjects(
   }
   if (is_init) {
     const auto & obj = dynamic_objects->objects.at(nearest_collision_object_index);
-    const auto obstacle_polygon = convertObjToPolygon(obj);
+    const auto & obstacle_polygon = object_footprints.polygons.at(nearest_collision_object_index);
     if (param_.enable_z_axis_obstacle_filtering) {
       debug_ptr_->pushPolyhedron(obstacle_polygon, z_min, z_max, PolygonType::Collision);
     } else {
@@ -54,6 +54,11 @@ public:
   // setter
   void setCurrentPose(const geometry_msgs::msg::Pose & msg);
   void setWaypoints(const std::vector<geometry_msgs::msg::Pose> & msg);
+  // share the waypoints without copying them, they must not be modified while they are used
+  void setWaypoints(const std::shared_ptr<std::vector<geometry_msgs::msg::Pose>> & msg)
+  {
+    curr_wps_ptr_ = msg;
+  }
   void setLookaheadDistance(double ld) { lookahead_distance_ = ld; }
   void setClosestThreshold(double closest_thr_dist, double closest_thr_ang)
   {
@@ -51,6 +51,7 @@
 #include <boost/optional.hpp>  // To be replaced by std::optional in C++17
 
 #include <memory>
+#include <optional>
 #include <vector>
 
 using autoware::motion::control::trajectory_follower::InputData;
@@ -108,6 +109,10 @@ private:
   rclcpp::Logger logger_;
   std::vector<TrajectoryPoint> output_tp_array_;
   autoware_planning_msgs::msg::Trajectory::SharedPtr trajectory_resampled_;
+  std::shared_ptr<std::vector<geometry_msgs::msg::Pose>> resampled_poses_;
+  // nearest indices of the last searches, used as the start of the next searches
+  std::optional<size_t> control_nearest_idx_hint_;
+  std::optional<size_t> prediction_nearest_idx_hint_;
   autoware_planning_msgs::msg::Trajectory trajectory_;
   nav_msgs::msg::Odometry current_odometry_;
   autoware_vehicle_msgs::msg::SteeringReport current_steering_;
@@ -169,6 +174,19 @@ private:
 
   double calcCurvature(const size_t closest_idx);
 
+  /**
+   * @brief find the nearest index of output_tp_array_ with the distance and yaw thresholds. The
+   * points around the hint are searched first, the whole trajectory is searched only if the nearest
+   * point of this window is on its border or not found.
+   */
+  std::optional<size_t> findNearestIndexWithHint(
+    const geometry_msgs::msg::Pose & pose, const std::optional<size_t> hint) const;
+
+  /**
+   * @brief calculate the lateral offset to the resampled trajectory around the nearest index
+   */
+  double calcLateralOffset(const geometry_msgs::msg::Point & point, const size_t nearest_idx) const;
+
   void averageFilterTrajectory(autoware_planning_msgs::msg::Trajectory & u);
 
   // Debug
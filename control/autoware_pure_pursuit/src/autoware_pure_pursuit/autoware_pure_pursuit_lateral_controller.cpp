@@ -38,6 +38,9 @@
 #include <autoware_vehicle_info_utils/vehicle_info_utils.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -54,6 +57,9 @@ enum TYPE {
   VELOCITY = 6,
   SIZE  // this is the number of enum elements
 };
+
+constexpr double closest_thr_dist = 3.0;
+constexpr double closest_thr_ang = M_PI_4;
 }  // namespace
 
 namespace autoware::pure_pursuit
@@ -174,6 +180,61 @@ void PurePursuitLateralController::setResampledTrajectory()
   output_tp_array_ = autoware::motion_utils::convertToTrajectoryPointArray(*trajectory_resampled_);
 }
 
+std::optional<size_t> PurePursuitLateralController::findNearestIndexWithHint(
+  const geometry_msgs::msg::Pose & pose, const std::optional<size_t> hint) const
+{
+  if (hint && *hint < output_tp_array_.size()) {
+    // the points within the distance threshold of a point are at most this far in the index
+    const auto range = static_cast<size_t>(std::ceil(closest_thr_dist / param_.resampling_ds)) + 1;
+    const size_t begin = *hint > range ? *hint - range : 0;
+    const size_t end = std::min(*hint + range + 1, output_tp_array_.size());
+
+    // same criteria as autoware::motion_utils::findNearestIndex
+    double min_squared_dist = std::numeric_limits<double>::max();
+    std::optional<size_t> nearest_idx;
+    for (size_t i = begin; i < end; ++i) {
+      const auto & p = output_tp_array_.at(i);
+      const auto squared_dist = autoware_utils::calc_squared_distance2d(p, pose);
+      if (squared_dist > closest_thr_dist * closest_thr_dist || squared_dist >= min_squared_dist) {
+        continue;
+      }
+      const auto yaw = autoware_utils::calc_yaw_deviation(p.pose, pose);
+      if (std::fabs(yaw) > closest_thr_ang) {
+        continue;
+      }
+      min_squared_dist = squared_dist;
+      nearest_idx = i;
+    }
+
+    // the nearest point may be out of the window if the local one is on its border
+    const bool is_on_border =
+      nearest_idx && ((*nearest_idx == begin && begin != 0) ||
+                      (*nearest_idx + 1 == end && end != output_tp_array_.size()));
+    if (nearest_idx && !is_on_border) {
+      return nearest_idx;
+    }
+  }
+
+  return autoware::motion_utils::findNearestIndex(
+    output_tp_array_, pose, closest_thr_dist, closest_thr_ang);
+}
+
+double PurePursuitLateralController::calcLateralOffset(
+  const geometry_msgs::msg::Point & point, const size_t nearest_idx) const
+{
+  // same segment selection as autoware::motion_utils::findNearestSegmentIndex
+  const auto & points = trajectory_resampled_->points;
+  size_t seg_idx = nearest_idx;
+  if (nearest_idx + 1 >= points.size()) {
+    seg_idx = points.size() - 2;
+  } else if (
+    nearest_idx != 0 &&
+    autoware::motion_utils::calcLongitudinalOffsetToSegment(points, nearest_idx, point) <= 0.0) {
+    seg_idx = nearest_idx - 1;
+  }
+  return autoware::motion_utils::calcLateralOffset(points, point, seg_idx);
+}
+
 double PurePursuitLateralController::calcCurvature(const size_t closest_idx)
 {
   // Calculate current curvature
@@ -227,56 +288,62 @@ void PurePursuitLateralController::averageFilterTrajectory(
 
   autoware_planning_msgs::msg::Trajectory filtered_trajectory(u);
 
-  for (int64_t i = 0; i < static_cast<int64_t>(u.points.size()); ++i) {
-    TrajectoryPoint tmp{};
-    int64_t num_tmp = param_.path_filter_moving_ave_num;
-    int64_t count = 0;
-    double yaw = 0.0;
-    if (i - num_tmp < 0) {
-      num_tmp = i;
+  // running sums of the filtered values, the sum over [i, j) is sums[j] - sums[i]
+  enum { X = 0, Y, Z, VEL, ACC, FRONT_WHEEL, HEADING_RATE, YAW, LAT_VEL, REAR_WHEEL, NUM };
+  const auto points_num = static_cast<int64_t>(u.points.size());
+  std::vector<std::array<double, NUM>> sums(u.points.size() + 1);
+  sums.front().fill(0.0);
+  for (size_t i = 0; i < u.points.size(); ++i) {
+    const auto & p = u.points.at(i);
+    const std::array<double, NUM> values = {p.pose.position.x,
+                                            p.pose.position.y,
+                                            p.pose.position.z,
+                                            p.longitudinal_velocity_mps,
+                                            p.acceleration_mps2,
+                                            p.front_wheel_angle_rad,
+                                            p.heading_rate_rps,
+                                            tf2::getYaw(p.pose.orientation),
+                                            p.lateral_velocity_mps,
+                                            p.rear_wheel_angle_rad};
+    for (size_t k = 0; k < NUM; ++k) {
+      sums[i + 1][k] = sums[i][k] + values[k];
     }
-    if (i + num_tmp > static_cast<int64_t>(u.points.size()) - 1) {
-      num_tmp = static_cast<int64_t>(u.points.size()) - i - 1;
-    }
-    for (int64_t j = -num_tmp; j <= num_tmp; ++j) {
-      const auto & p = u.points.at(static_cast<size_t>(i + j));
-
-      tmp.pose.position.x += p.pose.position.x;
-      tmp.pose.position.y += p.pose.position.y;
-      tmp.pose.position.z += p.pose.position.z;
-      tmp.longitudinal_velocity_mps += p.longitudinal_velocity_mps;
-      tmp.acceleration_mps2 += p.acceleration_mps2;
-      tmp.front_wheel_angle_rad += p.front_wheel_angle_rad;
-      tmp.heading_rate_rps += p.heading_rate_rps;
-      yaw += tf2::getYaw(p.pose.orientation);
-      tmp.lateral_velocity_mps += p.lateral_velocity_mps;
-      tmp.rear_wheel_angle_rad += p.rear_wheel_angle_rad;
-      ++count;
-    }
-    auto & p = filtered_trajectory.points.at(static_cast<size_t>(i));
+  }
+
+  for (int64_t i = 0; i < points_num; ++i) {
+    // the window is shrunk near both ends to stay symmetric
+    const int64_t num_tmp =
+      std::min({static_cast<int64_t>(param_.path_filter_moving_ave_num), i, points_num - i - 1});
+    const auto & lower = sums.at(static_cast<size_t>(i - num_tmp));
+    const auto & upper = sums.at(static_cast<size_t>(i + num_tmp + 1));
+    const auto count = static_cast<double>(2 * num_tmp + 1);
+    const auto mean = [&](const size_t k) { return (upper[k] - lower[k]) / count; };
 
-    p.pose.position.x = tmp.pose.position.x / count;
-    p.pose.position.y = tmp.pose.position.y / count;
-    p.pose.position.z = tmp.pose.position.z / count;
-    p.longitudinal_velocity_mps = tmp.longitudinal_velocity_mps / count;
-    p.acceleration_mps2 = tmp.acceleration_mps2 / count;
-    p.front_wheel_angle_rad = tmp.front_wheel_angle_rad / count;
-    p.heading_rate_rps = tmp.heading_rate_rps / count;
-    p.lateral_velocity_mps = tmp.lateral_velocity_mps / count;
-    p.rear_wheel_angle_rad = tmp.rear_wheel_angle_rad / count;
-    p.pose.orientation = autoware::pure_pursuit::planning_utils::getQuaternionFromYaw(yaw / count);
+    auto & p = filtered_trajectory.points.at(static_cast<size_t>(i));
+    p.pose.position.x = mean(X);
+    p.pose.position.y = mean(Y);
+    p.pose.position.z = mean(Z);
+    p.longitudinal_velocity_mps = mean(VEL);
+    p.acceleration_mps2 = mean(ACC);
+    p.front_wheel_angle_rad = mean(FRONT_WHEEL);
+    p.heading_rate_rps = mean(HEADING_RATE);
+    p.lateral_velocity_mps = mean(LAT_VEL);
+    p.rear_wheel_angle_rad = mean(REAR_WHEEL);
+    p.pose.orientation = autoware::pure_pursuit::planning_utils::getQuaternionFromYaw(mean(YAW));
   }
   trajectory_resampled_ = std::make_shared<Trajectory>(filtered_trajectory);
 }
 
 boost::optional<Trajectory> PurePursuitLateralController::generatePredictedTrajectory()
 {
-  const auto closest_idx_result = autoware::motion_utils::findNearestIndex(
-    output_tp_array_, current_odometry_.pose.pose, 3.0, M_PI_4);
+  const auto closest_idx_result =
+    findNearestIndexWithHint(current_odometry_.pose.pose, control_nearest_idx_hint_);
 
   if (!closest_idx_result) {
     return boost::none;
   }
+  // the predicted poses move forward from the current pose
+  prediction_nearest_idx_hint_ = closest_idx_result;
 
   const double remaining_distance = planning_utils::calcArcLengthFromWayPoint(
     *trajectory_resampled_, *closest_idx_result, trajectory_resampled_->points.size() - 1);
@@ -343,13 +410,21 @@ bool PurePursuitLateralController::isReady([[maybe_unused]] const InputData & in
 LateralOutput PurePursuitLateralController::run(const InputData & input_data)
 {
   current_pose_ = input_data.current_odometry.pose.pose;
-  trajectory_ = input_data.current_trajectory;
   current_odometry_ = input_data.current_odometry;
   current_steering_ = input_data.current_steering;
 
-  setResampledTrajectory();
-  if (param_.enable_path_smoothing) {
-    averageFilterTrajectory(*trajectory_resampled_);
+  // the trajectory is usually received at a lower rate than the control period, resample and
+  // smooth it only when it changes
+  if (!trajectory_resampled_ || input_data.current_trajectory != trajectory_) {
+    trajectory_ = input_data.current_trajectory;
+    setResampledTrajectory();
+    if (param_.enable_path_smoothing) {
+      averageFilterTrajectory(*trajectory_resampled_);
+    }
+    resampled_poses_ = std::make_shared<std::vector<geometry_msgs::msg::Pose>>(
+      planning_utils::extractPoses(*trajectory_resampled_));
+    control_nearest_idx_hint_ = std::nullopt;
+    prediction_nearest_idx_hint_ = std::nullopt;
   }
   const auto cmd_msg = generateOutputControlCmd();
 
@@ -429,20 +504,21 @@ boost::optional<PpOutput> PurePursuitLateralController::calcTargetCurvature(
 
   // Calculate target point for velocity/acceleration
 
-  const auto closest_idx_result =
-    autoware::motion_utils::findNearestIndex(output_tp_array_, pose, 3.0, M_PI_4);
+  auto & nearest_idx_hint =
+    is_control_output ? control_nearest_idx_hint_ : prediction_nearest_idx_hint_;
+  const auto closest_idx_result = findNearestIndexWithHint(pose, nearest_idx_hint);
   if (!closest_idx_result) {
     RCLCPP_ERROR(logger_, "cannot find closest waypoint");
     return {};
   }
+  nearest_idx_hint = closest_idx_result;
 
   const double target_vel =
     trajectory_resampled_->points.at(*closest_idx_result).longitudinal_velocity_mps;
 
   // calculate the lateral error
 
-  const double lateral_error =
-    autoware::motion_utils::calcLateralOffset(trajectory_resampled_->points, pose.position);
+  const double lateral_error = calcLateralOffset(pose.position, *closest_idx_result);
 
   // calculate the current curvature
 
@@ -463,7 +539,7 @@ boost::optional<PpOutput> PurePursuitLateralController::calcTargetCurvature(
 
   // Set PurePursuit data
   pure_pursuit_->setCurrentPose(pose);
-  pure_pursuit_->setWaypoints(planning_utils::extractPoses(*trajectory_resampled_));
+  pure_pursuit_->setWaypoints(resampled_poses_);
   pure_pursuit_->setLookaheadDistance(lookahead_distance);
 
   // Run PurePursuit
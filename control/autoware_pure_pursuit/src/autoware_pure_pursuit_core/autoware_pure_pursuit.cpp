@@ -33,6 +33,7 @@
 
 #include <limits>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -155,6 +156,9 @@ int32_t PurePursuit::findNextPointIdx(int32_t search_start_idx)
     return -1;
   }
 
+  // the lane direction does not depend on the searched waypoint
+  std::optional<int8_t> gld;
+
   // look for the next waypoint.
   for (int32_t i = search_start_idx; i < static_cast<int32_t>(curr_wps_ptr_->size()); i++) {
     // if search waypoint is the last
@@ -163,7 +167,9 @@ int32_t PurePursuit::findNextPointIdx(int32_t search_start_idx)
     }
 
     // if waypoint direction is forward
-    const auto gld = planning_utils::getLaneDirection(*curr_wps_ptr_, 0.05);
+    if (!gld) {
+      gld = planning_utils::getLaneDirection(*curr_wps_ptr_, 0.05);
+    }
     if (gld == 0) {
       // if waypoint is not in front of ego, skip
       auto ret = planning_utils::transformToRelativeCoordinate2D(
@@ -402,11 +402,23 @@ class transform_model_to_c:
             acc_normalize,
             steer_normalize,
         )
+        self.transform.set_nominal_params(
+            drive_functions.mpc_freq,
+            drive_functions.ctrl_time_step,
+            drive_functions.L,
+            drive_functions.acc_time_constant,
+            drive_functions.steer_time_constant,
+            drive_functions.steer_dead_band_for_ctrl,
+            drive_functions.error_decay,
+            drive_functions.minimum_steer_diff,
+        )
         self.pred = self.transform.rot_and_d_rot_error_prediction
         self.pred_only_state = self.transform.rotated_error_prediction
         self.pred_with_diff = self.transform.rot_and_d_rot_error_prediction_with_diff
         self.pred_with_poly_diff = self.transform.rot_and_d_rot_error_prediction_with_poly_diff
         self.Pred = self.transform.Rotated_error_prediction
+        # Rollout of F_with_model_diff with pred_with_diff over the whole horizon in C++
+        self.forward_trajectory_with_diff = self.transform.forward_trajectory_with_diff
 
 
 class transform_model_with_memory_to_c:
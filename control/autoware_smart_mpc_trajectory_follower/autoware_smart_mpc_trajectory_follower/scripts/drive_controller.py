@@ -289,6 +289,11 @@ class drive_controller:
                 self.pred_with_diff = self.transform_model.pred_with_memory_diff
             else:
                 self.pred_with_diff = self.transform_model.pred_with_diff
+            self.F_N_trajectory_diff = None
+            if self.pred_with_diff == getattr(self.transform_model, "pred_with_diff", None):
+                self.F_N_trajectory_diff = getattr(
+                    self.transform_model, "forward_trajectory_with_diff", None
+                )
             self.loss_fn = torch.nn.L1Loss()
             self.drive_optimizer = torch.optim.Adam(
                 params=self.model.parameters(), lr=drive_learning_rate
@@ -335,6 +340,7 @@ class drive_controller:
                 steer_time_constant_ctrl=self.steer_time_constant_ctrl,
             )
             self.F_N_initial_diff = self.F_N_diff
+            self.F_N_trajectory_diff = None
             self.F_N_only_state = partial(
                 drive_functions.F_with_history,
                 i=self.acc_delay_step,
@@ -543,7 +549,10 @@ class drive_controller:
                     self.nominal_inputs
                 )
                 self.ilqr.receive_model(
-                    self.F_N_initial_diff, self.F_N_diff, self.F_N_for_candidates
+                    self.F_N_initial_diff,
+                    self.F_N_diff,
+                    self.F_N_for_candidates,
+                    self.F_N_trajectory_diff,
                 )
                 self.nominal_inputs, self.u_opt_dot, nominal_traj, proceed = (
                     self.ilqr
@@ -1114,6 +1123,11 @@ class drive_controller:
                     self.pred_with_diff = self.transform_model.pred_with_memory_diff
                 else:
                     self.pred_with_diff = self.transform_model.pred_with_diff
+                self.F_N_trajectory_diff = None
+                if self.pred_with_diff == getattr(self.transform_model, "pred_with_diff", None):
+                    self.F_N_trajectory_diff = getattr(
+                        self.transform_model, "forward_trajectory_with_diff", None
+                    )
                 self.F_N_initial_diff = partial(
                     drive_functions.F_with_model_initial_diff,
                     pred=self.transform_model.pred,
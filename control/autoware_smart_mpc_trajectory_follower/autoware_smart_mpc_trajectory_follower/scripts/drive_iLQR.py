@@ -441,6 +441,7 @@ class drive_iLQR:
         ls[-1] = 0.0
         self.ls = ls
         self.add_state_hc = False
+        self.F_trajectory_with_diff = None
         self.state_dim = actual_state_dim
         self.acc_index = acc_index
         self.steer_index = steer_index
@@ -505,6 +506,20 @@ class drive_iLQR:
         C = np.zeros((N, 6, nx))
         if self.add_state_hc:
             D = np.zeros((N, 6 + self.h_dim_double, nx + self.h_dim_double))
+        if (
+            self.use_trained_model_diff
+            and self.F_trajectory_with_diff is not None
+            and not self.add_state_hc
+        ):
+            # The whole rollout is computed in C++ without going back to Python at each step.
+            traj, A_stacked, B_stacked, C_stacked = self.F_trajectory_with_diff(
+                x_current, inputs, previous_error
+            )
+            A = A_stacked.reshape(N, nx, nx)
+            B = B_stacked.reshape(N, nx, nu)
+            C = C_stacked.reshape(N, 6, nx)
+            A[:, :6] += drive_functions.sg_filter_for_trained_model_diff(C)
+            return traj, A, B
         previous_error_ = previous_error.copy()
         for k in range(N):
             if self.use_trained_model_diff:
@@ -677,12 +692,20 @@ class drive_iLQR:
         return best_inputs, best_inputs[0], best_traj, proceed
 
     def receive_model(
-        self, F_with_initial_diff: Callable, F_with_diff: Callable, F_for_candidates: Callable
+        self,
+        F_with_initial_diff: Callable,
+        F_with_diff: Callable,
+        F_for_candidates: Callable,
+        F_trajectory_with_diff: Callable | None = None,
     ):
-        """Receive vehicle model for control."""
+        """Receive vehicle model for control.
+
+        F_trajectory_with_diff is the rollout of F_with_diff over the whole horizon if available.
+        """
         self.F_with_initial_diff = F_with_initial_diff
         self.F_with_diff = F_with_diff
         self.F_for_candidates = F_for_candidates
+        self.F_trajectory_with_diff = F_trajectory_with_diff
 
     def receive_memory_diff(
         self, get_dhc_dx: Callable, get_dhc_dhc: Callable, get_dy_dhc: Callable
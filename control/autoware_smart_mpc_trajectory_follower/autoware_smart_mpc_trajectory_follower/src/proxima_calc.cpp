@@ -20,7 +20,9 @@
 #include <pybind11/pybind11.h>
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <tuple>
 #include <vector>
 namespace py = pybind11;
 
@@ -178,6 +180,133 @@ private:
   static constexpr double max_acc_error_ = 20.0;
   static constexpr double max_steer_error_ = 20.0;
 
+  // nominal model used to integrate the states over the MPC horizon
+  static constexpr int nx_0_ = 6;
+  static constexpr int nu_0_ = 2;
+  using NominalState = Eigen::Matrix<double, nx_0_, 1>;
+  using NominalInput = Eigen::Matrix<double, nu_0_, 1>;
+  using NominalStateJacobian = Eigen::Matrix<double, nx_0_, nx_0_>;
+  using NominalInputJacobian = Eigen::Matrix<double, nx_0_, nu_0_>;
+  using ErrorVector = Eigen::Matrix<double, nx_0_ + 2, 1>;
+  int mpc_freq_{};
+  double ctrl_time_step_{};
+  double wheel_base_{};
+  double acc_time_constant_{};
+  double steer_time_constant_{};
+  double steer_dead_band_{};
+  double minimum_steer_diff_{};
+  ErrorVector error_decay_ = ErrorVector::Zero();
+
+  // one control step of the nominal model and its derivatives, same as F_init_with_diff
+  void nominal_step_with_diff(
+    const NominalState & x, const NominalInput & u, NominalState & x_next,
+    NominalStateJacobian & dF_dx, NominalInputJacobian & dF_du) const
+  {
+    const double v = x[2];
+    const double theta = x[3];
+    const double alpha = x[4];
+    const double delta = x[5];
+
+    double delta_diff = u[1] - delta;
+    if (delta_diff >= steer_dead_band_) {
+      delta_diff = delta_diff - steer_dead_band_;
+    } else if (delta_diff <= -steer_dead_band_) {
+      delta_diff = delta_diff + steer_dead_band_;
+    } else {
+      delta_diff = 0.0;
+    }
+    const double cos = std::cos(theta);
+    const double sin = std::sin(theta);
+    const double tan_delta = std::tan(delta);
+    const double cos_delta = std::cos(delta);
+
+    x_next[0] = x[0] + v * cos * ctrl_time_step_;
+    x_next[1] = x[1] + v * sin * ctrl_time_step_;
+    x_next[2] = x[2] + alpha * ctrl_time_step_;
+    x_next[3] = x[3] + v * tan_delta / wheel_base_ * ctrl_time_step_;
+    x_next[4] = x[4] + (u[0] - alpha) / acc_time_constant_ * ctrl_time_step_;
+    x_next[5] = x[5] + delta_diff / steer_time_constant_ * ctrl_time_step_;
+
+    dF_dx.setIdentity();
+    dF_dx(0, 2) += cos * ctrl_time_step_;
+    dF_dx(0, 3) -= v * sin * ctrl_time_step_;
+    dF_dx(1, 2) += sin * ctrl_time_step_;
+    dF_dx(1, 3) += v * cos * ctrl_time_step_;
+    dF_dx(2, 4) += ctrl_time_step_;
+    dF_dx(3, 2) += tan_delta * ctrl_time_step_ / wheel_base_;
+    dF_dx(3, 5) += v * ctrl_time_step_ / (wheel_base_ * cos_delta * cos_delta);
+    dF_dx(4, 4) -= ctrl_time_step_ / acc_time_constant_;
+
+    dF_du.setZero();
+    dF_du(4, 0) = ctrl_time_step_ / acc_time_constant_;
+    if (std::abs(u[1] - delta) >= steer_dead_band_) {
+      dF_dx(5, 5) -= ctrl_time_step_ / steer_time_constant_;
+      dF_du(5, 1) = ctrl_time_step_ / steer_time_constant_;
+    }
+  }
+
+  // integration up to the MPC time width by the nominal model including the input history, same as
+  // F_with_history_and_diff. The outputs are written in place.
+  void nominal_history_step_with_diff(
+    const Eigen::VectorXd & states, const NominalInput & inputs,
+    Eigen::Ref<Eigen::VectorXd> states_next, Eigen::Ref<Eigen::MatrixXd> dF_dx,
+    Eigen::Ref<Eigen::MatrixXd> dF_du, std::vector<NominalStateJacobian> & dx_buffer,
+    std::vector<NominalInputJacobian> & du_buffer) const
+  {
+    const int acc_start = nx_0_;
+    const int steer_start = nx_0_ + acc_ctrl_queue_size_;
+    const int shifted_acc_size = acc_ctrl_queue_size_ - mpc_freq_;
+    const int shifted_steer_size = steer_ctrl_queue_size_ - mpc_freq_;
+
+    states_next.setZero();
+    dF_dx.setZero();
+    dF_du.setZero();
+    states_next.segment(acc_start + mpc_freq_, shifted_acc_size) =
+      states.segment(acc_start, shifted_acc_size);
+    states_next.segment(steer_start + mpc_freq_, shifted_steer_size) =
+      states.segment(steer_start, shifted_steer_size);
+    dF_dx.block(acc_start + mpc_freq_, acc_start, shifted_acc_size, shifted_acc_size)
+      .setIdentity();
+    dF_dx.block(steer_start + mpc_freq_, steer_start, shifted_steer_size, shifted_steer_size)
+      .setIdentity();
+    for (int index = 0; index < mpc_freq_; index++) {
+      const int acc_index = acc_start + mpc_freq_ - index - 1;
+      const int steer_index = steer_start + mpc_freq_ - index - 1;
+      states_next[acc_index] = states_next[acc_index + 1] + ctrl_time_step_ * inputs[0];
+      states_next[steer_index] = states_next[steer_index + 1] + ctrl_time_step_ * inputs[1];
+      dF_dx(acc_index, acc_start) = 1.0;
+      dF_dx(steer_index, steer_start) = 1.0;
+      dF_du(acc_index, 0) = (index + 1) * ctrl_time_step_;
+      dF_du(steer_index, 1) = (index + 1) * ctrl_time_step_;
+    }
+
+    // delayed inputs actually applied in each control step
+    NominalState x = states.head(nx_0_);
+    for (int t = 0; t < mpc_freq_; t++) {
+      NominalInput actual_input;
+      actual_input << states_next[acc_start + acc_delay_step_ + mpc_freq_ - 1 - t],
+        states_next[steer_start + steer_delay_step_ + mpc_freq_ - 1 - t];
+      NominalState x_next;
+      nominal_step_with_diff(x, actual_input, x_next, dx_buffer[t], du_buffer[t]);
+      x = x_next;
+    }
+    states_next.head(nx_0_) = x;
+
+    // chain rule from the last control step
+    NominalStateJacobian dx_suffix = NominalStateJacobian::Identity();
+    for (int t = mpc_freq_ - 1; t >= 0; t--) {
+      const NominalInputJacobian d_input = dx_suffix * du_buffer[t];
+      const int acc_index =
+        acc_start + std::max(acc_delay_step_ - mpc_freq_, 0) + mpc_freq_ - 1 - t;
+      const int steer_index =
+        steer_start + std::max(steer_delay_step_ - mpc_freq_, 0) + mpc_freq_ - 1 - t;
+      dF_dx.block(0, acc_index, nx_0_, 1) = d_input.col(0);
+      dF_dx.block(0, steer_index, nx_0_, 1) = d_input.col(1);
+      dx_suffix = dx_suffix * dx_buffer[t];
+    }
+    dF_dx.topLeftCorner(nx_0_, nx_0_) = dx_suffix;
+  }
+
 public:
   transform_model_to_eigen() {}
   void set_params(
@@ -222,6 +351,21 @@ public:
     acc_normalize_ = acc_normalize;
     steer_normalize_ = steer_normalize;
   }
+  void set_nominal_params(
+    const int mpc_freq, const double ctrl_time_step, const double wheel_base,
+    const double acc_time_constant, const double steer_time_constant,
+    const double steer_dead_band, const Eigen::VectorXd & error_decay,
+    const double minimum_steer_diff)
+  {
+    mpc_freq_ = mpc_freq;
+    ctrl_time_step_ = ctrl_time_step;
+    wheel_base_ = wheel_base;
+    acc_time_constant_ = acc_time_constant;
+    steer_time_constant_ = steer_time_constant;
+    steer_dead_band_ = steer_dead_band;
+    error_decay_ = error_decay;
+    minimum_steer_diff_ = minimum_steer_diff;
+  }
   Eigen::VectorXd error_prediction(const Eigen::VectorXd & x) const
   {
     Eigen::VectorXd acc_sub(acc_ctrl_queue_size_ + 1);
@@ -573,6 +717,63 @@ public:
     }
     return Pred;
   }
+  /*
+  Rollout of F_with_model_diff over the whole horizon, which is called for each step from Python
+  otherwise. Returns the trajectory ((N + 1) x nx) and the derivatives A, B and C of each step
+  stacked vertically ((N * nx) x nx, (N * nx) x nu and (N * 6) x nx).
+  */
+  std::tuple<Eigen::MatrixXd, Eigen::MatrixXd, Eigen::MatrixXd, Eigen::MatrixXd>
+  forward_trajectory_with_diff(
+    const Eigen::VectorXd & x_current, const Eigen::MatrixXd & inputs,
+    const Eigen::VectorXd & previous_error) const
+  {
+    const int horizon_len = inputs.rows();
+    const int nx = x_current.size();
+    const int steer_start = nx_0_ + acc_ctrl_queue_size_;
+    const double mpc_time_step = mpc_freq_ * ctrl_time_step_;
+    const ErrorVector error_decay_3 =
+      error_decay_.cwiseProduct(error_decay_).cwiseProduct(error_decay_);
+
+    Eigen::MatrixXd traj(nx, horizon_len + 1);
+    Eigen::MatrixXd A(horizon_len * nx, nx);
+    Eigen::MatrixXd B(horizon_len * nx, nu_0_);
+    Eigen::MatrixXd C(horizon_len * nx_0_, nx);
+    std::vector<NominalStateJacobian> dx_buffer(mpc_freq_);
+    std::vector<NominalInputJacobian> du_buffer(mpc_freq_);
+
+    traj.col(0) = x_current;
+    ErrorVector error = previous_error;
+    for (int k = 0; k < horizon_len; k++) {
+      const Eigen::VectorXd states = traj.col(k);
+      const Eigen::MatrixXd pred_with_diff = rot_and_d_rot_error_prediction_with_diff(states);
+
+      const ErrorVector & decay = k == 0 ? error_decay_ : error_decay_3;
+      ErrorVector next_error;
+      next_error.head<nx_0_>() = decay.head<nx_0_>().cwiseProduct(error.head<nx_0_>()) +
+                                 (1.0 - decay.head<nx_0_>().array()).matrix().cwiseProduct(
+                                   pred_with_diff.col(0));
+      next_error.tail<2>() =
+        decay.tail<2>().cwiseProduct(error.tail<2>()) +
+        (1.0 - decay.tail<2>().array()).matrix().cwiseProduct(pred_with_diff.col(1).head<2>());
+
+      auto dF_dx = A.middleRows(k * nx, nx);
+      auto C_k = C.middleRows(k * nx_0_, nx_0_);
+      const NominalInput u = inputs.row(k).transpose();
+      nominal_history_step_with_diff(
+        states, u, traj.col(k + 1), dF_dx, B.middleRows(k * nx, nx), dx_buffer, du_buffer);
+
+      dF_dx.block(0, 3, 2, 1) += next_error.tail<2>() * mpc_time_step;
+      traj.col(k + 1).head<nx_0_>() += next_error.head<nx_0_>() * mpc_time_step;
+      C_k = pred_with_diff.rightCols(nx) * mpc_time_step;
+      const double steer_diff =
+        dF_dx.row(5).tail(nx - steer_start).sum() + C_k.row(5).tail(nx - steer_start).sum();
+      if (steer_diff < minimum_steer_diff_) {
+        C_k(5, nx - 1) += minimum_steer_diff_ - steer_diff;
+      }
+      error = next_error;
+    }
+    return {traj.transpose(), A, B, C};
+  }
 };
 class transform_model_with_memory_to_eigen
 {
@@ -1528,7 +1729,10 @@ PYBIND11_MODULE(proxima_calc, m)
       "rot_and_d_rot_error_prediction_with_poly_diff",
       &transform_model_to_eigen::rot_and_d_rot_error_prediction_with_poly_diff)
     .def("rotated_error_prediction", &transform_model_to_eigen::rotated_error_prediction)
-    .def("Rotated_error_prediction", &transform_model_to_eigen::Rotated_error_prediction);
+    .def("Rotated_error_prediction", &transform_model_to_eigen::Rotated_error_prediction)
+    .def("set_nominal_params", &transform_model_to_eigen::set_nominal_params)
+    .def(
+      "forward_trajectory_with_diff", &transform_model_to_eigen::forward_trajectory_with_diff);
   py::class_<transform_model_with_memory_to_eigen>(m, "transform_model_with_memory_to_eigen")
     .def(py::init())
     .def("set_params", &transform_model_with_memory_to_eigen::set_params)
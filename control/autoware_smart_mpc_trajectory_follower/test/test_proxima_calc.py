@@ -0,0 +1,132 @@
+# Copyright 2025 TIER IV, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Check the rollout of proxima_calc against the step functions of drive_functions."""
+
+from autoware_smart_mpc_trajectory_follower.scripts import drive_NN
+from autoware_smart_mpc_trajectory_follower.scripts import drive_functions
+import numpy as np
+import pytest
+import torch
+
+POLYNOMIAL_DEG = 2
+# number of features of the polynomial regression: 9 inputs and their products up to POLYNOMIAL_DEG
+POLYNOMIAL_DIM = 9 + 9 * 10 // 2
+RTOL = 1e-6
+ATOL = 1e-8
+
+
+def create_transform_model(
+    rng: np.random.Generator, zero_model: bool = False
+) -> drive_NN.transform_model_to_c:
+    """Randomly initialized trained model, or a model predicting no error at all."""
+    torch.manual_seed(int(rng.integers(1 << 31)))
+    model = drive_NN.DriveNeuralNetwork(randomize=0.1).to("cpu")
+    A_for_linear_reg = 0.01 * rng.standard_normal((drive_functions.nx_0, POLYNOMIAL_DIM))
+    b_for_linear_reg = 0.01 * rng.standard_normal(drive_functions.nx_0)
+    if zero_model:
+        with torch.no_grad():
+            for param in model.parameters():
+                param.zero_()
+        A_for_linear_reg[:] = 0.0
+        b_for_linear_reg[:] = 0.0
+    return drive_NN.transform_model_to_c(model, A_for_linear_reg, b_for_linear_reg, POLYNOMIAL_DEG)
+
+
+def create_problem(rng: np.random.Generator) -> tuple[np.ndarray, np.ndarray, np.ndarray]:
+    """Random current state with its input history, input sequence and previous error."""
+    nx = drive_functions.nx_0 + drive_functions.acc_ctrl_queue_size
+    nx += drive_functions.steer_ctrl_queue_size
+    x_current = np.zeros(nx)
+    x_current[:2] = rng.uniform(-10.0, 10.0, 2)
+    x_current[2] = rng.uniform(0.5, 10.0)
+    x_current[3] = rng.uniform(-np.pi, np.pi)
+    x_current[4] = rng.uniform(-1.0, 1.0)
+    x_current[5] = rng.uniform(-0.3, 0.3)
+    acc_start = drive_functions.nx_0
+    steer_start = acc_start + drive_functions.acc_ctrl_queue_size
+    x_current[acc_start:steer_start] = rng.uniform(-1.0, 1.0, drive_functions.acc_ctrl_queue_size)
+    x_current[steer_start:] = rng.uniform(-0.3, 0.3, drive_functions.steer_ctrl_queue_size)
+
+    inputs = np.zeros((drive_functions.N, drive_functions.nu_0))
+    inputs[:, 0] = rng.uniform(-1.0, 1.0, drive_functions.N)
+    inputs[:, 1] = rng.uniform(-0.1, 0.1, drive_functions.N)
+    previous_error = 0.1 * rng.standard_normal(drive_functions.nx_0 + 2)
+    return x_current, inputs, previous_error
+
+
+def python_forward_trajectory_with_diff(
+    transform_model: drive_NN.transform_model_to_c,
+    x_current: np.ndarray,
+    inputs: np.ndarray,
+    previous_error: np.ndarray,
+) -> tuple[np.ndarray, np.ndarray, np.ndarray, np.ndarray]:
+    """Per-step loop of drive_iLQR.calc_forward_trajectory_with_diff, before the filter of C."""
+    N = inputs.shape[0]
+    nx = x_current.shape[0]
+    traj = np.zeros((N + 1, nx))
+    traj[0] = x_current
+    A = np.zeros((N, nx, nx))
+    B = np.zeros((N, nx, drive_functions.nu_0))
+    C = np.zeros((N, drive_functions.nx_0, nx))
+    previous_error_ = previous_error.copy()
+    for k in range(N):
+        traj[k + 1], A[k], B[k], C[k], previous_error_ = drive_functions.F_with_model_diff(
+            traj[k], inputs[k], previous_error_, k, pred=transform_model.pred_with_diff
+        )
+    return traj, A, B, C
+
+
+@pytest.mark.parametrize("seed", range(5))
+def test_forward_trajectory_with_diff(seed: int):
+    rng = np.random.default_rng(seed)
+    transform_model = create_transform_model(rng)
+    x_current, inputs, previous_error = create_problem(rng)
+    N = inputs.shape[0]
+    nx = x_current.shape[0]
+
+    traj, A_stacked, B_stacked, C_stacked = transform_model.forward_trajectory_with_diff(
+        x_current, inputs, previous_error
+    )
+    expected_traj, expected_A, expected_B, expected_C = python_forward_trajectory_with_diff(
+        transform_model, x_current, inputs, previous_error
+    )
+
+    np.testing.assert_allclose(traj, expected_traj, rtol=RTOL, atol=ATOL)
+    np.testing.assert_allclose(A_stacked.reshape(N, nx, nx), expected_A, rtol=RTOL, atol=ATOL)
+    np.testing.assert_allclose(
+        B_stacked.reshape(N, nx, drive_functions.nu_0), expected_B, rtol=RTOL, atol=ATOL
+    )
+    np.testing.assert_allclose(
+        C_stacked.reshape(N, drive_functions.nx_0, nx), expected_C, rtol=RTOL, atol=ATOL
+    )
+
+
+@pytest.mark.parametrize("seed", range(5))
+def test_nominal_history_step_with_diff(seed: int):
+    """Without any predicted error, each step follows F_with_history_and_diff."""
+    rng = np.random.default_rng(seed)
+    transform_model = create_transform_model(rng, zero_model=True)
+    x_current, inputs, _ = create_problem(rng)
+    nx = x_current.shape[0]
+
+    traj, A_stacked, B_stacked, _ = transform_model.forward_trajectory_with_diff(
+        x_current, inputs, np.zeros(drive_functions.nx_0 + 2)
+    )
+    np.testing.assert_array_equal(traj[0], x_current)
+    for k in range(inputs.shape[0]):
+        states_next, dF_dx, dF_du, _ = drive_functions.F_with_history_and_diff(traj[k], inputs[k])
+        np.testing.assert_allclose(traj[k + 1], states_next, rtol=RTOL, atol=ATOL)
+        np.testing.assert_allclose(A_stacked[k * nx : (k + 1) * nx], dF_dx, rtol=RTOL, atol=ATOL)
+        np.testing.assert_allclose(B_stacked[k * nx : (k + 1) * nx], dF_du, rtol=RTOL, atol=ATOL)
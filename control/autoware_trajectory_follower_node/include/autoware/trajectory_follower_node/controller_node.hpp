@@ -19,6 +19,7 @@
 #include "autoware/trajectory_follower_base/lateral_controller_base.hpp"
 #include "autoware/trajectory_follower_base/longitudinal_controller_base.hpp"
 #include "autoware/trajectory_follower_node/visibility_control.hpp"
+#include "autoware/trajectory_follower_node/worker_thread.hpp"
 #include "autoware_utils/ros/logger_level_configure.hpp"
 #include "autoware_utils/ros/polling_subscriber.hpp"
 #include "autoware_utils/system/stop_watch.hpp"
@@ -79,6 +80,7 @@ private:
   rclcpp::TimerBase::SharedPtr timer_control_;
   double timeout_thr_sec_;
   bool enable_control_cmd_horizon_pub_{false};
+  bool enable_parallel_execution_{false};
   boost::optional<LongitudinalOutput> longitudinal_output_{boost::none};
 
   std::shared_ptr<diagnostic_updater::Updater> diag_updater_ =
@@ -88,6 +90,10 @@ private:
   std::shared_ptr<trajectory_follower::LongitudinalControllerBase> longitudinal_controller_;
   std::shared_ptr<trajectory_follower::LateralControllerBase> lateral_controller_;
 
+  // The longitudinal controller runs here while the lateral controller runs in the timer thread
+  // when enable_parallel_execution is true.
+  std::unique_ptr<WorkerThread> longitudinal_worker_;
+
   // Subscribers
   autoware_utils::InterProcessPollingSubscriber<autoware_planning_msgs::msg::Trajectory>
     sub_ref_path_{this, "~/input/reference_trajectory"};
@@ -108,6 +114,7 @@ private:
   rclcpp::Publisher<autoware_control_msgs::msg::Control>::SharedPtr control_cmd_pub_;
   rclcpp::Publisher<Float64Stamped>::SharedPtr pub_processing_time_lat_ms_;
   rclcpp::Publisher<Float64Stamped>::SharedPtr pub_processing_time_lon_ms_;
+  rclcpp::Publisher<Float64Stamped>::SharedPtr pub_processing_time_ms_;
   rclcpp::Publisher<visualization_msgs::msg::MarkerArray>::SharedPtr debug_marker_pub_;
   rclcpp::Publisher<autoware_control_msgs::msg::ControlHorizon>::SharedPtr control_cmd_horizon_pub_;
 
@@ -134,6 +141,12 @@ private:
   void callbackTimerControl();
   bool processData(rclcpp::Clock & clock);
   bool isTimeOut(const LongitudinalOutput & lon_out, const LateralOutput & lat_out);
+  /**
+   * @brief run the lateral and longitudinal controllers, concurrently if parallel execution is
+   * enabled, and publish the processing time of each controller
+   */
+  std::pair<LateralOutput, LongitudinalOutput> runControllers(
+    const trajectory_follower::InputData & input_data);
   LateralControllerMode getLateralControllerMode(const std::string & algorithm_name) const;
   LongitudinalControllerMode getLongitudinalControllerMode(
     const std::string & algorithm_name) const;
@@ -161,6 +174,8 @@ private:
   void publishProcessingTime(
     const double t_ms, const rclcpp::Publisher<Float64Stamped>::SharedPtr pub);
   StopWatch<std::chrono::milliseconds> stop_watch_;
+  // used only by the thread running the longitudinal controller
+  StopWatch<std::chrono::milliseconds> longitudinal_stop_watch_;
 
   static constexpr double logger_throttle_interval = 5000;
 };
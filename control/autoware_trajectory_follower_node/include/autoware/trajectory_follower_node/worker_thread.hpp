@@ -0,0 +1,98 @@
+// Copyright 2025 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__TRAJECTORY_FOLLOWER_NODE__WORKER_THREAD_HPP_
+#define AUTOWARE__TRAJECTORY_FOLLOWER_NODE__WORKER_THREAD_HPP_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace autoware::motion::control::trajectory_follower_node
+{
+/**
+ * @brief thread which is kept alive during the lifetime of the object and runs the posted tasks in
+ * order, so that no thread has to be created in the control loop
+ */
+class WorkerThread
+{
+public:
+  WorkerThread() : thread_([this]() { loop(); }) {}
+
+  ~WorkerThread()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      is_stopped_ = true;
+    }
+    cv_.notify_one();
+    thread_.join();
+  }
+
+  WorkerThread(const WorkerThread &) = delete;
+  WorkerThread & operator=(const WorkerThread &) = delete;
+
+  /**
+   * @brief run the task in the worker thread
+   * @param task callable without arguments
+   * @return future of the return value. An exception thrown in the task is rethrown by get().
+   */
+  template <typename F>
+  std::future<std::invoke_result_t<F>> post(F && task)
+  {
+    using ResultT = std::invoke_result_t<F>;
+    auto packaged_task = std::make_shared<std::packaged_task<ResultT()>>(std::forward<F>(task));
+    auto future = packaged_task->get_future();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tasks_.emplace_back([packaged_task]() { (*packaged_task)(); });
+    }
+    cv_.notify_one();
+    return future;
+  }
+
+private:
+  void loop()
+  {
+    while (true) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return is_stopped_ || !tasks_.empty(); });
+        if (tasks_.empty()) {
+          return;
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+      }
+      task();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::function<void()>> tasks_;
+  bool is_stopped_{false};
+  // NOTE: declared last so that the other members are initialized before the thread starts
+  std::thread thread_;
+};
+}  // namespace autoware::motion::control::trajectory_follower_node
+
+#endif  // AUTOWARE__TRAJECTORY_FOLLOWER_NODE__WORKER_THREAD_HPP_
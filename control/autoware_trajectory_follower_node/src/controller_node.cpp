@@ -61,6 +61,12 @@ Controller::Controller(const rclcpp::NodeOptions & node_options) : Node("control
   // So it is disabled by default.
   enable_control_cmd_horizon_pub_ =
     declare_parameter<bool>("enable_control_cmd_horizon_pub", false);
+  // Run the lateral and the longitudinal controllers concurrently. They only exchange data at the
+  // sync after both of them have finished, so the outputs are the same as the sequential run.
+  enable_parallel_execution_ = declare_parameter<bool>("enable_parallel_execution", false);
+  if (enable_parallel_execution_) {
+    longitudinal_worker_ = std::make_unique<WorkerThread>();
+  }
 
   diag_updater_->setHardwareID("trajectory_follower_node");
 
@@ -100,6 +106,7 @@ Controller::Controller(const rclcpp::NodeOptions & node_options) : Node("control
     create_publisher<Float64Stamped>("~/lateral/debug/processing_time_ms", 1);
   pub_processing_time_lon_ms_ =
     create_publisher<Float64Stamped>("~/longitudinal/debug/processing_time_ms", 1);
+  pub_processing_time_ms_ = create_publisher<Float64Stamped>("~/debug/processing_time_ms", 1);
   debug_marker_pub_ =
     create_publisher<visualization_msgs::msg::MarkerArray>("~/output/debug_marker", rclcpp::QoS{1});
 
@@ -226,17 +233,17 @@ void Controller::callbackTimerControl()
   }
 
   // 3. run controllers
-  stop_watch_.tic("lateral");
-  const auto lat_out = lateral_controller_->run(*input_data);
-  publishProcessingTime(stop_watch_.toc("lateral"), pub_processing_time_lat_ms_);
-
-  stop_watch_.tic("longitudinal");
-  const auto lon_out = longitudinal_controller_->run(*input_data);
-  publishProcessingTime(stop_watch_.toc("longitudinal"), pub_processing_time_lon_ms_);
+  stop_watch_.tic("total");
+  const auto [lat_out, lon_out] = runControllers(*input_data);
 
   // 4. sync with each other controllers
   longitudinal_controller_->sync(lat_out.sync_data);
   lateral_controller_->sync(lon_out.sync_data);
+  publishProcessingTime(stop_watch_.toc("total"), pub_processing_time_ms_);
+
+  // NOTE: The diagnostics are updated here instead of in each controller, since the status
+  // callbacks of one controller must not run while the other controller is running.
+  diag_updater_->force_update();
 
   // TODO(Horibe): Think specification. This comes from the old implementation.
   if (isTimeOut(lon_out, lat_out)) return;
@@ -260,6 +267,42 @@ void Controller::callbackTimerControl()
   }
 }
 
+std::pair<LateralOutput, LongitudinalOutput> Controller::runControllers(
+  const trajectory_follower::InputData & input_data)
+{
+  const auto run_longitudinal = [this, &input_data]() {
+    longitudinal_stop_watch_.tic("longitudinal");
+    auto lon_out = longitudinal_controller_->run(input_data);
+    publishProcessingTime(
+      longitudinal_stop_watch_.toc("longitudinal"), pub_processing_time_lon_ms_);
+    return lon_out;
+  };
+
+  if (!longitudinal_worker_) {
+    stop_watch_.tic("lateral");
+    auto lat_out = lateral_controller_->run(input_data);
+    publishProcessingTime(stop_watch_.toc("lateral"), pub_processing_time_lat_ms_);
+    auto lon_out = run_longitudinal();
+    return {std::move(lat_out), std::move(lon_out)};
+  }
+
+  auto lon_future = longitudinal_worker_->post(run_longitudinal);
+
+  stop_watch_.tic("lateral");
+  auto lat_out = [&]() {
+    try {
+      return lateral_controller_->run(input_data);
+    } catch (...) {
+      // the longitudinal controller still refers to input_data
+      lon_future.wait();
+      throw;
+    }
+  }();
+  publishProcessingTime(stop_watch_.toc("lateral"), pub_processing_time_lat_ms_);
+
+  return {std::move(lat_out), lon_future.get()};
+}
+
 void Controller::publishDebugMarker(
   const trajectory_follower::InputData & input_data,
   const trajectory_follower::LateralOutput & lat_out) const
@@ -47,7 +47,9 @@ using FakeNodeFixture = autoware::fake_test_node::FakeTestNode;
 
 const rclcpp::Duration one_second(1, 0);
 
-rclcpp::NodeOptions makeNodeOptions(const bool enable_keep_stopped_until_steer_convergence = false)
+rclcpp::NodeOptions makeNodeOptions(
+  const bool enable_keep_stopped_until_steer_convergence = false,
+  const bool enable_parallel_execution = false)
 {
   // Pass default parameter file to the node
   const auto share_dir =
@@ -62,6 +64,7 @@ rclcpp::NodeOptions makeNodeOptions(const bool enable_keep_stopped_until_steer_c
   node_options.append_parameter_override(
     "enable_keep_stopped_until_steer_convergence",
     enable_keep_stopped_until_steer_convergence);  // longitudinal
+  node_options.append_parameter_override("enable_parallel_execution", enable_parallel_execution);
   node_options.arguments(
     {"--ros-args", "--params-file",
      lateral_share_dir + "/param/lateral_controller_defaults.param.yaml", "--params-file",
@@ -258,6 +261,34 @@ TEST_F(FakeNodeFixture, straight_trajectory)
   EXPECT_GT(rclcpp::Time(tester.cmd_msg->stamp), rclcpp::Time(traj_msg.header.stamp));
 }
 
+TEST_F(FakeNodeFixture, straight_trajectory_parallel_execution)
+{
+  const auto node_options = makeNodeOptions(false, true);
+  ControllerTester tester(this, node_options);
+
+  tester.send_default_transform();
+  tester.publish_odom_vx(1.0);
+  tester.publish_autonomous_operation_mode();
+  tester.publish_default_steer();
+  tester.publish_default_acc();
+
+  Trajectory traj_msg;
+  traj_msg.header.stamp = tester.node->now();
+  traj_msg.header.frame_id = "map";
+  traj_msg.points.push_back(make_traj_point(-1.0, 0.0, 1.0f));
+  traj_msg.points.push_back(make_traj_point(0.0, 0.0, 1.0f));
+  traj_msg.points.push_back(make_traj_point(1.0, 0.0, 1.0f));
+  traj_msg.points.push_back(make_traj_point(2.0, 0.0, 1.0f));
+  tester.traj_pub->publish(traj_msg);
+
+  test_utils::waitForMessage(tester.node, this, tester.received_control_command);
+  ASSERT_TRUE(tester.received_control_command);
+  EXPECT_EQ(tester.cmd_msg->lateral.steering_tire_angle, 0.0f);
+  EXPECT_EQ(tester.cmd_msg->lateral.steering_tire_rotation_rate, 0.0f);
+  EXPECT_GT(tester.cmd_msg->longitudinal.velocity, 0.0f);
+  EXPECT_GT(rclcpp::Time(tester.cmd_msg->stamp), rclcpp::Time(traj_msg.header.stamp));
+}
+
 TEST_F(FakeNodeFixture, right_turn)
 {
   const auto node_options = makeNodeOptions();
@@ -43,6 +43,16 @@ double calcLateralDeviation(const std::vector<Pose> & ref_path, const Pose & tar
  */
 double calcYawDeviation(const std::vector<Pose> & ref_path, const Pose & target_pose);
 
+/**
+ * @brief calculate the 2d distance between each pose and the reference pose of the same index
+ * @param [in] poses poses, e.g. of a predicted path
+ * @param [in] ref_poses reference poses of the same size, e.g. of the history path
+ * @param [out] deviations calculated distances, resized to the number of poses
+ */
+void calcPoseDeviations(
+  const std::vector<Pose> & poses, const std::vector<Pose> & ref_poses,
+  std::vector<double> & deviations);
+
 }  // namespace metrics
 }  // namespace autoware::perception_diagnostics
 
@@ -18,6 +18,7 @@
 #include "autoware/perception_online_evaluator/metrics/detection_count.hpp"
 #include "autoware/perception_online_evaluator/metrics/deviation_metrics.hpp"
 #include "autoware/perception_online_evaluator/metrics/metric.hpp"
+#include "autoware/perception_online_evaluator/object_history.hpp"
 #include "autoware/perception_online_evaluator/parameters.hpp"
 #include "autoware/perception_online_evaluator/utils/objects_filtering.hpp"
 #include "tf2_ros/buffer.h"
@@ -30,7 +31,6 @@
 #include <unique_identifier_msgs/msg/uuid.hpp>
 
 #include <algorithm>
-#include <map>
 #include <memory>
 #include <optional>
 #include <string>
@@ -78,10 +78,6 @@ using ObjectDataMap = std::unordered_map<std::string, ObjectData>;
 using HistoryPathMap =
   std::unordered_map<std::string, std::pair<std::vector<Pose>, std::vector<Pose>>>;
 
-using StampObjectMap = std::map<rclcpp::Time, PredictedObject>;
-using StampObjectMapIterator = std::map<rclcpp::Time, PredictedObject>::const_iterator;
-using ObjectMap = std::unordered_map<std::string, StampObjectMap>;
-
 class MetricsCalculator
 {
 public:
@@ -106,14 +102,14 @@ public:
 
   void updateObjectsCountMap(const PredictedObjects & objects, const tf2_ros::Buffer & tf_buffer);
 
-  HistoryPathMap getHistoryPathMap() const { return history_path_map_; }
-  ObjectDataMap getDebugObjectData() const { return debug_target_object_; }
+  const HistoryPathMap & getHistoryPathMap() const { return history_path_map_; }
+  const ObjectDataMap & getDebugObjectData() const { return debug_target_object_; }
 
 private:
   std::shared_ptr<Parameters> parameters_;
 
   // Store predicted objects information and calculation results
-  ObjectMap object_map_;
+  ObjectHistory object_history_;
   HistoryPathMap history_path_map_;
 
   rclcpp::Time current_stamp_;
@@ -131,8 +127,6 @@ private:
     const std::vector<Pose> & prev_history_path, const Pose & new_pose, const size_t window_size);
 
   // Update object data
-  void updateObjects(
-    const std::string uuid, const rclcpp::Time stamp, const PredictedObject & object);
   void deleteOldObjects(const rclcpp::Time stamp);
 
   // Calculate metrics
@@ -145,17 +139,14 @@ private:
   MetricValueMap calcObjectsCountMetrics() const;
 
   bool hasPassedTime(const rclcpp::Time stamp) const;
-  bool hasPassedTime(const std::string uuid, const rclcpp::Time stamp) const;
+  bool hasPassedTime(const ObjectHistory::TrackId track, const rclcpp::Time stamp) const;
   double getTimeDelay() const;
 
   // Extract object
-  rclcpp::Time getClosestStamp(const rclcpp::Time stamp) const;
-  std::optional<StampObjectMapIterator> getClosestObjectIterator(
-    const std::string & uuid, const rclcpp::Time & stamp) const;
-  std::optional<PredictedObject> getObjectByStamp(
-    const std::string uuid, const rclcpp::Time stamp) const;
-  std::optional<std::pair<rclcpp::Time, PredictedObject>> getPreviousObjectByStamp(
-    const std::string uuid, const rclcpp::Time stamp) const;
+  const PredictedObject * getObjectByStamp(
+    const ObjectHistory::TrackId track, const rclcpp::Time stamp) const;
+  std::optional<std::pair<rclcpp::Time, const PredictedObject *>> getPreviousObjectByStamp(
+    const ObjectHistory::TrackId track, const rclcpp::Time stamp) const;
   PredictedObjects getObjectsByStamp(const rclcpp::Time stamp) const;
 
 };  // class MetricsCalculator
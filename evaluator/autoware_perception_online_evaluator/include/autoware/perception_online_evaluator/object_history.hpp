@@ -0,0 +1,139 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__PERCEPTION_ONLINE_EVALUATOR__OBJECT_HISTORY_HPP_
+#define AUTOWARE__PERCEPTION_ONLINE_EVALUATOR__OBJECT_HISTORY_HPP_
+
+#include <rclcpp/time.hpp>
+
+#include "autoware_perception_msgs/msg/predicted_object.hpp"
+
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace autoware::perception_diagnostics
+{
+using autoware_perception_msgs::msg::PredictedObject;
+
+/**
+ * @brief History of the predicted objects, stored frame by frame.
+ * @details Each frame stores its stamp and its objects contiguously. The uuid of an object is
+ * interned into a track, which holds the slot of the object in every frame since its first
+ * appearance, so that the object of a track in a frame is found in constant time. Frames are
+ * indexed from the oldest one, the indices are valid until the next deletion.
+ */
+class ObjectHistory
+{
+public:
+  using TrackId = size_t;
+
+  /**
+   * @brief add the objects of a frame, replacing the objects of the same uuid at the same stamp
+   * @param [in] stamp stamp of the frame, must not be older than the latest frame
+   * @param [in] objects objects of the frame, a frame without objects is not stored
+   */
+  void addFrame(const rclcpp::Time & stamp, const std::vector<PredictedObject> & objects);
+
+  /**
+   * @brief delete the frames older than the stamp, and the tracks left without objects
+   * @param [in] stamp oldest stamp to keep
+   * @return uuids of the deleted tracks
+   */
+  std::vector<std::string> deleteFramesBefore(const rclcpp::Time & stamp);
+
+  /**
+   * @brief delete all the frames and tracks
+   */
+  void clear();
+
+  bool empty() const { return frame_stamps_.empty(); }
+  size_t size() const { return frame_stamps_.size(); }
+
+  /**
+   * @brief find the frame whose stamp is the closest to the given one, in a non-empty history
+   */
+  size_t findClosestFrame(const rclcpp::Time & stamp) const;
+  rclcpp::Time getFrameStamp(const size_t frame) const;
+  const std::vector<PredictedObject> & getFrameObjects(const size_t frame) const;
+  rclcpp::Time getOldestStamp() const { return getFrameStamp(0); }
+  rclcpp::Time getLatestStamp() const { return getFrameStamp(size() - 1); }
+
+  /**
+   * @brief get the tracks by uuid
+   */
+  const std::unordered_map<std::string, TrackId> & getTracks() const { return track_ids_; }
+  std::optional<TrackId> findTrack(const std::string & uuid) const;
+
+  /**
+   * @brief get the frame where the track appeared first
+   */
+  size_t getFirstFrame(const TrackId track) const;
+
+  /**
+   * @brief get the object of the track in the frame
+   * @return pointer to the object, or nullptr if the track has no object in the frame
+   */
+  const PredictedObject * findObject(const TrackId track, const size_t frame) const;
+
+  /**
+   * @brief find the latest frame before the given one where the track has an object
+   */
+  std::optional<size_t> findPreviousFrame(const TrackId track, const size_t frame) const;
+
+  /**
+   * @brief find the first frame from the given one where the track has an object
+   */
+  std::optional<size_t> findNextFrame(const TrackId track, const size_t frame) const;
+
+  /**
+   * @brief get the stamps and the objects of a track, from the oldest one
+   * @param [in] track track
+   * @param [out] objects stamps and objects, the pointers are valid until the history is modified
+   */
+  void getTrackObjects(
+    const TrackId track,
+    std::vector<std::pair<rclcpp::Time, const PredictedObject *>> & objects) const;
+
+private:
+  struct Track
+  {
+    std::string uuid;
+    uint64_t first_sequence{0};
+    std::deque<uint32_t> slots;  // slot in each frame from first_sequence, or absent_slot
+  };
+
+  static constexpr uint32_t absent_slot = UINT32_MAX;
+
+  TrackId internTrack(const std::string & uuid);
+
+  // Frames, stored column by column
+  std::deque<int64_t> frame_stamps_;
+  std::deque<std::vector<PredictedObject>> frame_objects_;
+  std::deque<std::vector<TrackId>> frame_tracks_;
+  uint64_t first_sequence_{0};  // sequence number of the oldest frame
+
+  // Tracks, the ids of the deleted tracks are reused
+  std::vector<Track> tracks_;
+  std::vector<TrackId> free_tracks_;
+  std::unordered_map<std::string, TrackId> track_ids_;
+};
+
+}  // namespace autoware::perception_diagnostics
+
+#endif  // AUTOWARE__PERCEPTION_ONLINE_EVALUATOR__OBJECT_HISTORY_HPP_
@@ -19,6 +19,7 @@
 
 #include <autoware/motion_utils/trajectory/trajectory.hpp>
 
+#include <cmath>
 #include <vector>
 
 namespace autoware::perception_diagnostics
@@ -49,5 +50,17 @@ double calcYawDeviation(const std::vector<Pose> & ref_path, const Pose & target_
   return std::abs(autoware_utils::calc_yaw_deviation(ref_path[nearest_index], target_pose));
 }
 
+void calcPoseDeviations(
+  const std::vector<Pose> & poses, const std::vector<Pose> & ref_poses,
+  std::vector<double> & deviations)
+{
+  deviations.resize(poses.size());
+  for (size_t i = 0; i < poses.size(); ++i) {
+    const auto & p = poses[i].position;
+    const auto & q = ref_poses[i].position;
+    deviations[i] = std::hypot(p.x - q.x, p.y - q.y);
+  }
+}
+
 }  // namespace metrics
 }  // namespace autoware::perception_diagnostics
@@ -37,7 +37,7 @@ std::optional<MetricsMap> MetricsCalculator::calculate(const Metric & metric) co
 
   // todo(kosuke55): todo separate function and add timestamp of checked objects to diagnostics
   if (use_past_objects) {
-    if (object_map_.empty()) {
+    if (object_history_.empty()) {
       return {};
     }
     // time delay is max element of parameters_->prediction_time_horizons
@@ -92,136 +92,62 @@ double MetricsCalculator::getTimeDelay() const
   throw std::runtime_error("prediction_time_horizons is empty");
 }
 
-bool MetricsCalculator::hasPassedTime(const std::string uuid, const rclcpp::Time stamp) const
+bool MetricsCalculator::hasPassedTime(
+  const ObjectHistory::TrackId track, const rclcpp::Time stamp) const
 {
-  if (object_map_.find(uuid) == object_map_.end()) {
-    return false;
-  }
-  const auto oldest_stamp = object_map_.at(uuid).begin()->first;
+  const auto oldest_stamp = object_history_.getFrameStamp(object_history_.getFirstFrame(track));
   return oldest_stamp <= stamp;
 }
 
 bool MetricsCalculator::hasPassedTime(const rclcpp::Time stamp) const
 {
-  std::vector<rclcpp::Time> timestamps;
-  for (const auto & [uuid, stamp_and_objects] : object_map_) {
-    if (!stamp_and_objects.empty()) {
-      timestamps.push_back(stamp_and_objects.begin()->first);
-    }
-  }
-
-  auto it = std::min_element(timestamps.begin(), timestamps.end());
-  if (it != timestamps.end()) {
-    rclcpp::Time oldest_stamp = *it;
-    if (oldest_stamp > stamp) {
-      return false;
-    }
-  }
-  return true;
-}
-
-rclcpp::Time MetricsCalculator::getClosestStamp(const rclcpp::Time stamp) const
-{
-  rclcpp::Time closest_stamp;
-  rclcpp::Duration min_duration =
-    rclcpp::Duration::from_nanoseconds(std::numeric_limits<int64_t>::max());
-
-  for (const auto & [uuid, stamp_and_objects] : object_map_) {
-    if (!stamp_and_objects.empty()) {
-      auto it = std::lower_bound(
-        stamp_and_objects.begin(), stamp_and_objects.end(), stamp,
-        [](const auto & pair, const rclcpp::Time & val) { return pair.first < val; });
-
-      // check the upper bound
-      if (it != stamp_and_objects.end()) {
-        const auto duration = it->first - stamp;
-        if (std::abs(duration.nanoseconds()) < min_duration.nanoseconds()) {
-          min_duration = duration;
-          closest_stamp = it->first;
-        }
-      }
-
-      // check the lower bound (if it is not the first element)
-      if (it != stamp_and_objects.begin()) {
-        const auto prev_it = std::prev(it);
-        const auto duration = stamp - prev_it->first;
-        if (std::abs(duration.nanoseconds()) < min_duration.nanoseconds()) {
-          min_duration = duration;
-          closest_stamp = prev_it->first;
-        }
-      }
-    }
-  }
-
-  return closest_stamp;
-}
-
-std::optional<StampObjectMapIterator> MetricsCalculator::getClosestObjectIterator(
-  const std::string & uuid, const rclcpp::Time & stamp) const
-{
-  const auto closest_stamp = getClosestStamp(stamp);
-  const auto it = std::lower_bound(
-    object_map_.at(uuid).begin(), object_map_.at(uuid).end(), closest_stamp,
-    [](const auto & pair, const rclcpp::Time & val) { return pair.first < val; });
-
-  return it != object_map_.at(uuid).end() ? std::optional<StampObjectMapIterator>(it)
-                                          : std::nullopt;
+  return object_history_.empty() || object_history_.getOldestStamp() <= stamp;
 }
 
-std::optional<PredictedObject> MetricsCalculator::getObjectByStamp(
-  const std::string uuid, const rclcpp::Time stamp) const
+const PredictedObject * MetricsCalculator::getObjectByStamp(
+  const ObjectHistory::TrackId track, const rclcpp::Time stamp) const
 {
   constexpr double eps = 0.01;
   constexpr double close_time_threshold = 0.1;
 
-  const auto obj_it_opt = getClosestObjectIterator(uuid, stamp);
-  if (obj_it_opt.has_value()) {
-    const auto it = obj_it_opt.value();
-    if (std::abs((it->first - getClosestStamp(stamp)).seconds()) < eps) {
-      const double time_diff = std::abs((it->first - stamp).seconds());
+  // The object at the closest stamp, or at a later stamp close to it
+  const size_t closest_frame = object_history_.findClosestFrame(stamp);
+  const auto frame_opt = object_history_.findNextFrame(track, closest_frame);
+  if (frame_opt.has_value()) {
+    const auto frame_stamp = object_history_.getFrameStamp(frame_opt.value());
+    if (std::abs((frame_stamp - object_history_.getFrameStamp(closest_frame)).seconds()) < eps) {
+      const double time_diff = std::abs((frame_stamp - stamp).seconds());
       if (time_diff < close_time_threshold) {
-        return it->second;
+        return object_history_.findObject(track, frame_opt.value());
       }
     }
   }
-  return std::nullopt;
+  return nullptr;
 }
 
-std::optional<std::pair<rclcpp::Time, PredictedObject>> MetricsCalculator::getPreviousObjectByStamp(
-  const std::string uuid, const rclcpp::Time stamp) const
+std::optional<std::pair<rclcpp::Time, const PredictedObject *>>
+MetricsCalculator::getPreviousObjectByStamp(
+  const ObjectHistory::TrackId track, const rclcpp::Time stamp) const
 {
-  const auto obj_it_opt = getClosestObjectIterator(uuid, stamp);
-  if (obj_it_opt.has_value()) {
-    auto it = obj_it_opt.value();
-    if (it != object_map_.at(uuid).begin()) {
-      // If it is exactly the closest stamp, move one back to get the previous
-      if (it->first == getClosestStamp(stamp)) {
-        --it;
-      } else {
-        // If it is not the closest stamp, it already points to the previous one due to lower_bound
-      }
-      return std::make_pair(it->first, it->second);
-    }
+  const size_t closest_frame = object_history_.findClosestFrame(stamp);
+  auto frame_opt = object_history_.findNextFrame(track, closest_frame);
+  if (!frame_opt.has_value() || frame_opt.value() == object_history_.getFirstFrame(track)) {
+    return std::nullopt;
+  }
+  // If it is exactly the closest stamp, move one back to get the previous
+  if (frame_opt.value() == closest_frame) {
+    frame_opt = object_history_.findPreviousFrame(track, closest_frame);
   }
-  return std::nullopt;
+  const size_t frame = frame_opt.value();
+  return std::make_pair(
+    object_history_.getFrameStamp(frame), object_history_.findObject(track, frame));
 }
 
 PredictedObjects MetricsCalculator::getObjectsByStamp(const rclcpp::Time stamp) const
 {
-  const auto closest_stamp = getClosestStamp(stamp);
-
   PredictedObjects objects;
   objects.header.stamp = stamp;
-  for (const auto & [uuid, stamp_and_objects] : object_map_) {
-    auto it = std::lower_bound(
-      stamp_and_objects.begin(), stamp_and_objects.end(), closest_stamp,
-      [](const auto & pair, const rclcpp::Time & val) { return pair.first < val; });
-
-    // add the object only if the element pointed to by lower_bound is equal to stamp
-    if (it != stamp_and_objects.end() && it->first == closest_stamp) {
-      objects.objects.push_back(it->second);
-    }
-  }
+  objects.objects = object_history_.getFrameObjects(object_history_.findClosestFrame(stamp));
   return objects;
 }
 
@@ -239,11 +165,12 @@ MetricStatMap MetricsCalculator::calcLateralDeviationMetrics(
     const auto stamp = rclcpp::Time(objects.header.stamp);
     for (const auto & object : objects.objects) {
       const auto uuid = autoware_utils::to_hex_string(object.object_id);
-      if (!hasPassedTime(uuid, stamp)) {
+      const auto track = object_history_.findTrack(uuid);
+      if (!track.has_value() || !hasPassedTime(track.value(), stamp)) {
         continue;
       }
-      const auto object_pose = object.kinematics.initial_pose_with_covariance.pose;
-      const auto history_path = history_path_map_.at(uuid).second;
+      const auto & object_pose = object.kinematics.initial_pose_with_covariance.pose;
+      const auto & history_path = history_path_map_.at(uuid).second;
       if (history_path.empty()) {
         continue;
       }
@@ -268,11 +195,12 @@ MetricStatMap MetricsCalculator::calcYawDeviationMetrics(
     const auto stamp = rclcpp::Time(objects.header.stamp);
     for (const auto & object : objects.objects) {
       const auto uuid = autoware_utils::to_hex_string(object.object_id);
-      if (!hasPassedTime(uuid, stamp)) {
+      const auto track = object_history_.findTrack(uuid);
+      if (!track.has_value() || !hasPassedTime(track.value(), stamp)) {
         continue;
       }
-      const auto object_pose = object.kinematics.initial_pose_with_covariance.pose;
-      const auto history_path = history_path_map_.at(uuid).second;
+      const auto & object_pose = object.kinematics.initial_pose_with_covariance.pose;
+      const auto & history_path = history_path_map_.at(uuid).second;
       if (history_path.empty()) {
         continue;
       }
@@ -314,100 +242,87 @@ MetricStatMap MetricsCalculator::calcPredictedPathDeviationMetrics(
 PredictedPathDeviationMetrics MetricsCalculator::calcPredictedPathDeviationMetrics(
   const PredictedObjects & objects, const double time_horizon) const
 {
-  // Step 1: For each object and its predicted paths, calculate the deviation between each predicted
-  // path pose and the corresponding historical path pose. Store the deviations in
-  // deviation_map_for_paths.
-  std::unordered_map<std::string, std::unordered_map<size_t, std::vector<double>>>
-    deviation_map_for_paths;
+  PredictedPathDeviationMetrics metrics;
 
-  // For debugging: Save the pairs of predicted path pose and history path pose.
-  std::unordered_map<std::string, std::vector<std::pair<Pose, Pose>>>
-    debug_predicted_path_pairs_map;
+  // Buffers reused between the paths, the poses of a path and of its history are contiguous
+  std::vector<Pose> predicted_poses;
+  std::vector<Pose> history_poses;
+  std::vector<double> deviations;
+  std::vector<Pose> min_predicted_poses;
+  std::vector<Pose> min_history_poses;
+  std::vector<double> min_deviations;
 
-  const auto stamp = objects.header.stamp;
+  const rclcpp::Time stamp = objects.header.stamp;
   for (const auto & object : objects.objects) {
     const auto uuid = autoware_utils::to_hex_string(object.object_id);
-    const auto predicted_paths = object.kinematics.predicted_paths;
-    for (size_t i = 0; i < predicted_paths.size(); i++) {
-      const auto predicted_path = predicted_paths[i];
-      const std::string path_id = uuid + "_" + std::to_string(i);
+    const auto track_opt = object_history_.findTrack(uuid);
+    if (!track_opt.has_value()) {
+      continue;
+    }
+    const auto track = track_opt.value();
+
+    // Step 1: For each predicted path, calculate the deviation between each predicted path pose
+    // and the history pose at the same time. Keep the path with the smallest mean deviation.
+    std::optional<double> min_mean_deviation;
+    for (const auto & predicted_path : object.kinematics.predicted_paths) {
+      predicted_poses.clear();
+      history_poses.clear();
+      const double time_step = rclcpp::Duration(predicted_path.time_step).seconds();
       for (size_t j = 0; j < predicted_path.path.size(); j++) {
-        const double time_duration =
-          rclcpp::Duration(predicted_path.time_step).seconds() * static_cast<double>(j);
+        const double time_duration = time_step * static_cast<double>(j);
         if (time_duration > time_horizon) {
           break;
         }
-        const rclcpp::Time target_stamp =
-          rclcpp::Time(stamp) + rclcpp::Duration::from_seconds(time_duration);
-        if (!hasPassedTime(uuid, target_stamp)) {
+        const rclcpp::Time target_stamp = stamp + rclcpp::Duration::from_seconds(time_duration);
+        if (!hasPassedTime(track, target_stamp)) {
           continue;
         }
-        const auto history_object_opt = getObjectByStamp(uuid, target_stamp);
-        if (!history_object_opt.has_value()) {
+        const auto history_object = getObjectByStamp(track, target_stamp);
+        if (history_object == nullptr) {
           continue;
         }
-        const auto history_object = history_object_opt.value();
-        const auto history_pose = history_object.kinematics.initial_pose_with_covariance.pose;
-        const Pose & p = predicted_path.path[j];
-        const double distance = autoware_utils::calc_distance2d(p.position, history_pose.position);
-        deviation_map_for_paths[uuid][i].push_back(distance);
-
-        // Save debug information
-        debug_predicted_path_pairs_map[path_id].push_back(std::make_pair(p, history_pose));
+        predicted_poses.push_back(predicted_path.path[j]);
+        history_poses.push_back(history_object->kinematics.initial_pose_with_covariance.pose);
       }
-    }
-  }
-
-  // Step 2: For each object, select the predicted path with the smallest mean deviation.
-  // Store the selected path's deviations in deviation_map_for_objects.
-  std::unordered_map<std::string, std::vector<double>> deviation_map_for_objects;
-  for (const auto & [uuid, deviation_map] : deviation_map_for_paths) {
-    std::optional<std::pair<size_t, double>> min_deviation;
-    for (const auto & [i, deviations] : deviation_map) {
-      if (deviations.empty()) {
+      if (predicted_poses.empty()) {
         continue;
       }
-      const double sum = std::accumulate(deviations.begin(), deviations.end(), 0.0);
-      const double mean = sum / deviations.size();
-      if (!min_deviation.has_value() || mean < min_deviation.value().second) {
-        min_deviation = std::make_pair(i, mean);
+
+      metrics::calcPoseDeviations(predicted_poses, history_poses, deviations);
+      const double mean =
+        std::accumulate(deviations.begin(), deviations.end(), 0.0) / deviations.size();
+      if (!min_mean_deviation.has_value() || mean < min_mean_deviation.value()) {
+        min_mean_deviation = mean;
+        std::swap(min_predicted_poses, predicted_poses);
+        std::swap(min_history_poses, history_poses);
+        std::swap(min_deviations, deviations);
       }
     }
 
-    if (!min_deviation.has_value()) {
+    if (!min_mean_deviation.has_value()) {
       continue;
     }
 
     // Save the delayed target object and the corresponding predicted path for debugging
-    const auto [min_deviation_index, min_mean_deviation] = min_deviation.value();
-    deviation_map_for_objects[uuid] = deviation_map.at(min_deviation_index);
-    const auto path_id = uuid + "_" + std::to_string(min_deviation_index);
-    const auto target_stamp_object = getObjectByStamp(uuid, stamp);
-    if (target_stamp_object.has_value()) {
+    const auto target_stamp_object = getObjectByStamp(track, stamp);
+    if (target_stamp_object != nullptr) {
       ObjectData object_data;
-      object_data.object = target_stamp_object.value();
-      object_data.path_pairs = debug_predicted_path_pairs_map[path_id];
-      debug_target_object_[uuid] = object_data;
-    }
-  }
-
-  // Step 3: Calculate the mean and variance of the deviations for each object's selected predicted
-  // path. Store the results in the PredictedPathDeviationMetrics structure.
-  PredictedPathDeviationMetrics metrics;
-  for (const auto & [object_id, object_path_deviations] : deviation_map_for_objects) {
-    if (!object_path_deviations.empty()) {
-      const double sum_of_deviations =
-        std::accumulate(object_path_deviations.begin(), object_path_deviations.end(), 0.0);
-      const double mean_deviation = sum_of_deviations / object_path_deviations.size();
-      metrics.mean.add(mean_deviation);
-      double sum_of_squared_deviations = 0.0;
-      for (const auto path_point_deviation : object_path_deviations) {
-        sum_of_squared_deviations += std::pow(path_point_deviation - mean_deviation, 2);
+      object_data.object = *target_stamp_object;
+      object_data.path_pairs.reserve(min_predicted_poses.size());
+      for (size_t i = 0; i < min_predicted_poses.size(); ++i) {
+        object_data.path_pairs.emplace_back(min_predicted_poses[i], min_history_poses[i]);
       }
-      const double variance_deviation = sum_of_squared_deviations / object_path_deviations.size();
+      debug_target_object_[uuid] = std::move(object_data);
+    }
 
-      metrics.variance.add(variance_deviation);
+    // Step 2: Calculate the mean and variance of the deviations of the selected predicted path.
+    const double mean_deviation = min_mean_deviation.value();
+    metrics.mean.add(mean_deviation);
+    double sum_of_squared_deviations = 0.0;
+    for (const auto path_point_deviation : min_deviations) {
+      sum_of_squared_deviations += std::pow(path_point_deviation - mean_deviation, 2);
     }
+    metrics.variance.add(sum_of_squared_deviations / min_deviations.size());
   }
 
   return metrics;
@@ -423,15 +338,15 @@ MetricStatMap MetricsCalculator::calcYawRateMetrics(const ClassObjectsMap & clas
     const auto stamp = rclcpp::Time(objects.header.stamp);
 
     for (const auto & object : objects.objects) {
-      const auto uuid = autoware_utils::to_hex_string(object.object_id);
-      if (!hasPassedTime(uuid, stamp)) {
+      const auto track = object_history_.findTrack(autoware_utils::to_hex_string(object.object_id));
+      if (!track.has_value() || !hasPassedTime(track.value(), stamp)) {
         continue;
       }
-      const auto previous_object_with_stamp_opt = getPreviousObjectByStamp(uuid, stamp);
+      const auto previous_object_with_stamp_opt = getPreviousObjectByStamp(track.value(), stamp);
       if (!previous_object_with_stamp_opt.has_value()) {
         continue;
       }
-      const auto [previous_stamp, previous_object] = previous_object_with_stamp_opt.value();
+      const auto & [previous_stamp, previous_object] = previous_object_with_stamp_opt.value();
 
       const double time_diff = (stamp - previous_stamp).seconds();
       if (time_diff < 0.01) {
@@ -440,7 +355,7 @@ MetricStatMap MetricsCalculator::calcYawRateMetrics(const ClassObjectsMap & clas
       const double current_yaw =
         tf2::getYaw(object.kinematics.initial_pose_with_covariance.pose.orientation);
       const double previous_yaw =
-        tf2::getYaw(previous_object.kinematics.initial_pose_with_covariance.pose.orientation);
+        tf2::getYaw(previous_object->kinematics.initial_pose_with_covariance.pose.orientation);
       // Calculate the absolute difference between current_yaw and previous_yaw
       const double yaw_diff =
         std::abs(autoware_utils::normalize_radian(current_yaw - previous_yaw));
@@ -493,11 +408,13 @@ void MetricsCalculator::setPredictedObjects(
 
   // store objects to check deviation
   {
-    using autoware_utils::to_hex_string;
-    for (const auto & object : objects.objects) {
-      std::string uuid = to_hex_string(object.object_id);
-      updateObjects(uuid, current_stamp_, object);
+    // the history is restarted when the time jumps back, e.g. when a rosbag is replayed again
+    if (!object_history_.empty() && current_stamp_ < object_history_.getLatestStamp()) {
+      object_history_.clear();
+      history_path_map_.clear();
+      debug_target_object_.clear();
     }
+    object_history_.addFrame(current_stamp_, objects.objects);
     deleteOldObjects(current_stamp_);
     updateHistoryPath();
   }
@@ -510,51 +427,37 @@ void MetricsCalculator::deleteOldObjects(const rclcpp::Time stamp)
 {
   // delete the data older than 2*time_delay_
   const double time_delay = getTimeDelay();
-  for (auto & [uuid, stamp_and_objects] : object_map_) {
-    for (auto it = stamp_and_objects.begin(); it != stamp_and_objects.end();) {
-      if (it->first < stamp - rclcpp::Duration::from_seconds(time_delay * 2)) {
-        it = stamp_and_objects.erase(it);
-      } else {
-        break;
-      }
-    }
+  const auto deleted_uuids =
+    object_history_.deleteFramesBefore(stamp - rclcpp::Duration::from_seconds(time_delay * 2));
+  for (const auto & uuid : deleted_uuids) {
+    history_path_map_.erase(uuid);
+    debug_target_object_.erase(uuid);  // debug
   }
-
-  const auto object_map = object_map_;
-  for (const auto & [uuid, stamp_and_objects] : object_map) {
-    if (stamp_and_objects.empty()) {
-      object_map_.erase(uuid);
-      history_path_map_.erase(uuid);
-      debug_target_object_.erase(uuid);  // debug
-    }
-  }
-}
-
-void MetricsCalculator::updateObjects(
-  const std::string uuid, const rclcpp::Time stamp, const PredictedObject & object)
-{
-  object_map_[uuid][stamp] = object;
 }
 
 void MetricsCalculator::updateHistoryPath()
 {
   const double window_size = parameters_->smoothing_window_size;
 
-  for (const auto & [uuid, stamp_and_objects] : object_map_) {
+  std::vector<std::pair<rclcpp::Time, const PredictedObject *>> stamp_and_objects;
+  for (const auto & [uuid, track] : object_history_.getTracks()) {
+    object_history_.getTrackObjects(track, stamp_and_objects);
     std::vector<Pose> history_path;
     for (auto it = stamp_and_objects.begin(); it != stamp_and_objects.end(); ++it) {
-      const auto & [stamp, object] = *it;
+      const auto & stamp = it->first;
+      const auto & object = *it->second;
 
       // skip if the object is stopped
       // calculate velocity from previous object
       if (it != stamp_and_objects.begin()) {
-        const auto & [prev_stamp, prev_object] = *std::prev(it);
+        const auto & prev_stamp = std::prev(it)->first;
+        const auto & prev_object = *std::prev(it)->second;
         const double time_diff = (stamp - prev_stamp).seconds();
         if (time_diff < 0.01) {
           continue;
         }
-        const auto current_pose = object.kinematics.initial_pose_with_covariance.pose;
-        const auto prev_pose = prev_object.kinematics.initial_pose_with_covariance.pose;
+        const auto & current_pose = object.kinematics.initial_pose_with_covariance.pose;
+        const auto & prev_pose = prev_object.kinematics.initial_pose_with_covariance.pose;
         const auto velocity =
           autoware_utils::calc_distance2d(current_pose.position, prev_pose.position) / time_diff;
         if (velocity < parameters_->stopped_velocity_threshold) {
@@ -574,8 +477,9 @@ void MetricsCalculator::updateHistoryPath()
 
     // pair of history_path(raw) and smoothed_history_path
     // history_path(raw) is just for debugging
+    auto smoothed_history_path = averageFilterPath(history_path, window_size);
     history_path_map_[uuid] =
-      std::make_pair(history_path, averageFilterPath(history_path, window_size));
+      std::make_pair(std::move(history_path), std::move(smoothed_history_path));
   }
 }
 
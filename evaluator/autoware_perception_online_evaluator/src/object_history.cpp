@@ -0,0 +1,213 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/perception_online_evaluator/object_history.hpp"
+
+#include <autoware_utils/ros/uuid_helper.hpp>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::perception_diagnostics
+{
+
+ObjectHistory::TrackId ObjectHistory::internTrack(const std::string & uuid)
+{
+  const auto it = track_ids_.find(uuid);
+  if (it != track_ids_.end()) {
+    return it->second;
+  }
+  TrackId track_id = tracks_.size();
+  if (free_tracks_.empty()) {
+    tracks_.emplace_back();
+  } else {
+    track_id = free_tracks_.back();
+    free_tracks_.pop_back();
+  }
+  tracks_[track_id].uuid = uuid;
+  track_ids_.emplace(uuid, track_id);
+  return track_id;
+}
+
+void ObjectHistory::addFrame(
+  const rclcpp::Time & stamp, const std::vector<PredictedObject> & objects)
+{
+  if (objects.empty()) {
+    return;
+  }
+
+  // Objects at the same stamp as the latest frame are merged into it
+  const int64_t stamp_ns = stamp.nanoseconds();
+  if (frame_stamps_.empty() || frame_stamps_.back() < stamp_ns) {
+    frame_stamps_.push_back(stamp_ns);
+    frame_objects_.emplace_back().reserve(objects.size());
+    frame_tracks_.emplace_back().reserve(objects.size());
+  }
+  const uint64_t sequence = first_sequence_ + frame_stamps_.size() - 1;
+  auto & frame_objects = frame_objects_.back();
+  auto & frame_tracks = frame_tracks_.back();
+
+  for (const auto & object : objects) {
+    const TrackId track_id = internTrack(autoware_utils::to_hex_string(object.object_id));
+    auto & track = tracks_[track_id];
+    if (track.slots.empty()) {
+      track.first_sequence = sequence;
+    }
+    track.slots.resize(sequence - track.first_sequence + 1, absent_slot);
+    auto & slot = track.slots.back();
+    if (slot == absent_slot) {
+      slot = static_cast<uint32_t>(frame_objects.size());
+      frame_objects.push_back(object);
+      frame_tracks.push_back(track_id);
+    } else {
+      frame_objects[slot] = object;
+    }
+  }
+}
+
+std::vector<std::string> ObjectHistory::deleteFramesBefore(const rclcpp::Time & stamp)
+{
+  std::vector<std::string> deleted_uuids;
+  const int64_t stamp_ns = stamp.nanoseconds();
+  while (!frame_stamps_.empty() && frame_stamps_.front() < stamp_ns) {
+    // Only the tracks of the deleted frame start with it
+    for (const TrackId track_id : frame_tracks_.front()) {
+      auto & track = tracks_[track_id];
+      do {
+        track.slots.pop_front();
+        ++track.first_sequence;
+      } while (!track.slots.empty() && track.slots.front() == absent_slot);
+
+      if (track.slots.empty()) {
+        track_ids_.erase(track.uuid);
+        deleted_uuids.push_back(std::move(track.uuid));
+        track.uuid.clear();
+        free_tracks_.push_back(track_id);
+      }
+    }
+    frame_stamps_.pop_front();
+    frame_objects_.pop_front();
+    frame_tracks_.pop_front();
+    ++first_sequence_;
+  }
+  return deleted_uuids;
+}
+
+void ObjectHistory::clear()
+{
+  frame_stamps_.clear();
+  frame_objects_.clear();
+  frame_tracks_.clear();
+  first_sequence_ = 0;
+  tracks_.clear();
+  free_tracks_.clear();
+  track_ids_.clear();
+}
+
+size_t ObjectHistory::findClosestFrame(const rclcpp::Time & stamp) const
+{
+  const int64_t stamp_ns = stamp.nanoseconds();
+  const auto it = std::lower_bound(frame_stamps_.begin(), frame_stamps_.end(), stamp_ns);
+  if (it == frame_stamps_.end()) {
+    return frame_stamps_.size() - 1;
+  }
+  // The later frame is preferred when both are at the same distance
+  const auto frame = static_cast<size_t>(std::distance(frame_stamps_.begin(), it));
+  if (frame > 0 && stamp_ns - frame_stamps_[frame - 1] < *it - stamp_ns) {
+    return frame - 1;
+  }
+  return frame;
+}
+
+rclcpp::Time ObjectHistory::getFrameStamp(const size_t frame) const
+{
+  return rclcpp::Time(frame_stamps_.at(frame), RCL_ROS_TIME);
+}
+
+const std::vector<PredictedObject> & ObjectHistory::getFrameObjects(const size_t frame) const
+{
+  return frame_objects_.at(frame);
+}
+
+std::optional<ObjectHistory::TrackId> ObjectHistory::findTrack(const std::string & uuid) const
+{
+  const auto it = track_ids_.find(uuid);
+  if (it == track_ids_.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+size_t ObjectHistory::getFirstFrame(const TrackId track) const
+{
+  return static_cast<size_t>(tracks_.at(track).first_sequence - first_sequence_);
+}
+
+const PredictedObject * ObjectHistory::findObject(const TrackId track, const size_t frame) const
+{
+  const auto & slots = tracks_.at(track).slots;
+  const size_t first_frame = getFirstFrame(track);
+  if (frame < first_frame || frame - first_frame >= slots.size()) {
+    return nullptr;
+  }
+  const uint32_t slot = slots[frame - first_frame];
+  return slot == absent_slot ? nullptr : &frame_objects_[frame][slot];
+}
+
+std::optional<size_t> ObjectHistory::findPreviousFrame(
+  const TrackId track, const size_t frame) const
+{
+  const auto & slots = tracks_.at(track).slots;
+  const size_t first_frame = getFirstFrame(track);
+  if (frame <= first_frame) {
+    return std::nullopt;
+  }
+  for (size_t i = std::min(frame - first_frame, slots.size()); i > 0; --i) {
+    if (slots[i - 1] != absent_slot) {
+      return first_frame + i - 1;
+    }
+  }
+  return std::nullopt;
+}
+
+std::optional<size_t> ObjectHistory::findNextFrame(const TrackId track, const size_t frame) const
+{
+  const auto & slots = tracks_.at(track).slots;
+  const size_t first_frame = getFirstFrame(track);
+  for (size_t i = frame > first_frame ? frame - first_frame : 0; i < slots.size(); ++i) {
+    if (slots[i] != absent_slot) {
+      return first_frame + i;
+    }
+  }
+  return std::nullopt;
+}
+
+void ObjectHistory::getTrackObjects(
+  const TrackId track,
+  std::vector<std::pair<rclcpp::Time, const PredictedObject *>> & objects) const
+{
+  objects.clear();
+  const auto & slots = tracks_.at(track).slots;
+  const size_t first_frame = getFirstFrame(track);
+  for (size_t i = 0; i < slots.size(); ++i) {
+    if (slots[i] != absent_slot) {
+      const size_t frame = first_frame + i;
+      objects.emplace_back(getFrameStamp(frame), &frame_objects_[frame][slots[i]]);
+    }
+  }
+}
+
+}  // namespace autoware::perception_diagnostics
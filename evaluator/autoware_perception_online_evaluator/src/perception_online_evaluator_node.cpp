@@ -159,7 +159,7 @@ void PerceptionOnlineEvaluatorNode::publishDebugMarker()
 
   // visualize history path
   {
-    const auto history_path_map = metrics_calculator_.getHistoryPathMap();
+    const auto & history_path_map = metrics_calculator_.getHistoryPathMap();
     int32_t history_path_first_id = 0;
     int32_t smoothed_history_path_first_id = 0;
     size_t i = 0;
@@ -199,7 +199,7 @@ void PerceptionOnlineEvaluatorNode::publishDebugMarker()
     int32_t history_path_first_id = 0;
     int32_t deviation_lines_first_id = 0;
     size_t i = 0;
-    const auto object_data_map = metrics_calculator_.getDebugObjectData();
+    const auto & object_data_map = metrics_calculator_.getDebugObjectData();
     for (const auto & [uuid, object_data] : object_data_map) {
       const auto c = createColorFromString(uuid);
       const auto predicted_path = object_data.getPredictedPath();
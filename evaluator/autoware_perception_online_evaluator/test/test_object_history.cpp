@@ -0,0 +1,192 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/perception_online_evaluator/object_history.hpp"
+
+#include <autoware_utils/ros/uuid_helper.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+using autoware::perception_diagnostics::ObjectHistory;
+using autoware::perception_diagnostics::PredictedObject;
+using autoware_utils::generate_uuid;
+using autoware_utils::to_hex_string;
+using unique_identifier_msgs::msg::UUID;
+
+namespace
+{
+rclcpp::Time toStamp(const double sec)
+{
+  return rclcpp::Time(static_cast<int64_t>(sec * 1e9), RCL_ROS_TIME);
+}
+
+PredictedObject createObject(const UUID & uuid, const double x)
+{
+  PredictedObject object;
+  object.object_id = uuid;
+  object.kinematics.initial_pose_with_covariance.pose.position.x = x;
+  return object;
+}
+
+double getX(const PredictedObject * object)
+{
+  return object->kinematics.initial_pose_with_covariance.pose.position.x;
+}
+}  // namespace
+
+TEST(ObjectHistoryTest, FindClosestFrame)
+{
+  const auto uuid = generate_uuid();
+  ObjectHistory history;
+  history.addFrame(toStamp(1.0), {createObject(uuid, 0.0)});
+  history.addFrame(toStamp(2.0), {createObject(uuid, 0.0)});
+  history.addFrame(toStamp(4.0), {createObject(uuid, 0.0)});
+  ASSERT_EQ(history.size(), 3u);
+
+  EXPECT_EQ(history.findClosestFrame(toStamp(0.0)), 0u);
+  EXPECT_EQ(history.findClosestFrame(toStamp(1.0)), 0u);
+  EXPECT_EQ(history.findClosestFrame(toStamp(1.4)), 0u);
+  EXPECT_EQ(history.findClosestFrame(toStamp(2.9)), 1u);
+  EXPECT_EQ(history.findClosestFrame(toStamp(3.1)), 2u);
+  EXPECT_EQ(history.findClosestFrame(toStamp(10.0)), 2u);
+
+  // The later frame is preferred at the same distance
+  EXPECT_EQ(history.findClosestFrame(toStamp(1.5)), 1u);
+  EXPECT_EQ(history.findClosestFrame(toStamp(3.0)), 2u);
+}
+
+TEST(ObjectHistoryTest, FindNextAndPreviousFrame)
+{
+  const auto uuid_a = generate_uuid();
+  const auto uuid_b = generate_uuid();
+  ObjectHistory history;
+  history.addFrame(toStamp(1.0), {createObject(uuid_a, 1.0)});
+  history.addFrame(toStamp(2.0), {createObject(uuid_b, 2.0)});
+  history.addFrame(toStamp(3.0), {createObject(uuid_a, 3.0)});
+
+  const auto track_a = history.findTrack(to_hex_string(uuid_a));
+  const auto track_b = history.findTrack(to_hex_string(uuid_b));
+  ASSERT_TRUE(track_a.has_value());
+  ASSERT_TRUE(track_b.has_value());
+  EXPECT_FALSE(history.findTrack(to_hex_string(generate_uuid())).has_value());
+
+  // track a has objects in the frames 0 and 2
+  EXPECT_EQ(history.getFirstFrame(*track_a), 0u);
+  EXPECT_EQ(history.findObject(*track_a, 1), nullptr);
+  EXPECT_DOUBLE_EQ(getX(history.findObject(*track_a, 2)), 3.0);
+  EXPECT_FALSE(history.findPreviousFrame(*track_a, 0).has_value());
+  EXPECT_EQ(history.findPreviousFrame(*track_a, 1), 0u);
+  EXPECT_EQ(history.findPreviousFrame(*track_a, 2), 0u);
+  EXPECT_EQ(history.findNextFrame(*track_a, 0), 0u);
+  EXPECT_EQ(history.findNextFrame(*track_a, 1), 2u);
+  EXPECT_FALSE(history.findNextFrame(*track_a, 3).has_value());
+
+  // track b has an object in the frame 1 only
+  EXPECT_EQ(history.getFirstFrame(*track_b), 1u);
+  EXPECT_EQ(history.findObject(*track_b, 0), nullptr);
+  EXPECT_EQ(history.findObject(*track_b, 2), nullptr);
+  EXPECT_FALSE(history.findPreviousFrame(*track_b, 1).has_value());
+  EXPECT_EQ(history.findPreviousFrame(*track_b, 2), 1u);
+  EXPECT_EQ(history.findNextFrame(*track_b, 0), 1u);
+  EXPECT_FALSE(history.findNextFrame(*track_b, 2).has_value());
+
+  std::vector<std::pair<rclcpp::Time, const PredictedObject *>> objects;
+  history.getTrackObjects(*track_a, objects);
+  ASSERT_EQ(objects.size(), 2u);
+  EXPECT_EQ(objects.at(0).first, toStamp(1.0));
+  EXPECT_DOUBLE_EQ(getX(objects.at(0).second), 1.0);
+  EXPECT_EQ(objects.at(1).first, toStamp(3.0));
+  EXPECT_DOUBLE_EQ(getX(objects.at(1).second), 3.0);
+}
+
+TEST(ObjectHistoryTest, DeleteFramesBeforeReusesTracks)
+{
+  const auto uuid_a = generate_uuid();
+  const auto uuid_b = generate_uuid();
+  const auto uuid_c = generate_uuid();
+  ObjectHistory history;
+  history.addFrame(toStamp(1.0), {createObject(uuid_a, 1.0), createObject(uuid_b, 1.0)});
+  history.addFrame(toStamp(2.0), {createObject(uuid_b, 2.0)});
+  history.addFrame(toStamp(3.0), {createObject(uuid_a, 3.0)});
+  const auto track_a = history.findTrack(to_hex_string(uuid_a));
+  const auto track_b = history.findTrack(to_hex_string(uuid_b));
+  ASSERT_TRUE(track_a.has_value());
+  ASSERT_TRUE(track_b.has_value());
+
+  // The gap of track a is skipped, it starts with the frame at 3.0 after the deletion
+  EXPECT_TRUE(history.deleteFramesBefore(toStamp(1.5)).empty());
+  ASSERT_EQ(history.size(), 2u);
+  EXPECT_EQ(history.getOldestStamp(), toStamp(2.0));
+  EXPECT_EQ(history.getFirstFrame(*track_a), 1u);
+  EXPECT_EQ(history.getFirstFrame(*track_b), 0u);
+  EXPECT_DOUBLE_EQ(getX(history.findObject(*track_a, 1)), 3.0);
+  EXPECT_DOUBLE_EQ(getX(history.findObject(*track_b, 0)), 2.0);
+
+  // Track b is left without objects and is deleted
+  const auto deleted_uuids = history.deleteFramesBefore(toStamp(2.5));
+  ASSERT_EQ(deleted_uuids.size(), 1u);
+  EXPECT_EQ(deleted_uuids.front(), to_hex_string(uuid_b));
+  EXPECT_FALSE(history.findTrack(to_hex_string(uuid_b)).has_value());
+  ASSERT_EQ(history.size(), 1u);
+  EXPECT_EQ(history.getFirstFrame(*track_a), 0u);
+
+  // A new uuid reuses the id of the deleted track, without its old objects
+  history.addFrame(toStamp(4.0), {createObject(uuid_c, 4.0)});
+  const auto track_c = history.findTrack(to_hex_string(uuid_c));
+  ASSERT_TRUE(track_c.has_value());
+  EXPECT_EQ(*track_c, *track_b);
+  EXPECT_EQ(history.getTracks().size(), 2u);
+  EXPECT_EQ(history.getFirstFrame(*track_c), 1u);
+  EXPECT_EQ(history.findObject(*track_c, 0), nullptr);
+  EXPECT_DOUBLE_EQ(getX(history.findObject(*track_c, 1)), 4.0);
+  EXPECT_FALSE(history.findPreviousFrame(*track_c, 1).has_value());
+
+  // Deleting all the frames deletes all the tracks
+  const auto all_deleted_uuids = history.deleteFramesBefore(toStamp(5.0));
+  EXPECT_EQ(all_deleted_uuids.size(), 2u);
+  EXPECT_TRUE(history.empty());
+  EXPECT_TRUE(history.getTracks().empty());
+}
+
+TEST(ObjectHistoryTest, MergeFramesAtIdenticalStamp)
+{
+  const auto uuid_a = generate_uuid();
+  const auto uuid_b = generate_uuid();
+  const auto uuid_c = generate_uuid();
+  ObjectHistory history;
+  history.addFrame(toStamp(1.0), {createObject(uuid_a, 1.0), createObject(uuid_b, 1.0)});
+  history.addFrame(toStamp(1.0), {createObject(uuid_a, 5.0), createObject(uuid_c, 5.0)});
+  history.addFrame(toStamp(2.0), {});
+
+  // The objects are merged into one frame, the object of the same uuid is replaced
+  ASSERT_EQ(history.size(), 1u);
+  EXPECT_EQ(history.getFrameObjects(0).size(), 3u);
+  const auto track_a = history.findTrack(to_hex_string(uuid_a));
+  const auto track_b = history.findTrack(to_hex_string(uuid_b));
+  const auto track_c = history.findTrack(to_hex_string(uuid_c));
+  ASSERT_TRUE(track_a.has_value());
+  ASSERT_TRUE(track_b.has_value());
+  ASSERT_TRUE(track_c.has_value());
+  EXPECT_DOUBLE_EQ(getX(history.findObject(*track_a, 0)), 5.0);
+  EXPECT_DOUBLE_EQ(getX(history.findObject(*track_b, 0)), 1.0);
+  EXPECT_DOUBLE_EQ(getX(history.findObject(*track_c, 0)), 5.0);
+
+  std::vector<std::pair<rclcpp::Time, const PredictedObject *>> objects;
+  history.getTrackObjects(*track_a, objects);
+  EXPECT_EQ(objects.size(), 1u);
+}
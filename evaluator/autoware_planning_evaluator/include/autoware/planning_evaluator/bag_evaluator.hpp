@@ -0,0 +1,136 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__PLANNING_EVALUATOR__BAG_EVALUATOR_HPP_
+#define AUTOWARE__PLANNING_EVALUATOR__BAG_EVALUATOR_HPP_
+
+#include "autoware/planning_evaluator/metrics_accumulator.hpp"
+#include "autoware/planning_evaluator/metrics_calculator.hpp"
+#include "autoware/planning_evaluator/planning_evaluator_parameters.hpp"
+
+#include <nlohmann/json.hpp>
+#include <rosbag2_storage/serialized_bag_message.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace planning_diagnostics
+{
+using json = nlohmann::json;
+
+/**
+ * @brief Parameters of the offline evaluation: those of the PlanningEvaluatorNode, and the rosbag
+ * specific ones
+ */
+struct BagEvaluatorParameters : public PlanningEvaluatorParameters
+{
+  double vehicle_length_m = 0.0;
+  double timer_period_s = 0.1;  // [s] period of the node timer taking the latest messages
+
+  // Topics of the inputs of the node in the rosbags, the planning factors topics are given by
+  // stop_decision_topic_prefix
+  struct
+  {
+    std::string odometry = "/localization/kinematic_state";
+    std::string trajectory = "/planning/scenario_planning/trajectory";
+    std::string reference_trajectory =
+      "/planning/scenario_planning/lane_driving/motion_planning/path_optimizer/trajectory";
+    std::string objects = "/perception/object_recognition/objects";
+    std::string modified_goal = "/planning/scenario_planning/modified_goal";
+    std::string steering_status = "/vehicle/status/steering_status";
+    std::string turn_indicators_status = "/vehicle/status/turn_indicators_status";
+  } topics;
+};
+
+/**
+ * @brief Offline evaluation of a rosbag, producing the metrics output by the PlanningEvaluatorNode
+ * @details The messages are read in the order they were recorded, and the timer of the node is
+ * replayed on their receive time: at each period, the latest message of each topic is evaluated,
+ * even if it was already evaluated at the previous period, as the polling subscribers of the node
+ * keep it. The messages of the other topics are filtered out by the storage, and a message is
+ * only deserialized when it is evaluated.
+ */
+class BagEvaluator
+{
+public:
+  explicit BagEvaluator(const BagEvaluatorParameters & parameters);
+
+  /**
+   * @brief evaluate the messages of a rosbag, accumulating the metrics of the previous ones
+   * @param [in] bag_path path of the rosbag, in any storage format supported by rosbag2
+   * @throw std::runtime_error if the rosbag cannot be read
+   */
+  void evaluate(const std::string & bag_path);
+
+  /**
+   * @brief get the output json data, in the format of the PlanningEvaluatorNode output file
+   */
+  json getOutputJson();
+
+private:
+  /**
+   * @brief evaluate the latest messages received since the previous call
+   */
+  void onTimer();
+
+  /**
+   * @brief get the latest message of the topic, deserializing it if it was not yet
+   * @return message, or nullptr if no message was received
+   */
+  template <typename MessageT>
+  typename MessageT::ConstSharedPtr takeData(const std::string & topic);
+
+  // Latest message of an input topic
+  struct TopicData
+  {
+    std::shared_ptr<rosbag2_storage::SerializedBagMessage> serialized_message;  // not evaluated yet
+    std::shared_ptr<const void> message;
+  };
+
+  BagEvaluatorParameters parameters_;
+  MetricsCalculator metrics_calculator_;
+  MetricsAccumulator metrics_accumulator_;
+
+  // Data of each input topic, and the module of each planning factor topic
+  std::unordered_map<std::string, TopicData> topic_data_;
+  std::unordered_map<std::string, std::string> planning_factor_topics_;
+};
+
+/**
+ * @brief Result of the evaluation of a rosbag
+ */
+struct BagEvaluationResult
+{
+  std::string bag_path;
+  json output;        // output json data, empty if the evaluation failed
+  std::string error;  // error message, empty if the evaluation succeeded
+};
+
+/**
+ * @brief evaluate rosbags in parallel, each one independently of the others
+ * @param [in] bag_paths paths of the rosbags
+ * @param [in] parameters evaluation parameters
+ * @param [in] num_workers number of threads, each one evaluating one rosbag at a time
+ * @return result of each rosbag, in the order of bag_paths
+ */
+std::vector<BagEvaluationResult> evaluateBags(
+  const std::vector<std::string> & bag_paths, const BagEvaluatorParameters & parameters,
+  const size_t num_workers);
+
+}  // namespace planning_diagnostics
+
+#endif  // AUTOWARE__PLANNING_EVALUATOR__BAG_EVALUATOR_HPP_
@@ -17,11 +17,15 @@
 
 #include "autoware/planning_evaluator/metrics/output_metric.hpp"
 
+#include <autoware/universe_utils/math/quantile_accumulator.hpp>
 #include <autoware_utils/math/accumulator.hpp>
 #include <nlohmann/json.hpp>
 
+#include <vector>
+
 namespace planning_diagnostics
 {
+using autoware::universe_utils::QuantileAccumulator;
 using autoware_utils::Accumulator;
 using json = nlohmann::json;
 
@@ -32,7 +36,13 @@ using json = nlohmann::json;
 class CommonAccumulator
 {
 public:
-  CommonAccumulator() = default;
+  /**
+   * @brief constructor
+   * @param use_quantiles whether to also estimate quantiles over the updates: the p50 of the
+   * means, and the p95 and p99 of the maxima. A statistics-based update is one sample of each, not
+   * one sample per data point, and a value-based update is its own mean and maximum.
+   */
+  explicit CommonAccumulator(const bool use_quantiles = false);
   ~CommonAccumulator() = default;
 
   /**
@@ -64,6 +74,8 @@ private:
   Accumulator<double> min_accumulator_;
   Accumulator<double> max_accumulator_;
   Accumulator<long double> mean_accumulator_;
+  std::vector<QuantileAccumulator<double>> mean_quantile_accumulators_;
+  std::vector<QuantileAccumulator<double>> max_quantile_accumulators_;
   unsigned int count_ = 0;
 };
 
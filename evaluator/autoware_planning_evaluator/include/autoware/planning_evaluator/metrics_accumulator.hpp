@@ -31,6 +31,10 @@
 #include <autoware_vehicle_msgs/msg/turn_indicators_report.hpp>
 #include <nav_msgs/msg/odometry.hpp>
 
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace planning_diagnostics
 {
 using autoware_utils::Accumulator;
@@ -64,12 +68,20 @@ public:
 
   json getOutputJson(const OutputMetric & output_metric);
 
+  /**
+   * @brief get the output json data of the given metrics, keyed by their names
+   */
+  json getOutputJson(const std::unordered_set<OutputMetric> & output_metrics);
+
   PlanningFactorAccumulator planning_factor_accumulator;
   BlinkerAccumulator blinker_accumulator;
   SteerAccumulator steer_accumulator;
   std::unordered_map<OutputMetric, CommonAccumulator> common_accumulators;
+  std::unordered_set<OutputMetric> metrics_with_quantiles;
 
 private:
+  CommonAccumulator & getCommonAccumulator(const OutputMetric output_metric);
+
   nav_msgs::msg::Odometry ego_odometry_;
 
 };  // class MetricsAccumulator
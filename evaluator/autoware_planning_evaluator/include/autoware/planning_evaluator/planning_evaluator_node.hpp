@@ -23,6 +23,7 @@
 #include "tf2_ros/buffer.h"
 #include "tf2_ros/transform_listener.h"
 
+#include <autoware/agnocast_wrapper/polling_subscriber.hpp>
 #include <autoware/route_handler/route_handler.hpp>
 #include <autoware_utils/math/accumulator.hpp>
 #include <autoware_utils/ros/polling_subscriber.hpp>
@@ -169,7 +170,7 @@ private:
   autoware_utils::InterProcessPollingSubscriber<Trajectory> traj_sub_{this, "~/input/trajectory"};
   autoware_utils::InterProcessPollingSubscriber<Trajectory> ref_sub_{
     this, "~/input/reference_trajectory"};
-  autoware_utils::InterProcessPollingSubscriber<PredictedObjects> objects_sub_{
+  autoware::agnocast_wrapper::PollingSubscriber<PredictedObjects> objects_sub_{
     this, "~/input/objects"};
   autoware_utils::InterProcessPollingSubscriber<PoseWithUuidStamped> modified_goal_sub_{
     this, "~/input/modified_goal"};
@@ -0,0 +1,58 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__PLANNING_EVALUATOR__PLANNING_EVALUATOR_PARAMETERS_HPP_
+#define AUTOWARE__PLANNING_EVALUATOR__PLANNING_EVALUATOR_PARAMETERS_HPP_
+
+#include "autoware/planning_evaluator/metric_accumulators/blinker_accumulator.hpp"
+#include "autoware/planning_evaluator/metric_accumulators/planning_factor_accumulator.hpp"
+#include "autoware/planning_evaluator/metric_accumulators/steer_accumulator.hpp"
+#include "autoware/planning_evaluator/metrics/metric.hpp"
+#include "autoware/planning_evaluator/metrics/output_metric.hpp"
+#include "autoware/planning_evaluator/metrics_calculator.hpp"
+
+#include <rclcpp/node.hpp>
+
+#include <string>
+#include <unordered_set>
+
+namespace planning_diagnostics
+{
+/**
+ * @brief Parameters of the metrics calculation and accumulation
+ */
+struct PlanningEvaluatorParameters
+{
+  MetricsCalculator::Parameters metrics_calculator;
+  PlanningFactorAccumulator::Parameters planning_factor_accumulator;
+  SteerAccumulator::Parameters steer_accumulator;
+  BlinkerAccumulator::Parameters blinker_accumulator;
+
+  std::unordered_set<Metric> metrics_for_publish;
+  std::unordered_set<OutputMetric> metrics_for_output;
+  std::unordered_set<OutputMetric> metrics_with_quantiles;
+  std::unordered_set<std::string> stop_decision_modules;
+  std::string stop_decision_topic_prefix = "/planning/planning_factors/";
+};
+
+/**
+ * @brief declare the parameters of the metrics calculation and accumulation on the node
+ * @details shared by the PlanningEvaluatorNode and the offline evaluation of rosbags, which read
+ * the same parameter file
+ */
+PlanningEvaluatorParameters declarePlanningEvaluatorParameters(rclcpp::Node & node);
+
+}  // namespace planning_diagnostics
+
+#endif  // AUTOWARE__PLANNING_EVALUATOR__PLANNING_EVALUATOR_PARAMETERS_HPP_
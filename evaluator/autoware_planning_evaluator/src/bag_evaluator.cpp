@@ -0,0 +1,223 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/planning_evaluator/bag_evaluator.hpp"
+
+#include <rclcpp/serialization.hpp>
+#include <rclcpp/serialized_message.hpp>
+#include <rosbag2_cpp/reader.hpp>
+#include <rosbag2_storage/storage_filter.hpp>
+
+#include <autoware_internal_planning_msgs/msg/planning_factor_array.hpp>
+#include <autoware_perception_msgs/msg/predicted_objects.hpp>
+#include <autoware_planning_msgs/msg/pose_with_uuid_stamped.hpp>
+#include <autoware_planning_msgs/msg/trajectory.hpp>
+#include <autoware_vehicle_msgs/msg/steering_report.hpp>
+#include <autoware_vehicle_msgs/msg/turn_indicators_report.hpp>
+#include <nav_msgs/msg/odometry.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace planning_diagnostics
+{
+using autoware_internal_planning_msgs::msg::PlanningFactorArray;
+using autoware_perception_msgs::msg::PredictedObjects;
+using autoware_planning_msgs::msg::PoseWithUuidStamped;
+using autoware_planning_msgs::msg::Trajectory;
+using autoware_vehicle_msgs::msg::SteeringReport;
+using autoware_vehicle_msgs::msg::TurnIndicatorsReport;
+using nav_msgs::msg::Odometry;
+
+BagEvaluator::BagEvaluator(const BagEvaluatorParameters & parameters) : parameters_(parameters)
+{
+  metrics_calculator_.parameters = parameters.metrics_calculator;
+  metrics_accumulator_.planning_factor_accumulator.parameters =
+    parameters.planning_factor_accumulator;
+  metrics_accumulator_.steer_accumulator.parameters = parameters.steer_accumulator;
+  metrics_accumulator_.blinker_accumulator.parameters = parameters.blinker_accumulator;
+  metrics_accumulator_.metrics_with_quantiles = parameters.metrics_with_quantiles;
+
+  const auto & topics = parameters.topics;
+  for (const auto & topic :
+       {topics.odometry, topics.trajectory, topics.reference_trajectory, topics.objects,
+        topics.modified_goal, topics.steering_status, topics.turn_indicators_status}) {
+    topic_data_.emplace(topic, TopicData{});
+  }
+  for (const auto & module_name : parameters.stop_decision_modules) {
+    const std::string topic = parameters.stop_decision_topic_prefix + module_name;
+    topic_data_.emplace(topic, TopicData{});
+    planning_factor_topics_.emplace(topic, module_name);
+  }
+}
+
+void BagEvaluator::evaluate(const std::string & bag_path)
+{
+  rosbag2_cpp::Reader reader;
+  reader.open(bag_path);
+
+  // Only the input topics are read from the storage
+  rosbag2_storage::StorageFilter storage_filter;
+  for (const auto & [topic, data] : topic_data_) {
+    storage_filter.topics.push_back(topic);
+  }
+  reader.set_filter(storage_filter);
+
+  const auto timer_period_ns = static_cast<int64_t>(std::round(parameters_.timer_period_s * 1e9));
+  std::optional<int64_t> next_timer_ns;
+  while (reader.has_next()) {
+    auto bag_message = reader.read_next();
+    const int64_t stamp_ns = bag_message->time_stamp;
+    if (!next_timer_ns) {
+      next_timer_ns = stamp_ns + timer_period_ns;
+    }
+    for (; *next_timer_ns <= stamp_ns; *next_timer_ns += timer_period_ns) {
+      onTimer();
+    }
+
+    const auto it = topic_data_.find(bag_message->topic_name);
+    if (it != topic_data_.end()) {
+      it->second.serialized_message = std::move(bag_message);
+    }
+  }
+  if (next_timer_ns) {
+    onTimer();
+  }
+}
+
+json BagEvaluator::getOutputJson()
+{
+  return metrics_accumulator_.getOutputJson(parameters_.metrics_for_output);
+}
+
+template <typename MessageT>
+typename MessageT::ConstSharedPtr BagEvaluator::takeData(const std::string & topic)
+{
+  auto & data = topic_data_.at(topic);
+  if (data.serialized_message) {
+    rclcpp::SerializedMessage serialized_msg(*data.serialized_message->serialized_data);
+    auto msg = std::make_shared<MessageT>();
+    rclcpp::Serialization<MessageT>().deserialize_message(&serialized_msg, msg.get());
+    data.message = std::move(msg);
+    data.serialized_message.reset();
+  }
+  return std::static_pointer_cast<const MessageT>(data.message);
+}
+
+void BagEvaluator::onTimer()
+{
+  const auto & topics = parameters_.topics;
+
+  // The messages are evaluated in the same order as in PlanningEvaluatorNode::onTimer
+  const auto ego_state_ptr = takeData<Odometry>(topics.odometry);
+  if (ego_state_ptr) {
+    metrics_calculator_.setEgoPose(*ego_state_ptr);
+    metrics_accumulator_.setEgoPose(*ego_state_ptr);
+  }
+
+  if (const auto objects_msg = takeData<PredictedObjects>(topics.objects)) {
+    metrics_calculator_.setPredictedObjects(*objects_msg);
+  }
+
+  if (const auto ref_traj_msg = takeData<Trajectory>(topics.reference_trajectory)) {
+    metrics_calculator_.setReferenceTrajectory(*ref_traj_msg);
+  }
+
+  const auto traj_msg = takeData<Trajectory>(topics.trajectory);
+  if (traj_msg && ego_state_ptr) {
+    for (const Metric metric : parameters_.metrics_for_publish) {
+      const auto metric_stat =
+        metrics_calculator_.calculate(metric, *traj_msg, parameters_.vehicle_length_m);
+      if (!metric_stat || metric_stat->count() <= 0) {
+        continue;
+      }
+      const OutputMetric output_metric = str_to_output_metric.at(metric_to_str.at(metric));
+      metrics_accumulator_.accumulate(output_metric, *metric_stat);
+    }
+    metrics_calculator_.setPreviousTrajectory(*traj_msg);
+  }
+
+  const auto modified_goal_msg = takeData<PoseWithUuidStamped>(topics.modified_goal);
+  if (modified_goal_msg && ego_state_ptr) {
+    for (const Metric metric : parameters_.metrics_for_publish) {
+      const auto metric_stat =
+        metrics_calculator_.calculate(metric, modified_goal_msg->pose, ego_state_ptr->pose.pose);
+      if (!metric_stat || metric_stat->count() <= 0) {
+        continue;
+      }
+      if (std::abs(ego_state_ptr->twist.twist.linear.x) < 0.001 && metric_stat->mean() < 3.0) {
+        const OutputMetric output_metric = str_to_output_metric.at(metric_to_str.at(metric));
+        metrics_accumulator_.accumulate(output_metric, *metric_stat);
+      }
+    }
+  }
+
+  if (const auto steering_msg = takeData<SteeringReport>(topics.steering_status)) {
+    metrics_accumulator_.setSteerData(*steering_msg);
+  }
+
+  if (const auto blinker_msg = takeData<TurnIndicatorsReport>(topics.turn_indicators_status)) {
+    metrics_accumulator_.setBlinkerData(*blinker_msg);
+  }
+
+  for (const auto & [topic, module_name] : planning_factor_topics_) {
+    const auto planning_factors = takeData<PlanningFactorArray>(topic);
+    if (planning_factors && !planning_factors->factors.empty()) {
+      metrics_accumulator_.setPlanningFactors(module_name, *planning_factors);
+    }
+  }
+}
+
+std::vector<BagEvaluationResult> evaluateBags(
+  const std::vector<std::string> & bag_paths, const BagEvaluatorParameters & parameters,
+  const size_t num_workers)
+{
+  std::vector<BagEvaluationResult> results(bag_paths.size());
+  std::atomic_size_t next_bag{0};
+  const auto evaluate_next_bags = [&]() {
+    for (size_t i = next_bag++; i < bag_paths.size(); i = next_bag++) {
+      auto & result = results.at(i);
+      result.bag_path = bag_paths.at(i);
+      try {
+        BagEvaluator bag_evaluator(parameters);
+        bag_evaluator.evaluate(result.bag_path);
+        result.output = bag_evaluator.getOutputJson();
+      } catch (const std::exception & e) {
+        result.error = e.what();
+      }
+    }
+  };
+
+  // The calling thread is one of the workers
+  const size_t num_threads = std::min(std::max<size_t>(num_workers, 1), bag_paths.size());
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < num_threads; ++i) {
+    workers.emplace_back(evaluate_next_bags);
+  }
+  evaluate_next_bags();
+  for (auto & worker : workers) {
+    worker.join();
+  }
+  return results;
+}
+
+}  // namespace planning_diagnostics
@@ -14,14 +14,44 @@
 
 #include "autoware/planning_evaluator/metric_accumulators/common_accumulator.hpp"
 
+#include <cmath>
+#include <string>
+#include <vector>
+
 namespace planning_diagnostics
 {
+namespace
+{
+// e.g. "max_p95" for the p95 of the maxima
+std::string getQuantileKey(
+  const std::string & statistic, const QuantileAccumulator<double> & quantile_accumulator)
+{
+  const auto percentile = static_cast<int>(std::lround(quantile_accumulator.probability() * 100));
+  return statistic + "_p" + std::to_string(percentile);
+}
+}  // namespace
+
+CommonAccumulator::CommonAccumulator(const bool use_quantiles)
+{
+  if (use_quantiles) {
+    mean_quantile_accumulators_.emplace_back(0.5);
+    for (const double probability : {0.95, 0.99}) {
+      max_quantile_accumulators_.emplace_back(probability);
+    }
+  }
+}
 
 void CommonAccumulator::update(const Accumulator<double> & accumulator, const unsigned int count)
 {
   min_accumulator_.add(accumulator.min());
   max_accumulator_.add(accumulator.max());
   mean_accumulator_.add(accumulator.mean());
+  for (auto & quantile_accumulator : mean_quantile_accumulators_) {
+    quantile_accumulator.add(accumulator.mean());
+  }
+  for (auto & quantile_accumulator : max_quantile_accumulators_) {
+    quantile_accumulator.add(accumulator.max());
+  }
   count_ += count;
 }
 
@@ -30,6 +60,12 @@ void CommonAccumulator::update(const double value)
   min_accumulator_.add(value);
   max_accumulator_.add(value);
   mean_accumulator_.add(value);
+  for (auto & quantile_accumulator : mean_quantile_accumulators_) {
+    quantile_accumulator.add(value);
+  }
+  for (auto & quantile_accumulator : max_quantile_accumulators_) {
+    quantile_accumulator.add(value);
+  }
   count_ += 1;
 }
 
@@ -40,6 +76,12 @@ json CommonAccumulator::getOutputJson(const OutputMetric & output_metric) const
   j["max"] = max_accumulator_.max();
   j["mean"] = mean_accumulator_.mean();
   j["count"] = count_;
+  for (const auto & quantile_accumulator : mean_quantile_accumulators_) {
+    j[getQuantileKey("mean", quantile_accumulator)] = quantile_accumulator.quantile();
+  }
+  for (const auto & quantile_accumulator : max_quantile_accumulators_) {
+    j[getQuantileKey("max", quantile_accumulator)] = quantile_accumulator.quantile();
+  }
   j["description"] = output_metric_descriptions.at(output_metric);
   return j;
 }
@@ -18,23 +18,28 @@ namespace planning_diagnostics
 {
 void MetricsAccumulator::accumulate(const OutputMetric output_metric, const double value)
 {
-  common_accumulators.emplace(output_metric, CommonAccumulator());
-  common_accumulators[output_metric].update(value);
+  getCommonAccumulator(output_metric).update(value);
 }
 
 void MetricsAccumulator::accumulate(
   const OutputMetric output_metric, const Accumulator<double> & accumulator,
   const unsigned int count)
 {
-  common_accumulators.emplace(output_metric, CommonAccumulator());
-  common_accumulators[output_metric].update(accumulator, count);
+  getCommonAccumulator(output_metric).update(accumulator, count);
 }
 
 void MetricsAccumulator::accumulate(
   const OutputMetric output_metric, const Accumulator<double> & accumulator)
 {
-  common_accumulators.emplace(output_metric, CommonAccumulator());
-  common_accumulators[output_metric].update(accumulator);
+  getCommonAccumulator(output_metric).update(accumulator);
+}
+
+CommonAccumulator & MetricsAccumulator::getCommonAccumulator(const OutputMetric output_metric)
+{
+  // The quantile estimators are only allocated for the selected metrics
+  return common_accumulators
+    .try_emplace(output_metric, metrics_with_quantiles.count(output_metric) > 0)
+    .first->second;
 }
 
 void MetricsAccumulator::setEgoPose(const nav_msgs::msg::Odometry & ego_odometry)
@@ -106,4 +111,16 @@ json MetricsAccumulator::getOutputJson(const OutputMetric & output_metric)
   }
 }
 
+json MetricsAccumulator::getOutputJson(const std::unordered_set<OutputMetric> & output_metrics)
+{
+  json output_json;
+  for (const OutputMetric output_metric : output_metrics) {
+    const json j = getOutputJson(output_metric);
+    if (!j.empty()) {
+      output_json[output_metric_to_str.at(output_metric)] = j;
+    }
+  }
+  return output_json;
+}
+
 }  // namespace planning_diagnostics
@@ -16,6 +16,7 @@
 
 #include "autoware/planning_evaluator/metrics/metric.hpp"
 #include "autoware/planning_evaluator/metrics/output_metric.hpp"
+#include "autoware/planning_evaluator/planning_evaluator_parameters.hpp"
 
 #include <autoware_lanelet2_extension/utility/query.hpp>
 #include <autoware_lanelet2_extension/utility/utilities.hpp>
@@ -52,63 +53,29 @@ PlanningEvaluatorNode::PlanningEvaluatorNode(const rclcpp::NodeOptions & node_op
   timer_ = rclcpp::create_timer(
     this, get_clock(), 100ms, std::bind(&PlanningEvaluatorNode::onTimer, this));
 
-  // Parameters for metrics_calculator
-  metrics_calculator_.parameters.trajectory.min_point_dist_m =
-    declare_parameter<double>("trajectory.min_point_dist_m");
-  metrics_calculator_.parameters.trajectory.lookahead.max_dist_m =
-    declare_parameter<double>("trajectory.lookahead.max_dist_m");
-  metrics_calculator_.parameters.trajectory.lookahead.max_time_s =
-    declare_parameter<double>("trajectory.lookahead.max_time_s");
-  metrics_calculator_.parameters.trajectory.evaluation_time_s =
-    declare_parameter<double>("trajectory.evaluation_time_s");
-  metrics_calculator_.parameters.obstacle.dist_thr_m =
-    declare_parameter<double>("obstacle.dist_thr_m");
-
-  // Parameters for metrics_accumulator
-  metrics_accumulator_.planning_factor_accumulator.parameters.time_count_threshold_s =
-    declare_parameter<double>("stop_decision.time_count_threshold_s");
-  metrics_accumulator_.planning_factor_accumulator.parameters.dist_count_threshold_m =
-    declare_parameter<double>("stop_decision.dist_count_threshold_m");
-  metrics_accumulator_.planning_factor_accumulator.parameters.abnormal_deceleration_threshold_mps2 =
-    declare_parameter<double>("stop_decision.abnormal_deceleration_threshold_mps2");
-
-  metrics_accumulator_.steer_accumulator.parameters.window_duration_s =
-    declare_parameter<double>("steer_change_count.window_duration_s");
-  metrics_accumulator_.steer_accumulator.parameters.steer_rate_margin =
-    declare_parameter<double>("steer_change_count.steer_rate_margin");
-
-  metrics_accumulator_.blinker_accumulator.parameters.window_duration_s =
-    declare_parameter<double>("blinker_change_count.window_duration_s");
+  // Parameters for metrics_calculator and metrics_accumulator
+  const auto parameters = declarePlanningEvaluatorParameters(*this);
+  metrics_calculator_.parameters = parameters.metrics_calculator;
+  metrics_accumulator_.planning_factor_accumulator.parameters =
+    parameters.planning_factor_accumulator;
+  metrics_accumulator_.steer_accumulator.parameters = parameters.steer_accumulator;
+  metrics_accumulator_.blinker_accumulator.parameters = parameters.blinker_accumulator;
+  metrics_accumulator_.metrics_with_quantiles = parameters.metrics_with_quantiles;
 
   // Parameters for node
   output_metrics_ = declare_parameter<bool>("output_metrics");
   ego_frame_str_ = declare_parameter<std::string>("ego_frame");
 
   // List of metrics to publish and to output
-
-  for (const std::string & metric_name :
-       declare_parameter<std::vector<std::string>>("metrics_for_publish")) {
-    Metric metric = str_to_metric.at(metric_name);
-    metrics_for_publish_.insert(metric);
-  }
-
-  for (const std::string & metric_name :
-       declare_parameter<std::vector<std::string>>("metrics_for_output")) {
-    OutputMetric output_metric = str_to_output_metric.at(metric_name);
-    metrics_for_output_.insert(output_metric);
-  }
+  metrics_for_publish_ = parameters.metrics_for_publish;
+  metrics_for_output_ = parameters.metrics_for_output;
 
   // Subscribers of planning_factors for stop decision
-  std::vector<std::string> stop_decision_modules_list =
-    declare_parameter<std::vector<std::string>>("stop_decision.module_list");
-  stop_decision_modules_ = std::unordered_set<std::string>(
-    stop_decision_modules_list.begin(), stop_decision_modules_list.end());
-
-  const std::string topic_prefix = declare_parameter<std::string>("stop_decision.topic_prefix");
+  stop_decision_modules_ = parameters.stop_decision_modules;
   for (const auto & module_name : stop_decision_modules_) {
     planning_factors_sub_.emplace(
       module_name, autoware_utils::InterProcessPollingSubscriber<PlanningFactorArray>(
-                     this, topic_prefix + module_name));
+                     this, parameters.stop_decision_topic_prefix + module_name));
   }
 
   // Publisher
@@ -126,13 +93,7 @@ PlanningEvaluatorNode::~PlanningEvaluatorNode()
   try {
     // generate json data
     using json = nlohmann::json;
-    json output_json;
-    for (OutputMetric metric : metrics_for_output_) {
-      const json j = metrics_accumulator_.getOutputJson(metric);
-      if (!j.empty()) {
-        output_json[output_metric_to_str.at(metric)] = j;
-      }
-    }
+    const json output_json = metrics_accumulator_.getOutputJson(metrics_for_output_);
 
     // get output folder
     const std::string output_folder_str =
@@ -302,7 +263,7 @@ void PlanningEvaluatorNode::onTimer()
   const auto ego_state_ptr = odometry_sub_.take_data();
   onOdometry(ego_state_ptr);
   {
-    const auto objects_msg = objects_sub_.take_data();
+    const auto objects_msg = objects_sub_.takeData();
     onObjects(objects_msg);
   }
 
@@ -0,0 +1,79 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/planning_evaluator/planning_evaluator_parameters.hpp"
+
+#include <string>
+#include <vector>
+
+namespace planning_diagnostics
+{
+PlanningEvaluatorParameters declarePlanningEvaluatorParameters(rclcpp::Node & node)
+{
+  PlanningEvaluatorParameters parameters;
+
+  // Parameters for metrics_calculator
+  parameters.metrics_calculator.trajectory.min_point_dist_m =
+    node.declare_parameter<double>("trajectory.min_point_dist_m");
+  parameters.metrics_calculator.trajectory.lookahead.max_dist_m =
+    node.declare_parameter<double>("trajectory.lookahead.max_dist_m");
+  parameters.metrics_calculator.trajectory.lookahead.max_time_s =
+    node.declare_parameter<double>("trajectory.lookahead.max_time_s");
+  parameters.metrics_calculator.trajectory.evaluation_time_s =
+    node.declare_parameter<double>("trajectory.evaluation_time_s");
+  parameters.metrics_calculator.obstacle.dist_thr_m =
+    node.declare_parameter<double>("obstacle.dist_thr_m");
+
+  // Parameters for metrics_accumulator
+  parameters.planning_factor_accumulator.time_count_threshold_s =
+    node.declare_parameter<double>("stop_decision.time_count_threshold_s");
+  parameters.planning_factor_accumulator.dist_count_threshold_m =
+    node.declare_parameter<double>("stop_decision.dist_count_threshold_m");
+  parameters.planning_factor_accumulator.abnormal_deceleration_threshold_mps2 =
+    node.declare_parameter<double>("stop_decision.abnormal_deceleration_threshold_mps2");
+
+  parameters.steer_accumulator.window_duration_s =
+    node.declare_parameter<double>("steer_change_count.window_duration_s");
+  parameters.steer_accumulator.steer_rate_margin =
+    node.declare_parameter<double>("steer_change_count.steer_rate_margin");
+
+  parameters.blinker_accumulator.window_duration_s =
+    node.declare_parameter<double>("blinker_change_count.window_duration_s");
+
+  // List of metrics to publish and to output
+  for (const std::string & metric_name :
+       node.declare_parameter<std::vector<std::string>>("metrics_for_publish")) {
+    parameters.metrics_for_publish.insert(str_to_metric.at(metric_name));
+  }
+  for (const std::string & metric_name :
+       node.declare_parameter<std::vector<std::string>>("metrics_for_output")) {
+    parameters.metrics_for_output.insert(str_to_output_metric.at(metric_name));
+  }
+  for (const std::string & metric_name :
+       node.declare_parameter<std::vector<std::string>>("metrics_with_quantiles")) {
+    parameters.metrics_with_quantiles.insert(str_to_output_metric.at(metric_name));
+  }
+
+  // Modules of the planning_factors for stop decision
+  for (const std::string & module_name :
+       node.declare_parameter<std::vector<std::string>>("stop_decision.module_list")) {
+    parameters.stop_decision_modules.insert(module_name);
+  }
+  parameters.stop_decision_topic_prefix =
+    node.declare_parameter<std::string>("stop_decision.topic_prefix");
+
+  return parameters;
+}
+
+}  // namespace planning_diagnostics
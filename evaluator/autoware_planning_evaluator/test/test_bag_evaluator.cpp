@@ -0,0 +1,143 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/planning_evaluator/bag_evaluator.hpp"
+
+#include <rclcpp/time.hpp>
+#include <rosbag2_cpp/writer.hpp>
+#include <rosbag2_storage/storage_options.hpp>
+
+#include <autoware_planning_msgs/msg/trajectory.hpp>
+#include <nav_msgs/msg/odometry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+using planning_diagnostics::BagEvaluator;
+using planning_diagnostics::BagEvaluatorParameters;
+using planning_diagnostics::Metric;
+using planning_diagnostics::OutputMetric;
+
+namespace
+{
+constexpr int64_t ms = 1000000;  // [ns]
+
+autoware_planning_msgs::msg::Trajectory makeTrajectory(const double velocity)
+{
+  autoware_planning_msgs::msg::Trajectory traj;
+  for (int i = 0; i < 10; ++i) {
+    autoware_planning_msgs::msg::TrajectoryPoint p;
+    p.pose.position.x = static_cast<double>(i);
+    p.pose.orientation.w = 1.0;
+    p.longitudinal_velocity_mps = velocity;
+    traj.points.push_back(p);
+  }
+  return traj;
+}
+
+class BagEvaluatorTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    const auto * test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+    bag_path_ = (std::filesystem::temp_directory_path() /
+                 (std::string("test_bag_evaluator_") + test_info->name()))
+                  .string();
+    std::filesystem::remove_all(bag_path_);
+
+    parameters_.metrics_for_publish = {Metric::velocity};
+    parameters_.metrics_for_output = {OutputMetric::velocity};
+  }
+
+  void TearDown() override { std::filesystem::remove_all(bag_path_); }
+
+  // Write an odometry and a trajectory with the given velocity at each receive time
+  void writeBag(const std::vector<std::pair<int64_t, double>> & velocities)
+  {
+    rosbag2_storage::StorageOptions storage_options;
+    storage_options.uri = bag_path_;
+    storage_options.storage_id = "sqlite3";
+    rosbag2_cpp::ConverterOptions converter_options;
+    converter_options.input_serialization_format = "cdr";
+    converter_options.output_serialization_format = "cdr";
+
+    rosbag2_cpp::Writer writer;
+    writer.open(storage_options, converter_options);
+    nav_msgs::msg::Odometry odometry;
+    odometry.pose.pose.orientation.w = 1.0;
+    for (const auto & [stamp_ns, velocity] : velocities) {
+      const rclcpp::Time stamp(stamp_ns, RCL_ROS_TIME);
+      writer.write(odometry, parameters_.topics.odometry, stamp);
+      writer.write(makeTrajectory(velocity), parameters_.topics.trajectory, stamp);
+    }
+  }
+
+  std::string bag_path_;
+  BagEvaluatorParameters parameters_;
+};
+}  // namespace
+
+TEST_F(BagEvaluatorTest, EvaluateEveryTimerPeriod)
+{
+  // One message every period, the last one is evaluated at the end of the rosbag
+  std::vector<std::pair<int64_t, double>> velocities;
+  for (int64_t i = 0; i < 10; ++i) {
+    velocities.emplace_back(i * 100 * ms, static_cast<double>(i));
+  }
+  writeBag(velocities);
+
+  BagEvaluator bag_evaluator(parameters_);
+  bag_evaluator.evaluate(bag_path_);
+  const auto output = bag_evaluator.getOutputJson();
+
+  ASSERT_TRUE(output.contains("velocity"));
+  EXPECT_EQ(output["velocity"]["count"].get<unsigned int>(), 10u);
+  EXPECT_DOUBLE_EQ(output["velocity"]["min"].get<double>(), 0.0);
+  EXPECT_DOUBLE_EQ(output["velocity"]["max"].get<double>(), 9.0);
+  EXPECT_NEAR(output["velocity"]["mean"].get<double>(), 4.5, 1e-9);
+}
+
+TEST_F(BagEvaluatorTest, ReevaluateLatestMessage)
+{
+  // The first message is evaluated at 100, 200 and 300 ms, the second one at the end
+  writeBag({{0, 1.0}, {350 * ms, 5.0}});
+
+  BagEvaluator bag_evaluator(parameters_);
+  bag_evaluator.evaluate(bag_path_);
+  const auto output = bag_evaluator.getOutputJson();
+
+  ASSERT_TRUE(output.contains("velocity"));
+  EXPECT_EQ(output["velocity"]["count"].get<unsigned int>(), 4u);
+  EXPECT_NEAR(output["velocity"]["mean"].get<double>(), (3 * 1.0 + 5.0) / 4, 1e-9);
+}
+
+TEST_F(BagEvaluatorTest, EvaluateBagsReportsErrors)
+{
+  writeBag({{0, 1.0}});
+
+  const auto results = planning_diagnostics::evaluateBags(
+    {bag_path_, bag_path_ + "_missing"}, parameters_, 2);
+
+  ASSERT_EQ(results.size(), 2u);
+  EXPECT_TRUE(results.at(0).error.empty());
+  EXPECT_TRUE(results.at(0).output.contains("velocity"));
+  EXPECT_FALSE(results.at(1).error.empty());
+  EXPECT_TRUE(results.at(1).output.empty());
+}
@@ -0,0 +1,113 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/planning_evaluator/bag_evaluator.hpp"
+
+#include <autoware_vehicle_info_utils/vehicle_info_utils.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace planning_diagnostics
+{
+
+BagEvaluatorParameters declareBagEvaluatorParameters(rclcpp::Node & node)
+{
+  BagEvaluatorParameters parameters;
+  PlanningEvaluatorParameters & evaluator_parameters = parameters;
+  evaluator_parameters = declarePlanningEvaluatorParameters(node);
+
+  // Topics of the inputs in the rosbags
+  auto & topics = parameters.topics;
+  topics.odometry = node.declare_parameter<std::string>("input.odometry", topics.odometry);
+  topics.trajectory = node.declare_parameter<std::string>("input.trajectory", topics.trajectory);
+  topics.reference_trajectory =
+    node.declare_parameter<std::string>("input.reference_trajectory", topics.reference_trajectory);
+  topics.objects = node.declare_parameter<std::string>("input.objects", topics.objects);
+  topics.modified_goal =
+    node.declare_parameter<std::string>("input.modified_goal", topics.modified_goal);
+  topics.steering_status =
+    node.declare_parameter<std::string>("input.steering_status", topics.steering_status);
+  topics.turn_indicators_status = node.declare_parameter<std::string>(
+    "input.turn_indicators_status", topics.turn_indicators_status);
+
+  parameters.vehicle_length_m =
+    autoware::vehicle_info_utils::VehicleInfoUtils(node).getVehicleInfo().vehicle_length_m;
+  return parameters;
+}
+
+}  // namespace planning_diagnostics
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+  auto node = std::make_shared<rclcpp::Node>("planning_evaluator_bag");
+
+  int exit_code = 0;
+  try {
+    const auto parameters = planning_diagnostics::declareBagEvaluatorParameters(*node);
+    const auto bag_paths = node->declare_parameter<std::vector<std::string>>("bag_paths");
+    const auto output_directory = node->declare_parameter<std::string>("output_directory");
+    auto num_workers = node->declare_parameter<int64_t>("num_workers", 0);
+    if (num_workers <= 0) {
+      num_workers = std::max(1U, std::thread::hardware_concurrency());
+    }
+
+    if (!std::filesystem::exists(output_directory)) {
+      std::filesystem::create_directories(output_directory);
+    }
+
+    const auto results = planning_diagnostics::evaluateBags(
+      bag_paths, parameters, static_cast<size_t>(num_workers));
+
+    // Write one metrics .json per rosbag, named after it
+    for (const auto & result : results) {
+      if (!result.error.empty()) {
+        RCLCPP_ERROR(
+          node->get_logger(), "Failed to evaluate %s: %s", result.bag_path.c_str(),
+          result.error.c_str());
+        exit_code = 1;
+        continue;
+      }
+      const std::filesystem::path bag_path =
+        std::filesystem::path(result.bag_path).lexically_normal();
+      const std::string bag_name =
+        (bag_path.has_filename() ? bag_path : bag_path.parent_path()).stem().string();
+      const std::string output_file_str =
+        output_directory + "/autoware_planning_evaluator-" + bag_name + ".json";
+      std::ofstream f(output_file_str);
+      if (f.is_open()) {
+        f << result.output.dump(4);
+        f.close();
+      } else {
+        RCLCPP_ERROR(node->get_logger(), "Failed to open file: %s", output_file_str.c_str());
+        exit_code = 1;
+      }
+    }
+  } catch (const std::exception & e) {
+    RCLCPP_ERROR(node->get_logger(), "%s", e.what());
+    exit_code = 1;
+  }
+
+  rclcpp::shutdown();
+  return exit_code;
+}
@@ -49,6 +49,7 @@
 #include "autoware/costmap_generator/utils/points_to_costmap.hpp"
 #include "costmap_generator_node_parameters.hpp"
 
+#include <autoware/agnocast_wrapper/polling_subscriber.hpp>
 #include <autoware_lanelet2_extension/utility/message_conversion.hpp>
 #include <autoware_utils/ros/polling_subscriber.hpp>
 #include <autoware_utils/ros/processing_time_publisher.hpp>
@@ -103,9 +104,9 @@ private:
     pub_processing_time_ms_;
 
   rclcpp::Subscription<autoware_map_msgs::msg::LaneletMapBin>::SharedPtr sub_lanelet_bin_map_;
-  autoware_utils::InterProcessPollingSubscriber<sensor_msgs::msg::PointCloud2> sub_points_{
+  autoware::agnocast_wrapper::PollingSubscriber<sensor_msgs::msg::PointCloud2> sub_points_{
     this, "~/input/points_no_ground", autoware_utils::single_depth_sensor_qos()};
-  autoware_utils::InterProcessPollingSubscriber<PredictedObjects> sub_objects_{
+  autoware::agnocast_wrapper::PollingSubscriber<PredictedObjects> sub_objects_{
     this, "~/input/objects"};
   autoware_utils::InterProcessPollingSubscriber<autoware_internal_planning_msgs::msg::Scenario>
     sub_scenario_{this, "~/input/scenario"};
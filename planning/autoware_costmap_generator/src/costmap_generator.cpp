@@ -249,8 +249,8 @@ void CostmapGenerator::onLaneletMapBin(
 
 void CostmapGenerator::update_data()
 {
-  objects_ = sub_objects_.take_data();
-  points_ = sub_points_.take_data();
+  objects_ = sub_objects_.takeData();
+  points_ = sub_points_.takeData();
   scenario_ = sub_scenario_.take_data();
 }
 
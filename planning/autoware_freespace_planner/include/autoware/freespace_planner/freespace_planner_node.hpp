@@ -33,6 +33,7 @@
 
 #include "autoware_utils/ros/logger_level_configure.hpp"
 
+#include <autoware/agnocast_wrapper/polling_subscriber.hpp>
 #include <autoware/freespace_planning_algorithms/astar_search.hpp>
 #include <autoware/freespace_planning_algorithms/rrtstar.hpp>
 #include <autoware_utils/ros/polling_subscriber.hpp>
@@ -117,7 +118,7 @@ private:
 
   rclcpp::Subscription<LaneletRoute>::SharedPtr route_sub_;
 
-  autoware_utils::InterProcessPollingSubscriber<OccupancyGrid> occupancy_grid_sub_{
+  autoware::agnocast_wrapper::PollingSubscriber<OccupancyGrid> occupancy_grid_sub_{
     this, "~/input/occupancy_grid"};
   autoware_utils::InterProcessPollingSubscriber<Scenario> scenario_sub_{this, "~/input/scenario"};
   autoware_utils::InterProcessPollingSubscriber<Odometry, autoware_utils::polling_policy::All>
@@ -246,7 +246,7 @@ void FreespacePlannerNode::onOdometry(const Odometry::ConstSharedPtr msg)
 
 void FreespacePlannerNode::updateData()
 {
-  occupancy_grid_ = occupancy_grid_sub_.take_data();
+  occupancy_grid_ = occupancy_grid_sub_.takeData();
 
   {
     auto msgs = odom_sub_.take_data();
@@ -38,6 +38,8 @@
 #include <lanelet2_core/geometry/Lanelet.h>
 #include <tf2/utils.h>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <vector>
 
@@ -87,6 +89,13 @@ void DefaultPlanner::initialize_common(rclcpp::Node * node)
   param_.consider_no_drivable_lanes = node_->declare_parameter<bool>("consider_no_drivable_lanes");
   param_.check_footprint_inside_lanes =
     node_->declare_parameter<bool>("check_footprint_inside_lanes");
+  param_.enable_route_cache = node_->declare_parameter<bool>("route_cache.enable");
+  param_.route_cache_max_entries = node_->declare_parameter<int64_t>("route_cache.max_entries");
+  param_.route_cache_file_path = node_->declare_parameter<std::string>("route_cache.file_path");
+
+  route_cache_ = RouteCache(
+    static_cast<size_t>(std::max<int64_t>(param_.route_cache_max_entries, 0)),
+    param_.route_cache_file_path);
 }
 
 void DefaultPlanner::initialize(rclcpp::Node * node)
@@ -111,9 +120,26 @@ bool DefaultPlanner::ready() const
 void DefaultPlanner::map_callback(const LaneletMapBin::ConstSharedPtr msg)
 {
   route_handler_.setMap(*msg);
+  map_version_ = RouteCache::calc_map_version(msg->data);
+  update_map_cache();
   is_graph_ready_ = true;
 }
 
+void DefaultPlanner::update_map_cache()
+{
+  const auto lanelet_map_ptr = route_handler_.getLaneletMapPtr();
+  if (lanelet_map_ptr == cached_map_ptr_) {
+    return;
+  }
+  cached_map_ptr_ = lanelet_map_ptr;
+
+  // the routing graph is rebuilt with the map, so the cached routes are invalidated as well
+  route_cache_.reset(map_version_);
+  goal_lane_polygons_.clear();
+  parking_lots_ = lanelet::utils::query::getAllParkingLots(lanelet_map_ptr);
+  parking_spaces_ = lanelet::utils::query::getAllParkingSpaces(lanelet_map_ptr);
+}
+
 PlannerPlugin::MarkerArray DefaultPlanner::visualize(const LaneletRoute & route) const
 {
   lanelet::ConstLanelets route_lanelets;
@@ -189,6 +215,21 @@ bool DefaultPlanner::check_goal_footprint_inside_lanes(
   const lanelet::ConstLanelets & lanelets_near_goal,
   const autoware_utils::Polygon2d & goal_footprint) const
 {
+  // the combined polygon only depends on the lanelets, so it is reused for recurring goals.
+  // Lanelets without a valid id (i.e. not in the map) are not cached.
+  lanelet::Ids lanelet_ids;
+  for (const auto & lanelet : lanelets_near_goal) {
+    lanelet_ids.push_back(lanelet.id());
+  }
+  const bool is_cacheable = std::none_of(
+    lanelet_ids.begin(), lanelet_ids.end(), [](const auto id) { return id == lanelet::InvalId; });
+  if (is_cacheable) {
+    const auto itr = goal_lane_polygons_.find(lanelet_ids);
+    if (itr != goal_lane_polygons_.end()) {
+      return boost::geometry::covered_by(goal_footprint, itr->second);
+    }
+  }
+
   lanelet::Points3d left_bound_points;
   lanelet::Points3d right_bound_points;
 
@@ -222,12 +263,20 @@ bool DefaultPlanner::check_goal_footprint_inside_lanes(
       .basicPolygon();
   boost::geometry::correct(lane_polygon);
 
+  if (is_cacheable) {
+    if (goal_lane_polygons_.size() >= static_cast<size_t>(param_.route_cache_max_entries)) {
+      goal_lane_polygons_.clear();
+    }
+    goal_lane_polygons_.emplace(lanelet_ids, lane_polygon);
+  }
+
   return boost::geometry::covered_by(goal_footprint, lane_polygon);
 }
 
 bool DefaultPlanner::is_goal_valid(const geometry_msgs::msg::Pose & goal)
 {
   const auto logger = node_->get_logger();
+  update_map_cache();
 
   const auto goal_lanelet_pt = lanelet::utils::conversion::toLaneletPoint(goal.position);
 
@@ -289,9 +338,7 @@ bool DefaultPlanner::is_goal_valid(const geometry_msgs::msg::Pose & goal)
   if (
     param_.check_footprint_inside_lanes &&
     !check_goal_footprint_inside_lanes(lanelets_near_goal, polygon_footprint) &&
-    !is_in_parking_lot(
-      lanelet::utils::query::getAllParkingLots(route_handler_.getLaneletMapPtr()),
-      lanelet::utils::conversion::toLaneletPoint(goal.position))) {
+    !is_in_parking_lot(parking_lots_, goal_lanelet_pt)) {
     RCLCPP_WARN(logger, "Goal's footprint exceeds lane!");
     return false;
   }
@@ -308,16 +355,82 @@ bool DefaultPlanner::is_goal_valid(const geometry_msgs::msg::Pose & goal)
   }
 
   // check if goal is in parking space
-  const auto parking_spaces =
-    lanelet::utils::query::getAllParkingSpaces(route_handler_.getLaneletMapPtr());
-  if (is_in_parking_space(parking_spaces, goal_lanelet_pt)) {
+  if (is_in_parking_space(parking_spaces_, goal_lanelet_pt)) {
     return true;
   }
 
   // check if goal is in parking lot
-  const auto parking_lots =
-    lanelet::utils::query::getAllParkingLots(route_handler_.getLaneletMapPtr());
-  return is_in_parking_lot(parking_lots, goal_lanelet_pt);
+  return is_in_parking_lot(parking_lots_, goal_lanelet_pt);
+}
+
+std::optional<RouteCacheKey> DefaultPlanner::create_route_cache_key(
+  const Pose & start_check_point, const Pose & goal_check_point) const
+{
+  RouteCacheKey key;
+  key.consider_no_drivable_lanes = param_.consider_no_drivable_lanes;
+
+  const auto start_yaw = tf2::getYaw(start_check_point.orientation);
+  for (const auto & lanelet : route_handler_.getRoadLaneletsAtPose(start_check_point)) {
+    const auto lane_yaw = lanelet::utils::getLaneletAngle(lanelet, start_check_point.position);
+    if (std::abs(autoware_utils::normalize_radian(lane_yaw - start_yaw)) <= M_PI_2) {
+      key.start_lanelet_ids.push_back(lanelet.id());
+    }
+  }
+  if (key.start_lanelet_ids.empty()) {
+    return std::nullopt;
+  }
+  std::sort(key.start_lanelet_ids.begin(), key.start_lanelet_ids.end());
+
+  lanelet::ConstLanelet goal_lanelet;
+  if (!lanelet::utils::query::getClosestLanelet(
+        route_handler_.getRoadLaneletsAtPose(goal_check_point), goal_check_point, &goal_lanelet)) {
+    return std::nullopt;
+  }
+  key.goal_lanelet_id = goal_lanelet.id();
+
+  return key;
+}
+
+bool DefaultPlanner::plan_path_lanelets(
+  const Pose & start_check_point, const Pose & goal_check_point,
+  lanelet::ConstLanelets * path_lanelets)
+{
+  const auto key = param_.enable_route_cache
+                     ? create_route_cache_key(start_check_point, goal_check_point)
+                     : std::nullopt;
+
+  if (key) {
+    if (const auto cached_lanelet_ids = route_cache_.find(*key)) {
+      const auto lanelet_map_ptr = route_handler_.getLaneletMapPtr();
+      lanelet::ConstLanelets cached_lanelets;
+      for (const auto id : *cached_lanelet_ids) {
+        if (!lanelet_map_ptr->laneletLayer.exists(id)) {
+          cached_lanelets.clear();
+          break;
+        }
+        cached_lanelets.push_back(lanelet_map_ptr->laneletLayer.get(id));
+      }
+      if (!cached_lanelets.empty()) {
+        RCLCPP_DEBUG(node_->get_logger(), "route between check points is found in the cache.");
+        *path_lanelets = cached_lanelets;
+        return true;
+      }
+    }
+  }
+
+  if (!route_handler_.planPathLaneletsBetweenCheckpoints(
+        start_check_point, goal_check_point, path_lanelets, param_.consider_no_drivable_lanes)) {
+    return false;
+  }
+
+  if (key) {
+    lanelet::Ids path_lanelet_ids;
+    for (const auto & lanelet : *path_lanelets) {
+      path_lanelet_ids.push_back(lanelet.id());
+    }
+    route_cache_.insert(*key, path_lanelet_ids);
+  }
+  return true;
 }
 
 PlannerPlugin::LaneletRoute DefaultPlanner::plan(const RoutePoints & points)
@@ -335,13 +448,14 @@ PlannerPlugin::LaneletRoute DefaultPlanner::plan(const RoutePoints & points)
   LaneletRoute route_msg;
   RouteSections route_sections;
 
+  update_map_cache();
+
   lanelet::ConstLanelets all_route_lanelets;
   for (std::size_t i = 1; i < points.size(); i++) {
     const auto start_check_point = points.at(i - 1);
     const auto goal_check_point = points.at(i);
     lanelet::ConstLanelets path_lanelets;
-    if (!route_handler_.planPathLaneletsBetweenCheckpoints(
-          start_check_point, goal_check_point, &path_lanelets, param_.consider_no_drivable_lanes)) {
+    if (!plan_path_lanelets(start_check_point, goal_check_point, &path_lanelets)) {
       RCLCPP_WARN(logger, "Failed to plan route.");
       return route_msg;
     }
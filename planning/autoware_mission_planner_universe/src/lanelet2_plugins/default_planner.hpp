@@ -15,6 +15,8 @@
 #ifndef LANELET2_PLUGINS__DEFAULT_PLANNER_HPP_
 #define LANELET2_PLUGINS__DEFAULT_PLANNER_HPP_
 
+#include "route_cache.hpp"
+
 #include <autoware/mission_planner_universe/mission_planner_plugin.hpp>
 #include <autoware/route_handler/route_handler.hpp>
 #include <autoware_utils/geometry/geometry.hpp>
@@ -28,6 +30,9 @@
 #include <lanelet2_routing/RoutingGraph.h>
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 
+#include <map>
+#include <optional>
+#include <string>
 #include <vector>
 
 namespace autoware::mission_planner_universe::lanelet2
@@ -39,6 +44,9 @@ struct DefaultPlannerParameters
   bool enable_correct_goal_pose;
   bool consider_no_drivable_lanes;
   bool check_footprint_inside_lanes;
+  bool enable_route_cache;
+  int64_t route_cache_max_entries;
+  std::string route_cache_file_path;
 };
 
 class DefaultPlanner : public mission_planner_universe::PlannerPlugin
@@ -69,9 +77,39 @@ protected:
   rclcpp::Subscription<LaneletMapBin>::SharedPtr map_subscriber_;
   rclcpp::Publisher<MarkerArray>::SharedPtr pub_goal_footprint_marker_;
 
+  // map derived data, recomputed when the map of route_handler_ changes
+  RouteCache route_cache_;
+  uint64_t map_version_{0};
+  lanelet::LaneletMapConstPtr cached_map_ptr_{nullptr};
+  lanelet::ConstPolygons3d parking_lots_;
+  lanelet::ConstLineStrings3d parking_spaces_;
+  mutable std::map<lanelet::Ids, lanelet::BasicPolygon2d> goal_lane_polygons_;
+
   void initialize_common(rclcpp::Node * node);
   void map_callback(const LaneletMapBin::ConstSharedPtr msg);
 
+  /**
+   * @brief reset the route cache and the data precomputed from the map if the map has changed
+   */
+  void update_map_cache();
+
+  /**
+   * @brief create the route cache key of the path between two check points. The start lanelets
+   * are the candidates considered by RouteHandler::planPathLaneletsBetweenCheckpoints, i.e. the
+   * road lanelets containing the start whose direction is within 90 degrees of the start yaw.
+   * @return std::nullopt if the start or the goal is not on a road lanelet
+   */
+  [[nodiscard]] std::optional<RouteCacheKey> create_route_cache_key(
+    const Pose & start_check_point, const Pose & goal_check_point) const;
+
+  /**
+   * @brief plan the path lanelets between two check points, served from the route cache if
+   * possible
+   */
+  bool plan_path_lanelets(
+    const Pose & start_check_point, const Pose & goal_check_point,
+    lanelet::ConstLanelets * path_lanelets);
+
   /**
    * @brief check if the goal_footprint is within the lanelets closest to the goal plus the
    * succeeding lanelets around the goal
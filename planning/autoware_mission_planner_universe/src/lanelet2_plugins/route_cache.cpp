@@ -0,0 +1,180 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "route_cache.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+namespace autoware::mission_planner_universe::lanelet2
+{
+
+// the key is formatted as "<start ids separated by ','>;<goal id>;<consider_no_drivable_lanes>"
+std::string RouteCacheKey::to_string() const
+{
+  std::stringstream ss;
+  for (size_t i = 0; i < start_lanelet_ids.size(); ++i) {
+    ss << (i == 0 ? "" : ",") << start_lanelet_ids.at(i);
+  }
+  ss << ";" << goal_lanelet_id << ";" << (consider_no_drivable_lanes ? 1 : 0);
+  return ss.str();
+}
+
+std::optional<RouteCacheKey> RouteCacheKey::from_string(const std::string & str)
+{
+  std::stringstream ss(str);
+  std::string start_ids_str;
+  std::string goal_id_str;
+  std::string consider_no_drivable_lanes_str;
+  if (
+    !std::getline(ss, start_ids_str, ';') || !std::getline(ss, goal_id_str, ';') ||
+    !std::getline(ss, consider_no_drivable_lanes_str)) {
+    return std::nullopt;
+  }
+
+  RouteCacheKey key;
+  try {
+    std::stringstream start_ids_ss(start_ids_str);
+    std::string id_str;
+    while (std::getline(start_ids_ss, id_str, ',')) {
+      key.start_lanelet_ids.push_back(std::stoll(id_str));
+    }
+    key.goal_lanelet_id = std::stoll(goal_id_str);
+  } catch (const std::exception &) {
+    return std::nullopt;
+  }
+  key.consider_no_drivable_lanes = consider_no_drivable_lanes_str == "1";
+  if (key.start_lanelet_ids.empty()) {
+    return std::nullopt;
+  }
+  return key;
+}
+
+RouteCache::RouteCache(const size_t max_entries, std::string file_path)
+: max_entries_(max_entries), file_path_(std::move(file_path))
+{
+}
+
+void RouteCache::reset(const uint64_t map_version)
+{
+  map_version_ = map_version;
+  entries_.clear();
+  insertion_order_.clear();
+  load();
+}
+
+std::optional<lanelet::Ids> RouteCache::find(const RouteCacheKey & key) const
+{
+  const auto itr = entries_.find(key.to_string());
+  if (itr == entries_.end()) {
+    return std::nullopt;
+  }
+  return itr->second;
+}
+
+void RouteCache::insert(const RouteCacheKey & key, const lanelet::Ids & path_lanelet_ids)
+{
+  if (max_entries_ == 0 || path_lanelet_ids.empty()) {
+    return;
+  }
+
+  const auto key_str = key.to_string();
+  if (entries_.count(key_str) == 0) {
+    while (entries_.size() >= max_entries_) {
+      entries_.erase(insertion_order_.front());
+      insertion_order_.pop_front();
+    }
+    insertion_order_.push_back(key_str);
+  }
+  entries_[key_str] = path_lanelet_ids;
+  save();
+}
+
+uint64_t RouteCache::calc_map_version(const std::vector<uint8_t> & map_data)
+{
+  uint64_t hash = 14695981039346656037ULL;
+  for (const auto byte : map_data) {
+    hash ^= byte;
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+// the file consists of the map version on the first line followed by one entry per line as
+// "<key> <path lanelet ids separated by ' '>"
+void RouteCache::load()
+{
+  if (file_path_.empty()) {
+    return;
+  }
+
+  std::ifstream ifs(file_path_);
+  if (!ifs) {
+    return;
+  }
+
+  uint64_t file_map_version = 0;
+  if (!(ifs >> file_map_version) || file_map_version != map_version_) {
+    return;
+  }
+
+  std::string line;
+  while (std::getline(ifs, line) && entries_.size() < max_entries_) {
+    std::stringstream ss(line);
+    std::string key_str;
+    if (!(ss >> key_str) || !RouteCacheKey::from_string(key_str)) {
+      continue;
+    }
+    lanelet::Ids path_lanelet_ids;
+    lanelet::Id id{};
+    while (ss >> id) {
+      path_lanelet_ids.push_back(id);
+    }
+    if (path_lanelet_ids.empty() || entries_.count(key_str) != 0) {
+      continue;
+    }
+    entries_.emplace(key_str, std::move(path_lanelet_ids));
+    insertion_order_.push_back(key_str);
+  }
+}
+
+void RouteCache::save() const
+{
+  if (file_path_.empty()) {
+    return;
+  }
+
+  // write to a temporary file and rename it so that a crash never leaves a truncated cache
+  const auto tmp_file_path = file_path_ + ".tmp";
+  {
+    std::ofstream ofs(tmp_file_path, std::ios::trunc);
+    if (!ofs) {
+      return;
+    }
+    ofs << map_version_ << "\n";
+    for (const auto & key_str : insertion_order_) {
+      ofs << key_str;
+      for (const auto id : entries_.at(key_str)) {
+        ofs << " " << id;
+      }
+      ofs << "\n";
+    }
+  }
+  std::rename(tmp_file_path.c_str(), file_path_.c_str());
+}
+
+}  // namespace autoware::mission_planner_universe::lanelet2
@@ -0,0 +1,87 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_PLUGINS__ROUTE_CACHE_HPP_
+#define LANELET2_PLUGINS__ROUTE_CACHE_HPP_
+
+#include <lanelet2_core/Forward.h>
+
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace autoware::mission_planner_universe::lanelet2
+{
+
+/**
+ * @brief key of a route between two consecutive check points
+ */
+struct RouteCacheKey
+{
+  lanelet::Ids start_lanelet_ids;  // candidate start lanelets, sorted
+  lanelet::Id goal_lanelet_id{lanelet::InvalId};
+  bool consider_no_drivable_lanes{false};
+
+  [[nodiscard]] std::string to_string() const;
+  static std::optional<RouteCacheKey> from_string(const std::string & str);
+};
+
+/**
+ * @brief cache of the path lanelets planned between two check points, valid for one map version.
+ * The entries are optionally persisted to a file so that recurring missions are served from the
+ * cache after a restart.
+ */
+class RouteCache
+{
+public:
+  RouteCache() = default;
+  RouteCache(const size_t max_entries, std::string file_path);
+
+  /**
+   * @brief drop all the entries and load the persisted ones planned on the given map version
+   */
+  void reset(const uint64_t map_version);
+
+  [[nodiscard]] std::optional<lanelet::Ids> find(const RouteCacheKey & key) const;
+
+  /**
+   * @brief add an entry, evicting the oldest one when the cache is full, and persist the cache
+   */
+  void insert(const RouteCacheKey & key, const lanelet::Ids & path_lanelet_ids);
+
+  [[nodiscard]] size_t size() const { return entries_.size(); }
+  [[nodiscard]] uint64_t map_version() const { return map_version_; }
+
+  /**
+   * @brief FNV-1a hash of the serialized map, used as its version
+   */
+  static uint64_t calc_map_version(const std::vector<uint8_t> & map_data);
+
+private:
+  void load();
+  void save() const;
+
+  size_t max_entries_{0};
+  std::string file_path_;
+  uint64_t map_version_{0};
+  std::unordered_map<std::string, lanelet::Ids> entries_;
+  std::deque<std::string> insertion_order_;
+};
+
+}  // namespace autoware::mission_planner_universe::lanelet2
+
+#endif  // LANELET2_PLUGINS__ROUTE_CACHE_HPP_
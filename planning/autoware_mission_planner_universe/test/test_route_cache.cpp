@@ -0,0 +1,120 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <../src/lanelet2_plugins/route_cache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using autoware::mission_planner_universe::lanelet2::RouteCache;
+using autoware::mission_planner_universe::lanelet2::RouteCacheKey;
+
+namespace
+{
+RouteCacheKey create_key(const lanelet::Ids & start_ids, const lanelet::Id goal_id)
+{
+  RouteCacheKey key;
+  key.start_lanelet_ids = start_ids;
+  key.goal_lanelet_id = goal_id;
+  return key;
+}
+}  // namespace
+
+TEST(TestRouteCache, keySerialization)
+{
+  auto key = create_key({1, 2, 3}, 10);
+  key.consider_no_drivable_lanes = true;
+  EXPECT_EQ(key.to_string(), "1,2,3;10;1");
+
+  const auto parsed = RouteCacheKey::from_string(key.to_string());
+  ASSERT_TRUE(parsed.has_value());
+  EXPECT_EQ(parsed->start_lanelet_ids, key.start_lanelet_ids);
+  EXPECT_EQ(parsed->goal_lanelet_id, key.goal_lanelet_id);
+  EXPECT_TRUE(parsed->consider_no_drivable_lanes);
+
+  EXPECT_FALSE(RouteCacheKey::from_string("").has_value());
+  EXPECT_FALSE(RouteCacheKey::from_string(";10;0").has_value());
+  EXPECT_FALSE(RouteCacheKey::from_string("a;10;0").has_value());
+}
+
+TEST(TestRouteCache, findAndEvict)
+{
+  RouteCache cache(2, "");
+  cache.reset(1);
+
+  EXPECT_FALSE(cache.find(create_key({1}, 10)).has_value());
+
+  cache.insert(create_key({1}, 10), {1, 5, 10});
+  cache.insert(create_key({2}, 10), {2, 10});
+  ASSERT_TRUE(cache.find(create_key({1}, 10)).has_value());
+  EXPECT_EQ(*cache.find(create_key({1}, 10)), (lanelet::Ids{1, 5, 10}));
+
+  // consider_no_drivable_lanes is a part of the key
+  auto key = create_key({1}, 10);
+  key.consider_no_drivable_lanes = true;
+  EXPECT_FALSE(cache.find(key).has_value());
+
+  // the oldest entry is evicted
+  cache.insert(create_key({3}, 10), {3, 10});
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_FALSE(cache.find(create_key({1}, 10)).has_value());
+  EXPECT_TRUE(cache.find(create_key({3}, 10)).has_value());
+
+  // a new map clears the cache
+  cache.reset(2);
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(TestRouteCache, persistence)
+{
+  const auto file_path =
+    (std::filesystem::temp_directory_path() / "test_mission_planner_route_cache.txt").string();
+  std::remove(file_path.c_str());
+
+  {
+    RouteCache cache(10, file_path);
+    cache.reset(42);
+    cache.insert(create_key({1, 2}, 10), {1, 5, 10});
+  }
+
+  // the entries are loaded for the same map version
+  {
+    RouteCache cache(10, file_path);
+    cache.reset(42);
+    ASSERT_TRUE(cache.find(create_key({1, 2}, 10)).has_value());
+    EXPECT_EQ(*cache.find(create_key({1, 2}, 10)), (lanelet::Ids{1, 5, 10}));
+  }
+
+  // and discarded for another one
+  {
+    RouteCache cache(10, file_path);
+    cache.reset(43);
+    EXPECT_EQ(cache.size(), 0u);
+  }
+
+  std::remove(file_path.c_str());
+}
+
+TEST(TestRouteCache, mapVersion)
+{
+  const std::vector<uint8_t> map_data{0, 1, 2, 3};
+  const std::vector<uint8_t> modified_map_data{0, 1, 2, 4};
+  EXPECT_EQ(RouteCache::calc_map_version(map_data), RouteCache::calc_map_version(map_data));
+  EXPECT_NE(
+    RouteCache::calc_map_version(map_data), RouteCache::calc_map_version(modified_map_data));
+}
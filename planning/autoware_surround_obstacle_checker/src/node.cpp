@@ -129,8 +129,8 @@ void SurroundObstacleCheckerNode::onTimer()
   stop_watch.tic();
 
   odometry_ptr_ = sub_odometry_.take_data();
-  pointcloud_ptr_ = sub_pointcloud_.take_data();
-  object_ptr_ = sub_dynamic_objects_.take_data();
+  pointcloud_ptr_ = sub_pointcloud_.takeData();
+  object_ptr_ = sub_dynamic_objects_.takeData();
 
   if (!odometry_ptr_) {
     RCLCPP_INFO_THROTTLE(
@@ -21,6 +21,7 @@
 #include "autoware_utils/ros/logger_level_configure.hpp"
 #include "planner_manager.hpp"
 
+#include <autoware/agnocast_wrapper/polling_subscriber.hpp>
 #include <autoware/planning_factor_interface/planning_factor_interface.hpp>
 #include <autoware_utils/ros/polling_subscriber.hpp>
 #include <autoware_utils/ros/published_time_publisher.hpp>
@@ -100,11 +101,11 @@ private:
     acceleration_subscriber_{this, "~/input/accel"};
   autoware_utils::InterProcessPollingSubscriber<Scenario> scenario_subscriber_{
     this, "~/input/scenario"};
-  autoware_utils::InterProcessPollingSubscriber<PredictedObjects> perception_subscriber_{
+  autoware::agnocast_wrapper::PollingSubscriber<PredictedObjects> perception_subscriber_{
     this, "~/input/perception"};
-  autoware_utils::InterProcessPollingSubscriber<OccupancyGrid> occupancy_grid_subscriber_{
+  autoware::agnocast_wrapper::PollingSubscriber<OccupancyGrid> occupancy_grid_subscriber_{
     this, "~/input/occupancy_grid_map"};
-  autoware_utils::InterProcessPollingSubscriber<OccupancyGrid> costmap_subscriber_{
+  autoware::agnocast_wrapper::PollingSubscriber<OccupancyGrid> costmap_subscriber_{
     this, "~/input/costmap"};
   autoware_utils::InterProcessPollingSubscriber<TrafficLightGroupArray> traffic_signals_subscriber_{
     this, "~/input/traffic_signals"};
@@ -202,21 +202,21 @@ void BehaviorPathPlannerNode::takeData()
   }
   // perception
   {
-    const auto msg = perception_subscriber_.take_data();
+    const auto msg = perception_subscriber_.takeData();
     if (msg) {
       planner_data_->dynamic_object = msg;
     }
   }
   // occupancy_grid
   {
-    const auto msg = occupancy_grid_subscriber_.take_data();
+    const auto msg = occupancy_grid_subscriber_.takeData();
     if (msg) {
       planner_data_->occupancy_grid = msg;
     }
   }
   // costmap
   {
-    const auto msg = costmap_subscriber_.take_data();
+    const auto msg = costmap_subscriber_.takeData();
     if (msg) {
       planner_data_->costmap = msg;
     }
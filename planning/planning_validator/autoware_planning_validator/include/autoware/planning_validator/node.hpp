@@ -20,6 +20,7 @@
 #include "autoware/planning_validator/types.hpp"
 #include "autoware_planning_validator/msg/planning_validator_status.hpp"
 
+#include <autoware/agnocast_wrapper/polling_subscriber.hpp>
 #include <autoware_utils/ros/logger_level_configure.hpp>
 #include <autoware_utils/ros/parameter.hpp>
 #include <autoware_utils/ros/polling_subscriber.hpp>
@@ -76,7 +77,7 @@ private:
     this, "~/input/acceleration"};
   autoware_utils::InterProcessPollingSubscriber<Trajectory> sub_trajectory_{
     this, "~/input/trajectory"};
-  autoware_utils::InterProcessPollingSubscriber<PointCloud2> sub_pointcloud_{
+  autoware::agnocast_wrapper::PollingSubscriber<PointCloud2> sub_pointcloud_{
     this, "~/input/pointcloud", autoware_utils::single_depth_sensor_qos()};
   autoware_utils::InterProcessPollingSubscriber<
     LaneletRoute, autoware_utils::polling_policy::Newest>
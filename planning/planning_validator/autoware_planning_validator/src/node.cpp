@@ -109,7 +109,7 @@ void PlanningValidatorNode::setData()
   auto & data = context_->data;
   data->current_kinematics = sub_kinematics_.take_data();
   data->current_acceleration = sub_acceleration_.take_data();
-  data->obstacle_pointcloud = sub_pointcloud_.take_data();
+  data->obstacle_pointcloud = sub_pointcloud_.takeData();
   data->set_current_trajectory(sub_trajectory_.take_data());
   data->set_route(sub_route_.take_data());
   data->set_map(sub_lanelet_map_bin_.take_data());
@@ -16,6 +16,7 @@
 #define AUTOWARE__PLANNING_VALIDATOR_TRAJECTORY_CHECKER__TRAJECTORY_CHECKER_HPP_
 
 #include "autoware/planning_validator_trajectory_checker/parameters.hpp"
+#include "autoware/planning_validator_trajectory_checker/utils.hpp"
 
 #include <autoware/planning_validator/plugin_interface.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -89,9 +90,17 @@ public:
 private:
   void setup_parameters(rclcpp::Node & node);
 
+  const trajectory_checker_utils::TrajectoryMetrics & get_metrics(
+    const std::shared_ptr<const PlanningValidatorData> & data);
+
   bool is_critical_error_ = false;
 
   TrajectoryCheckerParams params_;
+
+  // metrics are computed once per validate() and shared by the checks
+  trajectory_checker_utils::TrajectoryMetricsBuffer metrics_buffer_;
+  trajectory_checker_utils::TrajectoryMetrics metrics_;
+  bool is_metrics_updated_ = false;
 };
 
 }  // namespace autoware::planning_validator
@@ -28,6 +28,43 @@ namespace autoware::planning_validator::trajectory_checker_utils
 using autoware_planning_msgs::msg::Trajectory;
 using autoware_planning_msgs::msg::TrajectoryPoint;
 
+/**
+ * @brief maximum (or minimum) value and its index of the metrics checked by TrajectoryChecker
+ */
+struct TrajectoryMetrics
+{
+  // metrics of the original trajectory
+  std::pair<double, size_t> max_interval_distance{0.0, 0};
+  std::pair<double, size_t> max_longitudinal_acc{0.0, 0};
+  std::pair<double, size_t> min_longitudinal_acc{0.0, 0};
+
+  // metrics of the resampled trajectory
+  std::pair<double, size_t> max_relative_angle{0.0, 0};
+  std::pair<double, size_t> max_curvature{0.0, 0};
+  std::pair<double, size_t> max_lateral_acc{0.0, 0};
+  std::pair<double, size_t> max_lateral_jerk{0.0, 0};
+  std::pair<double, size_t> max_steering{0.0, 0};
+  std::pair<double, size_t> max_steering_rate{0.0, 0};
+};
+
+/**
+ * @brief point-wise work buffers kept by the caller so that repeated calculation does not allocate
+ */
+struct TrajectoryMetricsBuffer
+{
+  std::vector<double> interval;
+  std::vector<double> arc_length;
+  std::vector<double> curvature;
+};
+
+void calcArcLength(const Trajectory & trajectory, std::vector<double> & arc_length);
+
+void calcCurvature(
+  const Trajectory & trajectory, const std::vector<double> & arc_length,
+  std::vector<double> & curvature_vector);
+
+void calcCurvature(const Trajectory & trajectory, std::vector<double> & curvature_vector);
+
 std::pair<double, size_t> calcMaxCurvature(const Trajectory & trajectory);
 
 void calc_interval_distance(
@@ -51,6 +88,19 @@ std::pair<double, size_t> calcMaxSteeringAngles(
 std::pair<double, size_t> calcMaxSteeringRates(
   const Trajectory & trajectory, const double wheelbase);
 
+/**
+ * @brief calculate the interval and longitudinal acceleration metrics in a single pass
+ */
+void calcTrajectoryMetrics(const Trajectory & trajectory, TrajectoryMetrics & metrics);
+
+/**
+ * @brief calculate the relative angle, curvature, lateral acceleration, lateral jerk, steering and
+ * steering rate metrics in two passes, which give the same results as the individual functions
+ */
+void calcResampledTrajectoryMetrics(
+  const Trajectory & trajectory, const double wheelbase, TrajectoryMetricsBuffer & buffer,
+  TrajectoryMetrics & metrics);
+
 bool checkFinite(const TrajectoryPoint & point);
 
 }  // namespace autoware::planning_validator::trajectory_checker_utils
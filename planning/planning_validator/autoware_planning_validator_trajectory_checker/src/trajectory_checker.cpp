@@ -167,6 +167,10 @@ void TrajectoryChecker::validate(bool & is_critical)
       "trajectory has invalid value (NaN, Inf, etc). Stop validation process, raise an error.");
   }
 
+  // all the point-wise metrics are computed at once, the following checks only read them
+  get_metrics(data);
+  is_metrics_updated_ = true;
+
   status->is_valid_interval = check_valid_interval(data, status);
   status->is_valid_longitudinal_max_acc = check_valid_max_longitudinal_acceleration(data, status);
   status->is_valid_longitudinal_min_acc = check_valid_min_longitudinal_acceleration(data, status);
@@ -184,9 +188,25 @@ void TrajectoryChecker::validate(bool & is_critical)
   status->is_valid_steering = check_valid_steering(data, status, vehicle_wheel_base_m);
   status->is_valid_steering_rate = check_valid_steering_rate(data, status, vehicle_wheel_base_m);
 
+  is_metrics_updated_ = false;
+
   is_critical = is_critical_error_;
 }
 
+const trajectory_checker_utils::TrajectoryMetrics & TrajectoryChecker::get_metrics(
+  const std::shared_ptr<const PlanningValidatorData> & data)
+{
+  if (is_metrics_updated_) {
+    return metrics_;
+  }
+
+  trajectory_checker_utils::calcTrajectoryMetrics(*data->current_trajectory, metrics_);
+  trajectory_checker_utils::calcResampledTrajectoryMetrics(
+    *data->resampled_current_trajectory, context_->vehicle_info.wheel_base_m, metrics_buffer_,
+    metrics_);
+  return metrics_;
+}
+
 bool TrajectoryChecker::check_valid_size(
   const std::shared_ptr<const PlanningValidatorData> & data,
   const std::shared_ptr<PlanningValidatorStatus> & status)
@@ -215,8 +235,7 @@ bool TrajectoryChecker::check_valid_interval(
 
   const auto & trajectory = *data->current_trajectory;
 
-  const auto [max_interval_distance, i] =
-    trajectory_checker_utils::calcMaxIntervalDistance(trajectory);
+  const auto [max_interval_distance, i] = get_metrics(data).max_interval_distance;
   status->max_interval_distance = max_interval_distance;
 
   if (max_interval_distance > params_.interval.threshold) {
@@ -242,7 +261,7 @@ bool TrajectoryChecker::check_valid_relative_angle(
 
   const auto & trajectory = *data->resampled_current_trajectory;
 
-  const auto [max_relative_angle, i] = trajectory_checker_utils::calcMaxRelativeAngles(trajectory);
+  const auto [max_relative_angle, i] = get_metrics(data).max_relative_angle;
   status->max_relative_angle = max_relative_angle;
 
   if (max_relative_angle > params_.relative_angle.threshold) {
@@ -268,7 +287,7 @@ bool TrajectoryChecker::check_valid_curvature(
 
   const auto & trajectory = *data->resampled_current_trajectory;
 
-  const auto [max_curvature, i] = trajectory_checker_utils::calcMaxCurvature(trajectory);
+  const auto [max_curvature, i] = get_metrics(data).max_curvature;
   status->max_curvature = max_curvature;
   if (max_curvature > params_.curvature.threshold) {
     const auto & p = trajectory.points;
@@ -293,8 +312,7 @@ bool TrajectoryChecker::check_valid_lateral_acceleration(
 
   const auto & trajectory = *data->resampled_current_trajectory;
 
-  const auto [max_lateral_acc, i] =
-    trajectory_checker_utils::calcMaxLateralAcceleration(trajectory);
+  const auto [max_lateral_acc, i] = get_metrics(data).max_lateral_acc;
   status->max_lateral_acc = max_lateral_acc;
   if (max_lateral_acc > params_.lateral_accel.threshold) {
     context_->debug_pose_publisher->pushPoseMarker(trajectory.points.at(i), "lateral_acceleration");
@@ -314,7 +332,7 @@ bool TrajectoryChecker::check_valid_lateral_jerk(
 
   const auto & trajectory = *data->resampled_current_trajectory;
 
-  const auto [max_lateral_jerk, i] = trajectory_checker_utils::calc_max_lateral_jerk(trajectory);
+  const auto [max_lateral_jerk, i] = get_metrics(data).max_lateral_jerk;
   status->max_lateral_jerk = max_lateral_jerk;
   if (max_lateral_jerk > params_.lateral_jerk.threshold) {
     context_->debug_pose_publisher->pushPoseMarker(trajectory.points.at(i), "lateral_jerk");
@@ -334,8 +352,7 @@ bool TrajectoryChecker::check_valid_min_longitudinal_acceleration(
 
   const auto & trajectory = *data->current_trajectory;
 
-  const auto [min_longitudinal_acc, i] =
-    trajectory_checker_utils::getMinLongitudinalAcc(trajectory);
+  const auto [min_longitudinal_acc, i] = get_metrics(data).min_longitudinal_acc;
   status->min_longitudinal_acc = min_longitudinal_acc;
 
   if (min_longitudinal_acc < params_.min_lon_accel.threshold) {
@@ -357,8 +374,7 @@ bool TrajectoryChecker::check_valid_max_longitudinal_acceleration(
 
   const auto & trajectory = *data->current_trajectory;
 
-  const auto [max_longitudinal_acc, i] =
-    trajectory_checker_utils::getMaxLongitudinalAcc(trajectory);
+  const auto [max_longitudinal_acc, i] = get_metrics(data).max_longitudinal_acc;
   status->max_longitudinal_acc = max_longitudinal_acc;
 
   if (max_longitudinal_acc > params_.max_lon_accel.threshold) {
@@ -380,8 +396,11 @@ bool TrajectoryChecker::check_valid_steering(
 
   const auto & trajectory = *data->resampled_current_trajectory;
 
+  // the cached metrics are computed with the wheelbase of the context
   const auto [max_steering, i] =
-    trajectory_checker_utils::calcMaxSteeringAngles(trajectory, vehicle_wheel_base_m);
+    is_metrics_updated_
+      ? get_metrics(data).max_steering
+      : trajectory_checker_utils::calcMaxSteeringAngles(trajectory, vehicle_wheel_base_m);
   status->max_steering = max_steering;
 
   if (max_steering > params_.steering.threshold) {
@@ -403,7 +422,9 @@ bool TrajectoryChecker::check_valid_steering_rate(
   const auto & trajectory = *data->resampled_current_trajectory;
 
   const auto [max_steering_rate, i] =
-    trajectory_checker_utils::calcMaxSteeringRates(trajectory, vehicle_wheel_base_m);
+    is_metrics_updated_
+      ? get_metrics(data).max_steering_rate
+      : trajectory_checker_utils::calcMaxSteeringRates(trajectory, vehicle_wheel_base_m);
   status->max_steering_rate = max_steering_rate;
 
   if (max_steering_rate > params_.steering_rate.threshold) {
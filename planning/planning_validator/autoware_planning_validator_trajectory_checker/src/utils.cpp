@@ -55,67 +55,89 @@ std::pair<double, size_t> getAbsMaxValAndIdx(const std::vector<double> & v)
   return {std::abs(*iter), idx};
 }
 
-// calculate curvature from three points with curvature_distance
-void calcCurvature(const Trajectory & trajectory, std::vector<double> & curvature_vector)
+void calcArcLength(const Trajectory & trajectory, std::vector<double> & arc_length)
 {
-  curvature_vector = std::vector<double>(trajectory.points.size(), 0.0);
-  if (trajectory.points.size() < 3) {
-    return;
+  arc_length.assign(trajectory.points.size(), 0.0);
+  for (size_t i = 1; i < trajectory.points.size(); ++i) {
+    arc_length[i] =
+      arc_length[i - 1] + calc_distance2d(trajectory.points[i - 1], trajectory.points[i]);
   }
+}
 
-  // calc arc length array: arc_length(3) - arc_length(0) is distance from point(3) to point(0)
-  std::vector<double> arc_length(trajectory.points.size(), 0.0);
-  for (size_t i = 1; i < trajectory.points.size(); ++i) {
-    arc_length.at(i) =
-      arc_length.at(i - 1) + calc_distance2d(trajectory.points.at(i - 1), trajectory.points.at(i));
+// calculate curvature from three points with curvature_distance
+void calcCurvature(
+  const Trajectory & trajectory, const std::vector<double> & arc_length,
+  std::vector<double> & curvature_vector)
+{
+  const auto & points = trajectory.points;
+  curvature_vector.assign(points.size(), 0.0);
+  if (points.size() < 3) {
+    return;
   }
 
   constexpr double curvature_distance = 1.0;  // [m]
 
+  // Since the arc length is monotonic, the points farther than curvature_distance behind (ahead
+  // of) the point i form a prefix (suffix) of the trajectory whose boundary only moves forward as i
+  // increases. The boundaries are tracked with two pointers instead of searching for every point.
   size_t first_distant_index = 0;
-  size_t last_distant_index = trajectory.points.size() - 1;
-  for (size_t i = 1; i < trajectory.points.size() - 1; ++i) {
-    // find the previous point
+  size_t last_distant_index = points.size() - 1;
+  // arc_length[i] - arc_length[j] > curvature_distance holds for j < prev_end
+  size_t prev_end = 0;
+  // arc_length[j] - arc_length[i] > curvature_distance holds for j >= next_begin
+  size_t next_begin = 1;
+  for (size_t i = 1; i < points.size() - 1; ++i) {
+    while (prev_end < i && arc_length[i] - arc_length[prev_end] > curvature_distance) {
+      ++prev_end;
+    }
+    next_begin = std::max(next_begin, i + 1);
+    while (next_begin < points.size() &&
+           arc_length[next_begin] - arc_length[i] <= curvature_distance) {
+      ++next_begin;
+    }
+
+    // find the previous point (the first point is used if no other point is distant enough)
     size_t prev_idx = 0;
-    for (size_t j = i - 1; j > 0; --j) {
-      if (arc_length.at(i) - arc_length.at(j) > curvature_distance) {
-        if (first_distant_index == 0) {
-          first_distant_index = i;  // save first index that meets distance requirement
-        }
-        prev_idx = j;
-        break;
+    if (prev_end > 1) {
+      if (first_distant_index == 0) {
+        first_distant_index = i;  // save first index that meets distance requirement
       }
+      prev_idx = prev_end - 1;
     }
 
-    // find the next point
-    size_t next_idx = trajectory.points.size() - 1;
-    for (size_t j = i + 1; j < trajectory.points.size(); ++j) {
-      if (arc_length.at(j) - arc_length.at(i) > curvature_distance) {
-        last_distant_index = i;  // save last index that meets distance requirement
-        next_idx = j;
-        break;
-      }
+    // find the next point (the last point is used if no other point is distant enough)
+    size_t next_idx = points.size() - 1;
+    if (next_begin < points.size()) {
+      last_distant_index = i;  // save last index that meets distance requirement
+      next_idx = next_begin;
     }
 
-    const auto p1 = get_point(trajectory.points.at(prev_idx));
-    const auto p2 = get_point(trajectory.points.at(i));
-    const auto p3 = get_point(trajectory.points.at(next_idx));
+    const auto p1 = get_point(points[prev_idx]);
+    const auto p2 = get_point(points[i]);
+    const auto p3 = get_point(points[next_idx]);
     try {
-      curvature_vector.at(i) = autoware_utils::calc_curvature(p1, p2, p3);
+      curvature_vector[i] = autoware_utils::calc_curvature(p1, p2, p3);
     } catch (...) {
-      curvature_vector.at(i) = 0.0;  // maybe distance is too close
+      curvature_vector[i] = 0.0;  // maybe distance is too close
     }
   }
 
   // use previous or last curvature where the distance is not enough
   for (size_t i = first_distant_index; i > 0; --i) {
-    curvature_vector.at(i - 1) = curvature_vector.at(i);
+    curvature_vector[i - 1] = curvature_vector[i];
   }
   for (size_t i = last_distant_index; i < curvature_vector.size() - 1; ++i) {
-    curvature_vector.at(i + 1) = curvature_vector.at(i);
+    curvature_vector[i + 1] = curvature_vector[i];
   }
 }
 
+void calcCurvature(const Trajectory & trajectory, std::vector<double> & curvature_vector)
+{
+  std::vector<double> arc_length;
+  calcArcLength(trajectory, arc_length);
+  calcCurvature(trajectory, arc_length, curvature_vector);
+}
+
 std::pair<double, size_t> calcMaxCurvature(const Trajectory & trajectory)
 {
   if (trajectory.points.size() < 3) {
@@ -360,6 +382,108 @@ std::pair<double, size_t> calcMaxSteeringRates(
   return {max_steering_rate, max_index};
 }
 
+void calcTrajectoryMetrics(const Trajectory & trajectory, TrajectoryMetrics & metrics)
+{
+  metrics.max_interval_distance = {0.0, 0};
+  metrics.max_longitudinal_acc = {0.0, 0};
+  metrics.min_longitudinal_acc = {0.0, 0};
+
+  const auto & points = trajectory.points;
+  for (size_t i = 0; i < points.size(); ++i) {
+    const double acc = points[i].acceleration_mps2;
+    takeBigger(metrics.max_longitudinal_acc.first, metrics.max_longitudinal_acc.second, acc, i);
+    takeSmaller(metrics.min_longitudinal_acc.first, metrics.min_longitudinal_acc.second, acc, i);
+    if (i + 1 < points.size()) {
+      const double d = calc_distance2d(points[i], points[i + 1]);
+      takeBigger(metrics.max_interval_distance.first, metrics.max_interval_distance.second, d, i);
+    }
+  }
+}
+
+void calcResampledTrajectoryMetrics(
+  const Trajectory & trajectory, const double wheelbase, TrajectoryMetricsBuffer & buffer,
+  TrajectoryMetrics & metrics)
+{
+  metrics.max_relative_angle = {0.0, 0};
+  metrics.max_curvature = {0.0, 0};
+  metrics.max_lateral_acc = {0.0, 0};
+  metrics.max_lateral_jerk = {0.0, 0};
+  metrics.max_steering = {0.0, 0};
+  metrics.max_steering_rate = {0.0, 0};
+
+  const auto & points = trajectory.points;
+  const size_t n = points.size();
+  if (n == 0) {
+    return;
+  }
+
+  // first pass: segment length, arc length and relative angle of the adjacent segments
+  buffer.interval.resize(n - 1);
+  buffer.arc_length.resize(n);
+  buffer.arc_length[0] = 0.0;
+  double prev_azimuth = 0.0;
+  for (size_t i = 1; i < n; ++i) {
+    const auto & p_prev = points[i - 1].pose.position;
+    const auto & p_curr = points[i].pose.position;
+    buffer.interval[i - 1] = calc_distance2d(points[i - 1], points[i]);
+    buffer.arc_length[i] = buffer.arc_length[i - 1] + buffer.interval[i - 1];
+
+    const double azimuth = autoware_utils::calc_azimuth_angle(p_prev, p_curr);
+    if (i >= 2) {
+      // convert relative angle to [-pi ~ pi]
+      const double relative_angle =
+        std::abs(autoware_utils::normalize_radian(azimuth - prev_azimuth));
+      takeBigger(
+        metrics.max_relative_angle.first, metrics.max_relative_angle.second, relative_angle, i - 2);
+    }
+    prev_azimuth = azimuth;
+  }
+
+  calcCurvature(trajectory, buffer.arc_length, buffer.curvature);
+  const auto & curvature = buffer.curvature;
+
+  // second pass: metrics depending on the curvature
+  metrics.max_curvature = {curvature[0], 0};
+  double max_abs_lateral_acc = -1.0;
+  double max_abs_steering = -1.0;
+  double prev_steering = 0.0;
+  for (size_t i = 0; i < n; ++i) {
+    const double k = curvature[i];
+    const double v_lon = points[i].longitudinal_velocity_mps;
+    const double a_lon = points[i].acceleration_mps2;
+
+    takeBigger(metrics.max_curvature.first, metrics.max_curvature.second, k, i);
+
+    // squared in float as calc_lateral_acceleration() does
+    const float v_lon_f = points[i].longitudinal_velocity_mps;
+    const double lateral_acc = v_lon_f * v_lon_f * k;
+    if (max_abs_lateral_acc < std::abs(lateral_acc)) {
+      max_abs_lateral_acc = std::abs(lateral_acc);
+      metrics.max_lateral_acc = {lateral_acc, i};
+    }
+
+    // see calc_lateral_jerk() for the omitted v_lon^3 * (dk/ds) term
+    const double lateral_jerk = std::abs(3.0 * v_lon * v_lon * a_lon * k);
+    takeBigger(metrics.max_lateral_jerk.first, metrics.max_lateral_jerk.second, lateral_jerk, i);
+
+    const double steering = std::atan(k * wheelbase);
+    if (max_abs_steering < std::abs(steering)) {
+      max_abs_steering = std::abs(steering);
+      metrics.max_steering = {max_abs_steering, i};
+    }
+
+    if (i > 0) {
+      const double v_mean =
+        0.5 * (points[i].longitudinal_velocity_mps + points[i - 1].longitudinal_velocity_mps);
+      const double dt = buffer.interval[i - 1] / std::max(v_mean, 1.0e-5);
+      const double steering_rate = std::abs((steering - prev_steering) / dt);
+      takeBigger(
+        metrics.max_steering_rate.first, metrics.max_steering_rate.second, steering_rate, i - 1);
+    }
+    prev_steering = steering;
+  }
+}
+
 bool checkFinite(const TrajectoryPoint & point)
 {
   const auto & p = point.pose.position;
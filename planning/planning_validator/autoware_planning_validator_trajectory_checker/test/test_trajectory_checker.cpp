@@ -385,6 +385,97 @@ TEST_F(TestTrajectoryChecker, checkCalcMaxLateralJerkFunction)
   }
 }
 
+TEST_F(TestTrajectoryChecker, checkFusedMetricsFunction)
+{
+  namespace utils = autoware::planning_validator::trajectory_checker_utils;
+
+  // curvature with the brute-force search of the points distant by 1.0 [m]
+  const auto calc_reference_curvature = [](const Trajectory & trajectory) {
+    const auto & points = trajectory.points;
+    std::vector<double> curvature(points.size(), 0.0);
+    std::vector<double> arc_length(points.size(), 0.0);
+    for (size_t i = 1; i < points.size(); ++i) {
+      arc_length.at(i) =
+        arc_length.at(i - 1) + autoware_utils::calc_distance2d(points.at(i - 1), points.at(i));
+    }
+    size_t first_distant_index = 0;
+    size_t last_distant_index = points.size() - 1;
+    for (size_t i = 1; i < points.size() - 1; ++i) {
+      size_t prev_idx = 0;
+      for (size_t j = i - 1; j > 0; --j) {
+        if (arc_length.at(i) - arc_length.at(j) > 1.0) {
+          if (first_distant_index == 0) first_distant_index = i;
+          prev_idx = j;
+          break;
+        }
+      }
+      size_t next_idx = points.size() - 1;
+      for (size_t j = i + 1; j < points.size(); ++j) {
+        if (arc_length.at(j) - arc_length.at(i) > 1.0) {
+          last_distant_index = i;
+          next_idx = j;
+          break;
+        }
+      }
+      try {
+        curvature.at(i) = autoware_utils::calc_curvature(
+          points.at(prev_idx).pose.position, points.at(i).pose.position,
+          points.at(next_idx).pose.position);
+      } catch (...) {
+        curvature.at(i) = 0.0;
+      }
+    }
+    for (size_t i = first_distant_index; i > 0; --i) curvature.at(i - 1) = curvature.at(i);
+    for (size_t i = last_distant_index; i < curvature.size() - 1; ++i) {
+      curvature.at(i + 1) = curvature.at(i);
+    }
+    return curvature;
+  };
+
+  // S-shaped trajectory whose interval varies around the curvature distance
+  Trajectory trajectory;
+  double x = 0.0;
+  for (size_t i = 0; i < 60; ++i) {
+    autoware_planning_msgs::msg::TrajectoryPoint p;
+    x += 0.2 + 0.1 * static_cast<double>(i % 7);
+    p.pose.position.x = x;
+    p.pose.position.y = 2.0 * std::sin(0.3 * x);
+    p.longitudinal_velocity_mps = 1.0 + 0.1 * static_cast<double>(i);
+    p.acceleration_mps2 = std::cos(0.5 * static_cast<double>(i));
+    trajectory.points.push_back(p);
+  }
+
+  const double wheelbase = 2.79;
+  utils::TrajectoryMetricsBuffer buffer;
+  utils::TrajectoryMetrics metrics;
+  for (const size_t size : std::vector<size_t>{1, 2, 3, 5, 60}) {
+    Trajectory traj = trajectory;
+    traj.points.resize(size);
+    utils::calcTrajectoryMetrics(traj, metrics);
+    utils::calcResampledTrajectoryMetrics(traj, wheelbase, buffer, metrics);
+
+    std::vector<double> curvature;
+    utils::calcCurvature(traj, curvature);
+    const auto reference_curvature = calc_reference_curvature(traj);
+    ASSERT_EQ(curvature.size(), reference_curvature.size());
+    for (size_t i = 0; i < curvature.size(); ++i) {
+      EXPECT_DOUBLE_EQ(curvature.at(i), reference_curvature.at(i));
+    }
+
+    EXPECT_EQ(metrics.max_interval_distance, utils::calcMaxIntervalDistance(traj));
+    EXPECT_EQ(metrics.max_longitudinal_acc, utils::getMaxLongitudinalAcc(traj));
+    EXPECT_EQ(metrics.min_longitudinal_acc, utils::getMinLongitudinalAcc(traj));
+    EXPECT_EQ(metrics.max_relative_angle, utils::calcMaxRelativeAngles(traj));
+    EXPECT_EQ(metrics.max_curvature, utils::calcMaxCurvature(traj));
+    EXPECT_EQ(metrics.max_lateral_acc, utils::calcMaxLateralAcceleration(traj));
+    EXPECT_EQ(metrics.max_lateral_jerk, utils::calc_max_lateral_jerk(traj));
+    EXPECT_EQ(metrics.max_steering_rate, utils::calcMaxSteeringRates(traj, wheelbase));
+    if (size > 1) {
+      EXPECT_EQ(metrics.max_steering, utils::calcMaxSteeringAngles(traj, wheelbase));
+    }
+  }
+}
+
 TEST_F(TestTrajectoryChecker, checkTrajectoryShiftFunction)
 {
   using test_utils::generateShiftedTrajectory;
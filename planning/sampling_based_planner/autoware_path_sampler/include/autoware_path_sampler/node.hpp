@@ -22,6 +22,7 @@
 #include "autoware_vehicle_info_utils/vehicle_info_utils.hpp"
 #include "rclcpp/rclcpp.hpp"
 
+#include <autoware/agnocast_wrapper/polling_subscriber.hpp>
 #include <autoware_sampler_common/structures.hpp>
 #include <autoware_utils/ros/polling_subscriber.hpp>
 
@@ -63,7 +64,7 @@ protected:  // for the static_centerline_generator package
   // interface subscriber
   rclcpp::Subscription<Path>::SharedPtr path_sub_;
   autoware_utils::InterProcessPollingSubscriber<Odometry> odom_sub_{this, "~/input/odometry"};
-  autoware_utils::InterProcessPollingSubscriber<PredictedObjects> objects_sub_{
+  autoware::agnocast_wrapper::PollingSubscriber<PredictedObjects> objects_sub_{
     this, "~/input/objects"};
 
   // debug publisher
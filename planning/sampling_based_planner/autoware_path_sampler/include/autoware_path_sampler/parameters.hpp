@@ -40,6 +40,12 @@ struct Parameters
     autoware::bezier_sampler::SamplingParameters bezier{};
   } sampling;
 
+  struct
+  {
+    int coarse_check_step{};  // step between the path points checked before the full evaluation
+    int nb_threads{};         // number of threads used for the full evaluation of the candidates
+  } evaluation{};
+
   struct
   {
     bool force_zero_deviation{};
@@ -124,6 +124,9 @@ PathSampler::PathSampler(const rclcpp::NodeOptions & node_options)
       declare_parameter<bool>("preprocessing.force_zero_initial_heading");
     params_.preprocessing.smooth_reference =
       declare_parameter<bool>("preprocessing.smooth_reference_trajectory");
+    params_.evaluation.coarse_check_step =
+      declare_parameter<int>("evaluation.coarse_check_step", 5);
+    params_.evaluation.nb_threads = declare_parameter<int>("evaluation.nb_threads", 1);
     params_.constraints.ego_footprint = vehicle_info_.createFootprint();
     params_.constraints.ego_width = vehicle_info_.vehicle_width_m;
     params_.constraints.ego_length = vehicle_info_.vehicle_length_m;
@@ -199,6 +202,8 @@ rcl_interfaces::msg::SetParametersResult PathSampler::onParam(
   update_param(
     parameters, "preprocessing.smooth_reference_trajectory",
     params_.preprocessing.smooth_reference);
+  update_param(parameters, "evaluation.coarse_check_step", params_.evaluation.coarse_check_step);
+  update_param(parameters, "evaluation.nb_threads", params_.evaluation.nb_threads);
   update_param(
     parameters, "debug.enable_calculation_time_info",
     time_keeper_ptr_->enable_calculation_time_info);
@@ -296,7 +301,7 @@ bool PathSampler::isDataReady(
     return false;
   }
 
-  if (!objects_sub_.take_data()) {
+  if (!objects_sub_.takeData()) {
     RCLCPP_INFO_SKIPFIRST_THROTTLE(get_logger(), clock, 5000, "Waiting for detected objects.");
     return false;
   }
@@ -472,7 +477,7 @@ autoware::sampler_common::Path PathSampler::generatePath(const PlannerData & pla
   current_state.heading = tf2::getYaw(planner_data.ego_pose.orientation);
 
   const auto planning_state = getPlanningState(current_state, path_spline);
-  const auto objects = objects_sub_.take_data();
+  const auto objects = objects_sub_.takeData();
   prepareConstraints(
     params_.constraints, *objects, planner_data.left_bound, planner_data.right_bound);
 
@@ -481,13 +486,30 @@ autoware::sampler_common::Path PathSampler::generatePath(const PlannerData & pla
     generateCandidatesFromPreviousPath(planner_data, path_spline);
   candidate_paths.insert(
     candidate_paths.end(), candidates_from_prev_path.begin(), candidates_from_prev_path.end());
-  debug_data_.footprints.clear();
-  for (auto & path : candidate_paths) {
-    const auto footprint =
+
+  // prune the candidates with the cheap constraints before building their full footprint
+  time_keeper_ptr_->tic("evaluateCandidates");
+  std::vector<size_t> remaining_path_indices;
+  remaining_path_indices.reserve(candidate_paths.size());
+  const auto coarse_check_step =
+    static_cast<size_t>(std::max(params_.evaluation.coarse_check_step, 1));
+  for (auto i = 0LU; i < candidate_paths.size(); ++i) {
+    if (autoware::sampler_common::constraints::checkCheapHardConstraints(
+          candidate_paths[i], params_.constraints, coarse_check_step)) {
+      remaining_path_indices.push_back(i);
+    }
+  }
+  debug_data_.footprints.assign(candidate_paths.size(), {});
+  const auto nb_remaining_paths = static_cast<int64_t>(remaining_path_indices.size());
+#pragma omp parallel for num_threads(std::max(params_.evaluation.nb_threads, 1))
+  for (int64_t i = 0; i < nb_remaining_paths; ++i) {
+    const auto path_idx = remaining_path_indices[i];
+    auto & path = candidate_paths[path_idx];
+    debug_data_.footprints[path_idx] =
       autoware::sampler_common::constraints::checkHardConstraints(path, params_.constraints);
-    debug_data_.footprints.push_back(footprint);
     autoware::sampler_common::constraints::calculateCost(path, params_.constraints, path_spline);
   }
+  time_keeper_ptr_->toc("evaluateCandidates", "      ");
   const auto best_path_idx = [](const auto & paths) {
     auto min_cost = std::numeric_limits<double>::max();
     size_t best_path_idx = 0;
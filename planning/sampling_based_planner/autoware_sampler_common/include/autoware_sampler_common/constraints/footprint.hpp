@@ -23,7 +23,12 @@ namespace autoware::sampler_common::constraints
 /// @param path sequence of pose used to build the footprint
 /// @param constraints input constraint object containing vehicle footprint offsets
 /// @return the polygon footprint of the path
-MultiPoint2d buildFootprintPoints(const Path & path, const Constraints & constraints);
+/**
+ * @brief build the footprint points of the path
+ * @param step only the footprints of every step-th path point are built, the default builds them all
+ */
+MultiPoint2d buildFootprintPoints(
+  const Path & path, const Constraints & constraints, const size_t step = 1);
 }  // namespace autoware::sampler_common::constraints
 
 #endif  // AUTOWARE_SAMPLER_COMMON__CONSTRAINTS__FOOTPRINT_HPP_
@@ -22,6 +22,16 @@ namespace autoware::sampler_common::constraints
 {
 /// @brief Check if the path satisfies the hard constraints
 MultiPoint2d checkHardConstraints(Path & path, const Constraints & constraints);
+/**
+ * @brief check the hard constraints that are cheap to evaluate, i.e., the curvature bounds and the
+ * drivable area using the footprints of a subsample of the path points. The subsampled footprint
+ * points are a subset of the full footprint, so a path rejected by this check is also rejected by
+ * checkHardConstraints().
+ * @param subsample_step step between the path points whose footprint is checked
+ * @return false if the path is already known to be invalid
+ */
+bool checkCheapHardConstraints(
+  Path & path, const Constraints & constraints, const size_t subsample_step);
 bool has_collision(
   const MultiPoint2d & footprint, const MultiPolygon2d & obstacles,
   const double min_distance = 0.0);
@@ -33,16 +33,20 @@ namespace
 const auto to_eigen = [](const Point2d & p) { return Eigen::Vector2d(p.x(), p.y()); };
 }  // namespace
 
-MultiPoint2d buildFootprintPoints(const Path & path, const Constraints & constraints)
+MultiPoint2d buildFootprintPoints(
+  const Path & path, const Constraints & constraints, const size_t step)
 {
   MultiPoint2d footprint;
+  if (step == 0) return footprint;
 
-  footprint.reserve(path.points.size() * 4);
-  for (auto i = 0UL; i < path.points.size(); ++i) {
+  footprint.reserve((path.points.size() / step + 1) * constraints.ego_footprint.size());
+  for (auto i = 0UL; i < path.points.size(); i += step) {
     const Eigen::Vector2d p = to_eigen(path.points[i]);
     const double heading = path.yaws[i];
+    const double cos_heading = std::cos(heading);
+    const double sin_heading = std::sin(heading);
     Eigen::Matrix2d rotation;
-    rotation << std::cos(heading), -std::sin(heading), std::sin(heading), std::cos(heading);
+    rotation << cos_heading, -sin_heading, sin_heading, cos_heading;
     for (const auto & fp : constraints.ego_footprint) {
       const Eigen::Vector2d fp_point = p + rotation * fp;
       footprint.emplace_back(fp_point.x(), fp_point.y());
@@ -56,4 +56,24 @@ MultiPoint2d checkHardConstraints(Path & path, const Constraints & constraints)
   }
   return footprint;
 }
+
+bool checkCheapHardConstraints(
+  Path & path, const Constraints & constraints, const size_t subsample_step)
+{
+  if (!satisfyMinMax(
+        path.curvatures, constraints.hard.min_curvature, constraints.hard.max_curvature)) {
+    path.constraint_results.valid_curvature = false;
+    return false;
+  }
+  if (constraints.hard.limit_footprint_inside_drivable_area && subsample_step > 1) {
+    const auto coarse_footprint = buildFootprintPoints(path, constraints, subsample_step);
+    if (
+      !coarse_footprint.empty() &&
+      !boost::geometry::within(coarse_footprint, constraints.drivable_polygons)) {
+      path.constraint_results.inside_drivable_area = false;
+      return false;
+    }
+  }
+  return true;
+}
 }  // namespace autoware::sampler_common::constraints
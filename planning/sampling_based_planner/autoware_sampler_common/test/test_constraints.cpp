@@ -0,0 +1,115 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware_sampler_common/constraints/hard_constraint.hpp>
+#include <autoware_sampler_common/structures.hpp>
+
+#include <boost/geometry/algorithms/correct.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+using autoware::sampler_common::Constraints;
+using autoware::sampler_common::Path;
+using autoware::sampler_common::Polygon2d;
+
+Polygon2d create_box(const double min_x, const double min_y, const double max_x, const double max_y)
+{
+  Polygon2d box;
+  box.outer() = {{min_x, min_y}, {min_x, max_y}, {max_x, max_y}, {max_x, min_y}, {min_x, min_y}};
+  boost::geometry::correct(box);
+  return box;
+}
+
+Constraints create_constraints()
+{
+  Constraints constraints;
+  constraints.hard.min_curvature = -0.008;
+  constraints.hard.max_curvature = 0.008;
+  constraints.hard.min_dist_from_obstacles = 0.5;
+  constraints.hard.limit_footprint_inside_drivable_area = true;
+  constraints.ego_footprint = {{-1.0, -1.0}, {-1.0, 1.0}, {3.0, 1.0}, {3.0, -1.0}, {-1.0, -1.0}};
+  constraints.drivable_polygons.push_back(create_box(-5.0, -4.0, 40.0, 4.0));
+  constraints.obstacle_polygons.push_back(create_box(15.0, 2.5, 17.0, 3.5));
+  return constraints;
+}
+
+// arc of constant curvature sampled every meter
+Path create_arc_path(const double y, const double yaw, const double curvature)
+{
+  Path path;
+  double x = 0.0;
+  double y_ = y;
+  double yaw_ = yaw;
+  for (int i = 0; i < 30; ++i) {
+    path.points.emplace_back(x, y_);
+    path.yaws.push_back(yaw_);
+    path.curvatures.push_back(curvature);
+    path.lengths.push_back(static_cast<double>(i));
+    x += std::cos(yaw_);
+    y_ += std::sin(yaw_);
+    yaw_ += curvature;
+  }
+  return path;
+}
+}  // namespace
+
+TEST(HardConstraints, cheapCheckDoesNotRejectValidPaths)
+{
+  using autoware::sampler_common::constraints::checkCheapHardConstraints;
+  using autoware::sampler_common::constraints::checkHardConstraints;
+
+  const auto constraints = create_constraints();
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> y_dist(-3.0, 3.0);
+  std::uniform_real_distribution<double> yaw_dist(-0.1, 0.1);
+  std::uniform_real_distribution<double> curvature_dist(-0.01, 0.01);
+
+  size_t valid_paths = 0;
+  size_t rejected_by_cheap_check = 0;
+  for (int i = 0; i < 500; ++i) {
+    const auto path = create_arc_path(y_dist(gen), yaw_dist(gen), curvature_dist(gen));
+    auto full_checked_path = path;
+    checkHardConstraints(full_checked_path, constraints);
+    const bool valid = full_checked_path.constraint_results.isValid();
+    valid_paths += valid ? 1 : 0;
+    for (const size_t step : {1UL, 2UL, 3UL, 5UL, 8UL}) {
+      auto cheap_checked_path = path;
+      const bool accepted = checkCheapHardConstraints(cheap_checked_path, constraints, step);
+      if (valid) {
+        EXPECT_TRUE(accepted) << "path " << i << " rejected with step " << step;
+        EXPECT_TRUE(cheap_checked_path.constraint_results.isValid());
+      }
+      rejected_by_cheap_check += accepted ? 0 : 1;
+    }
+  }
+  // both the valid and the invalid paths must be covered for the test to be meaningful
+  EXPECT_GT(valid_paths, 0UL);
+  EXPECT_GT(rejected_by_cheap_check, 0UL);
+}
+
+TEST(HardConstraints, cheapCheckRejectsOutOfBoundsCurvature)
+{
+  using autoware::sampler_common::constraints::checkCheapHardConstraints;
+
+  const auto constraints = create_constraints();
+  auto path = create_arc_path(0.0, 0.0, 0.009);
+  EXPECT_FALSE(checkCheapHardConstraints(path, constraints, 1));
+  EXPECT_FALSE(path.constraint_results.valid_curvature);
+}
@@ -14,44 +14,44 @@
 
 #include "component_monitor_node.hpp"
 
-#include "unit_conversions.hpp"
-
 #include <rclcpp/rclcpp.hpp>
 
 #include <autoware_internal_msgs/msg/resource_usage_report.hpp>
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
 
-#include <boost/process.hpp>
+#include <unistd.h>
 
-#include <cctype>
-#include <cstdint>
 #include <exception>
 #include <functional>
-#include <sstream>
+#include <memory>
 #include <string>
-#include <unordered_map>
 #include <utility>
-#include <vector>
 
 namespace autoware::component_monitor
 {
 ComponentMonitor::ComponentMonitor(const rclcpp::NodeOptions & node_options)
-: Node("component_monitor", node_options), publish_rate_(declare_parameter<double>("publish_rate"))
+: Node("component_monitor", node_options),
+  publish_rate_(declare_parameter<double>("publish_rate")),
+  publish_thread_usage_(declare_parameter<bool>("publish_thread_usage"))
 {
   usage_pub_ =
     create_publisher<ResourceUsageReport>("~/component_system_usage", rclcpp::SensorDataQoS());
-
-  // Make sure top ins installed and is in path
-  const auto path_top = boost::process::search_path("top");
-  if (path_top.empty()) {
-    RCLCPP_ERROR_STREAM(get_logger(), "Couldn't find 'top' in path.");
-    rclcpp::shutdown();
+  if (publish_thread_usage_) {
+    thread_usage_pub_ =
+      create_publisher<DiagnosticArray>("~/debug/thread_usage", rclcpp::SensorDataQoS());
   }
 
   // Get the PID of the current process
   int pid = getpid();
 
-  environment_ = boost::this_process::environment();
-  environment_["LC_NUMERIC"] = "en_US.UTF-8";
+  try {
+    sampler_ = std::make_unique<ProcessSampler>(
+      pid, publish_thread_usage_, declare_parameter<bool>("use_getrusage"));
+  } catch (std::exception & e) {
+    RCLCPP_ERROR_STREAM(get_logger(), e.what());
+    rclcpp::shutdown();
+    return;
+  }
 
   on_timer_tick_wrapped_ = std::bind(&ComponentMonitor::on_timer_tick, this, pid);
 
@@ -59,15 +59,29 @@ ComponentMonitor::ComponentMonitor(const rclcpp::NodeOptions & node_options)
     this, get_clock(), rclcpp::Rate(publish_rate_).period(), on_timer_tick_wrapped_);
 }
 
-void ComponentMonitor::on_timer_tick(const int pid) const
+void ComponentMonitor::on_timer_tick(const int pid)
 {
-  if (usage_pub_->get_subscription_count() == 0) return;
+  const bool has_usage_subscriber = usage_pub_->get_subscription_count() > 0;
+  const bool has_thread_usage_subscriber =
+    thread_usage_pub_ && thread_usage_pub_->get_subscription_count() > 0;
+  if (!has_usage_subscriber && !has_thread_usage_subscriber) return;
 
   try {
-    auto usage_msg = pid_to_report(pid);
-    usage_msg.header.stamp = this->now();
-    usage_msg.pid = pid;
-    usage_pub_->publish(usage_msg);
+    const auto usage = sampler_->sample();
+    const auto stamp = this->now();
+
+    if (has_usage_subscriber) {
+      auto usage_msg = usage_to_report(usage);
+      usage_msg.header.stamp = stamp;
+      usage_msg.pid = pid;
+      usage_pub_->publish(usage_msg);
+    }
+
+    if (has_thread_usage_subscriber) {
+      auto thread_usage_msg = usage_to_thread_report(pid, usage);
+      thread_usage_msg.header.stamp = stamp;
+      thread_usage_pub_->publish(thread_usage_msg);
+    }
   } catch (std::exception & e) {
     RCLCPP_ERROR(get_logger(), "%s", e.what());
   } catch (...) {
@@ -75,101 +89,53 @@ void ComponentMonitor::on_timer_tick(const int pid) const
   }
 }
 
-ComponentMonitor::ResourceUsageReport ComponentMonitor::pid_to_report(const pid_t & pid) const
+ComponentMonitor::ResourceUsageReport ComponentMonitor::usage_to_report(const ProcessUsage & usage)
 {
-  const auto std_out = run_system_command("top -b -n 1 -E k -p " + std::to_string(pid));
-
-  const auto fields = parse_lines_into_words(std_out);
-
   ResourceUsageReport report;
-  report.cpu_cores_utilized = std::stof(fields.back().at(8)) / 100.0f;
-  report.total_memory_bytes = unit_conversions::kib_to_bytes(std::stoul(fields.at(3).at(3)));
-  report.free_memory_bytes = unit_conversions::kib_to_bytes(std::stoul(fields.at(3).at(5)));
-  report.process_memory_bytes = parse_memory_res(fields.back().at(5));
+  report.cpu_cores_utilized = usage.cpu_cores_utilized;
+  report.total_memory_bytes = usage.total_memory_bytes;
+  report.free_memory_bytes = usage.free_memory_bytes;
+  report.process_memory_bytes = usage.process_memory_bytes;
 
   return report;
 }
 
-std::stringstream ComponentMonitor::run_system_command(const std::string & cmd) const
+ComponentMonitor::DiagnosticArray ComponentMonitor::usage_to_thread_report(
+  const pid_t & pid, const ProcessUsage & usage)
 {
-  int out_fd[2];
-  if (pipe2(out_fd, O_CLOEXEC) != 0) {
-    RCLCPP_ERROR_STREAM(get_logger(), "Error setting flags on out_fd");
-  }
-  boost::process::pipe out_pipe{out_fd[0], out_fd[1]};
-  boost::process::ipstream is_out{std::move(out_pipe)};
-
-  int err_fd[2];
-  if (pipe2(err_fd, O_CLOEXEC) != 0) {
-    RCLCPP_ERROR_STREAM(get_logger(), "Error setting flags on err_fd");
+  const auto make_value = [](const std::string & key, const auto value) {
+    diagnostic_msgs::msg::KeyValue key_value;
+    key_value.key = key;
+    key_value.value = std::to_string(value);
+    return key_value;
+  };
+
+  DiagnosticArray report;
+  report.status.reserve(usage.threads.size() + 1);
+
+  diagnostic_msgs::msg::DiagnosticStatus process_status;
+  process_status.name = "process";
+  process_status.hardware_id = std::to_string(pid);
+  process_status.values.push_back(make_value("cpu_cores_utilized", usage.cpu_cores_utilized));
+  process_status.values.push_back(
+    make_value("voluntary_ctxt_switches", usage.voluntary_ctxt_switches));
+  process_status.values.push_back(
+    make_value("nonvoluntary_ctxt_switches", usage.nonvoluntary_ctxt_switches));
+  report.status.push_back(std::move(process_status));
+
+  for (const auto & thread : usage.threads) {
+    diagnostic_msgs::msg::DiagnosticStatus thread_status;
+    thread_status.name = thread.name;
+    thread_status.hardware_id = std::to_string(thread.tid);
+    thread_status.values.push_back(make_value("cpu_cores_utilized", thread.cpu_cores_utilized));
+    thread_status.values.push_back(
+      make_value("voluntary_ctxt_switches", thread.voluntary_ctxt_switches));
+    thread_status.values.push_back(
+      make_value("nonvoluntary_ctxt_switches", thread.nonvoluntary_ctxt_switches));
+    report.status.push_back(std::move(thread_status));
   }
-  boost::process::pipe err_pipe{err_fd[0], err_fd[1]};
-  boost::process::ipstream is_err{std::move(err_pipe)};
 
-  boost::process::child c(
-    cmd, environment_, boost::process::std_out > is_out, boost::process::std_err > is_err);
-  c.wait();
-
-  if (c.exit_code() != 0) {
-    std::ostringstream os;
-    is_err >> os.rdbuf();
-    RCLCPP_ERROR_STREAM(get_logger(), "Error running command: " << os.str());
-  }
-
-  std::stringstream sstream;
-  sstream << is_out.rdbuf();
-  return sstream;
-}
-
-ComponentMonitor::VecVecStr ComponentMonitor::parse_lines_into_words(
-  const std::stringstream & std_out)
-{
-  VecVecStr fields;
-  std::string line;
-  std::istringstream input{std_out.str()};
-
-  while (std::getline(input, line)) {
-    std::istringstream iss_line{line};
-    std::string word;
-    std::vector<std::string> words;
-
-    while (iss_line >> word) {
-      words.push_back(word);
-    }
-
-    fields.push_back(words);
-  }
-
-  return fields;
-}
-
-std::uint64_t ComponentMonitor::parse_memory_res(const std::string & mem_res)
-{
-  // example 1: 12.3g
-  // example 2: 123 (without suffix, just bytes)
-  // NOLINTNEXTLINE(readability/casting)
-  static const std::unordered_map<char, std::function<std::uint64_t(double)>> unit_map{
-    {'k', unit_conversions::kib_to_bytes<double>}, {'m', unit_conversions::mib_to_bytes<double>},
-    {'g', unit_conversions::gib_to_bytes<double>}, {'t', unit_conversions::tib_to_bytes<double>},
-    {'p', unit_conversions::pib_to_bytes<double>}, {'e', unit_conversions::eib_to_bytes<double>}};
-
-  if (std::isdigit(mem_res.back())) {
-    return std::stoull(mem_res);  // Handle plain bytes without any suffix
-  }
-
-  // Extract the numeric part and the unit suffix
-  double value = std::stod(mem_res.substr(0, mem_res.size() - 1));
-  char suffix = mem_res.back();
-
-  // Find the appropriate function from the map
-  auto it = unit_map.find(suffix);
-  if (it != unit_map.end()) {
-    const auto & conversion_function = it->second;
-    return conversion_function(value);
-  }
-
-  // Throw an exception or handle the error as needed if the suffix is not recognized
-  throw std::runtime_error("Unsupported unit suffix: " + std::string(1, suffix));
+  return report;
 }
 
 }  // namespace autoware::component_monitor
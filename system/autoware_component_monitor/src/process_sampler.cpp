@@ -0,0 +1,245 @@
+// Copyright 2025 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "process_sampler.hpp"
+
+#include "unit_conversions.hpp"
+
+#include <dirent.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace autoware::component_monitor
+{
+using autoware::universe_utils::MemInfo;
+using autoware::universe_utils::parseMemInfo;
+
+namespace
+{
+/**
+ * @brief Find the value of a "Key:   value" line, or return nullptr.
+ */
+const char * find_field(const std::string & content, const char * key)
+{
+  const std::size_t key_len = std::strlen(key);
+  std::size_t pos = 0;
+  while (pos < content.size()) {
+    if (content.compare(pos, key_len, key) == 0 && content[pos + key_len] == ':') {
+      return content.c_str() + pos + key_len + 1;
+    }
+    pos = content.find('\n', pos);
+    if (pos == std::string::npos) break;
+    ++pos;
+  }
+  return nullptr;
+}
+
+bool parse_field(const std::string & content, const char * key, std::uint64_t & value)
+{
+  const char * p = find_field(content, key);
+  if (p == nullptr) return false;
+  value = std::strtoull(p, nullptr, 10);
+  return true;
+}
+}  // namespace
+
+bool parse_proc_stat(const std::string & content, ProcStat & stat)
+{
+  // pid (comm) state ppid ... ; comm may contain spaces and parentheses, so search the last ')'
+  const std::size_t comm_begin = content.find('(');
+  const std::size_t comm_end = content.rfind(')');
+  if (comm_begin == std::string::npos || comm_end == std::string::npos || comm_end < comm_begin) {
+    return false;
+  }
+  stat.comm = content.substr(comm_begin + 1, comm_end - comm_begin - 1);
+
+  // Fields after comm, starting from state (field 3)
+  std::vector<std::uint64_t> fields;
+  fields.reserve(22);
+  const char * p = content.c_str() + comm_end + 1;
+  while (*p == ' ') ++p;
+  ++p;  // state
+  while (fields.size() < 22) {
+    char * end = nullptr;
+    const auto value = std::strtoll(p, &end, 10);
+    if (end == p) break;
+    fields.push_back(static_cast<std::uint64_t>(value));
+    p = end;
+  }
+  // utime(14) stime(15) num_threads(20) rss(24), indexed from ppid(4)
+  if (fields.size() < 21) {
+    return false;
+  }
+  stat.utime_ticks = fields.at(14 - 4);
+  stat.stime_ticks = fields.at(15 - 4);
+  stat.num_threads = fields.at(20 - 4);
+  stat.rss_pages = fields.at(24 - 4);
+  return true;
+}
+
+bool parse_proc_status(const std::string & content, ProcStatus & status)
+{
+  std::uint64_t vm_rss_kib = 0;
+  // VmRSS is missing for kernel threads and zombies
+  parse_field(content, "VmRSS", vm_rss_kib);
+  status.vm_rss_bytes = unit_conversions::kib_to_bytes(vm_rss_kib);
+  return parse_field(content, "voluntary_ctxt_switches", status.voluntary_ctxt_switches) &&
+         parse_field(content, "nonvoluntary_ctxt_switches", status.nonvoluntary_ctxt_switches);
+}
+
+ProcessSampler::ProcessSampler(const pid_t pid, const bool sample_threads, const bool use_getrusage)
+: pid_(pid),
+  sample_threads_(sample_threads),
+  use_getrusage_(use_getrusage && pid == getpid()),
+  ticks_per_sec_(static_cast<double>(sysconf(_SC_CLK_TCK))),
+  stat_file_("/proc/" + std::to_string(pid) + "/stat"),
+  status_file_("/proc/" + std::to_string(pid) + "/status"),
+  meminfo_file_("/proc/meminfo")
+{
+  for (auto * file : {&stat_file_, &status_file_, &meminfo_file_}) {
+    if (!file->read(content_)) {
+      throw std::runtime_error("Couldn't read " + file->getPath() + ": " + file->getError());
+    }
+  }
+}
+
+std::uint64_t ProcessSampler::read_self_cpu_time_ns() const
+{
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+  const auto to_ns = [](const timeval & tv) {
+    return static_cast<std::uint64_t>(tv.tv_sec) * 1000000000ULL +
+           static_cast<std::uint64_t>(tv.tv_usec) * 1000ULL;
+  };
+  return to_ns(usage.ru_utime) + to_ns(usage.ru_stime);
+}
+
+ProcessUsage ProcessSampler::sample()
+{
+  return sample(std::chrono::steady_clock::now());
+}
+
+ProcessUsage ProcessSampler::sample(const std::chrono::steady_clock::time_point now)
+{
+  ProcessUsage usage;
+
+  ProcStat stat;
+  if (!stat_file_.read(content_) || !parse_proc_stat(content_, stat)) {
+    throw std::runtime_error("Couldn't read " + stat_file_.getPath());
+  }
+  ProcStatus status;
+  if (!status_file_.read(content_) || !parse_proc_status(content_, status)) {
+    throw std::runtime_error("Couldn't read " + status_file_.getPath());
+  }
+  MemInfo mem_info;
+  if (!meminfo_file_.read(content_) || !parseMemInfo(content_, mem_info)) {
+    throw std::runtime_error("Couldn't read " + meminfo_file_.getPath());
+  }
+  usage.total_memory_bytes = mem_info.mem_total;
+  usage.free_memory_bytes = mem_info.mem_free;
+
+  usage.process_memory_bytes = status.vm_rss_bytes;
+  usage.voluntary_ctxt_switches = status.voluntary_ctxt_switches;
+  usage.nonvoluntary_ctxt_switches = status.nonvoluntary_ctxt_switches;
+
+  const std::uint64_t cpu_time_ns =
+    use_getrusage_ ? read_self_cpu_time_ns()
+                   : static_cast<std::uint64_t>(
+                       static_cast<double>(stat.utime_ticks + stat.stime_ticks) / ticks_per_sec_ *
+                       1e9);
+  const double elapsed_sec =
+    has_prev_ ? std::chrono::duration<double>(now - prev_time_).count() : 0.0;
+  if (elapsed_sec > 0.0 && cpu_time_ns >= prev_cpu_time_ns_) {
+    usage.cpu_cores_utilized =
+      static_cast<float>(static_cast<double>(cpu_time_ns - prev_cpu_time_ns_) * 1e-9 / elapsed_sec);
+  }
+
+  if (sample_threads_) {
+    sample_threads(elapsed_sec, usage);
+  }
+
+  has_prev_ = true;
+  prev_time_ = now;
+  prev_cpu_time_ns_ = cpu_time_ns;
+  return usage;
+}
+
+void ProcessSampler::sample_threads(const double elapsed_sec, ProcessUsage & usage)
+{
+  const std::string task_dir = "/proc/" + std::to_string(pid_) + "/task";
+  DIR * dir = opendir(task_dir.c_str());
+  if (dir == nullptr) {
+    return;
+  }
+
+  for (auto & [tid, thread] : threads_) {
+    thread.alive = false;
+  }
+
+  while (const dirent * entry = readdir(dir)) {
+    char * end = nullptr;
+    const auto tid = static_cast<pid_t>(std::strtol(entry->d_name, &end, 10));
+    if (end == entry->d_name || *end != '\0') continue;
+
+    // Keep the files of the thread open while it lives
+    auto [it, is_new] = threads_.try_emplace(tid, task_dir + "/" + entry->d_name);
+    auto & thread = it->second;
+
+    ProcStat stat;
+    ProcStatus status;
+    if (
+      !thread.stat_file.read(content_) || !parse_proc_stat(content_, stat) ||
+      !thread.status_file.read(content_) || !parse_proc_status(content_, status)) {
+      // The thread exited in the meantime
+      continue;
+    }
+    thread.alive = true;
+
+    const std::uint64_t cpu_ticks = stat.utime_ticks + stat.stime_ticks;
+    ThreadUsage thread_usage;
+    thread_usage.tid = tid;
+    thread_usage.name = stat.comm;
+    if (!is_new && elapsed_sec > 0.0 && cpu_ticks >= thread.cpu_ticks) {
+      thread_usage.cpu_cores_utilized = static_cast<float>(
+        static_cast<double>(cpu_ticks - thread.cpu_ticks) / ticks_per_sec_ / elapsed_sec);
+    }
+    thread_usage.voluntary_ctxt_switches = status.voluntary_ctxt_switches;
+    thread_usage.nonvoluntary_ctxt_switches = status.nonvoluntary_ctxt_switches;
+    thread.cpu_ticks = cpu_ticks;
+    usage.threads.push_back(std::move(thread_usage));
+  }
+  closedir(dir);
+
+  // Forget the threads which exited
+  for (auto it = threads_.begin(); it != threads_.end();) {
+    if (it->second.alive) {
+      ++it;
+      continue;
+    }
+    it = threads_.erase(it);
+  }
+
+  std::sort(usage.threads.begin(), usage.threads.end(), [](const auto & a, const auto & b) {
+    return a.tid < b.tid;
+  });
+}
+
+}  // namespace autoware::component_monitor
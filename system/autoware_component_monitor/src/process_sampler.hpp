@@ -0,0 +1,162 @@
+// Copyright 2025 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PROCESS_SAMPLER_HPP_
+#define PROCESS_SAMPLER_HPP_
+
+#include <autoware/universe_utils/system/proc_file.hpp>
+
+#include <sys/types.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace autoware::component_monitor
+{
+using autoware::universe_utils::PersistentFile;
+
+/**
+ * @brief Fields of /proc/<pid>/stat or /proc/<pid>/task/<tid>/stat used by the monitor.
+ */
+struct ProcStat
+{
+  std::string comm;
+  std::uint64_t utime_ticks{0};
+  std::uint64_t stime_ticks{0};
+  std::uint64_t num_threads{0};
+  std::uint64_t rss_pages{0};
+};
+
+/**
+ * @brief Fields of /proc/<pid>/status used by the monitor.
+ */
+struct ProcStatus
+{
+  std::uint64_t vm_rss_bytes{0};
+  std::uint64_t voluntary_ctxt_switches{0};
+  std::uint64_t nonvoluntary_ctxt_switches{0};
+};
+
+/**
+ * @brief Usage of a thread between the last two samples.
+ */
+struct ThreadUsage
+{
+  pid_t tid{0};
+  std::string name;
+  float cpu_cores_utilized{0.0f};
+  std::uint64_t voluntary_ctxt_switches{0};
+  std::uint64_t nonvoluntary_ctxt_switches{0};
+};
+
+/**
+ * @brief Usage of a process between the last two samples.
+ */
+struct ProcessUsage
+{
+  float cpu_cores_utilized{0.0f};
+  std::uint64_t total_memory_bytes{0};
+  std::uint64_t free_memory_bytes{0};
+  std::uint64_t process_memory_bytes{0};
+  std::uint64_t voluntary_ctxt_switches{0};
+  std::uint64_t nonvoluntary_ctxt_switches{0};
+  std::vector<ThreadUsage> threads;
+};
+
+/**
+ * @brief Parse the content of /proc/<pid>/stat.
+ *
+ * @param content The content of the file
+ * @param stat The parsed fields
+ * @return false if the content is malformed
+ */
+bool parse_proc_stat(const std::string & content, ProcStat & stat);
+
+/**
+ * @brief Parse the content of /proc/<pid>/status.
+ *
+ * @param content The content of the file
+ * @param status The parsed fields, VmRSS is converted to bytes
+ * @return false if the content is malformed
+ */
+bool parse_proc_status(const std::string & content, ProcStatus & status);
+
+/**
+ * @brief Samples the usage of a process from /proc without running any command.
+ *
+ * @details The CPU usage is the CPU time consumed between two calls of sample() divided by the
+ * elapsed wall time, so the first sample reports no CPU usage. The files of the process are kept
+ * open and re-read from their beginning at each sample.
+ */
+class ProcessSampler
+{
+public:
+  /**
+   * @param pid The process to sample
+   * @param sample_threads Whether to also sample each thread in /proc/<pid>/task
+   * @param use_getrusage Whether to take the CPU time of the process from getrusage, which is only
+   * possible if pid is the calling process
+   */
+  ProcessSampler(pid_t pid, bool sample_threads, bool use_getrusage);
+
+  /**
+   * @brief Sample the process.
+   *
+   * @exception std::runtime_error Thrown if the files of the process cannot be read.
+   */
+  ProcessUsage sample();
+
+  /**
+   * @brief Sample the process at the given time, for testing.
+   */
+  ProcessUsage sample(std::chrono::steady_clock::time_point now);
+
+private:
+  struct ThreadState
+  {
+    explicit ThreadState(const std::string & thread_dir)
+    : stat_file(thread_dir + "/stat"), status_file(thread_dir + "/status")
+    {
+    }
+
+    PersistentFile stat_file;
+    PersistentFile status_file;
+    std::uint64_t cpu_ticks{0};
+    bool alive{false};
+  };
+
+  std::uint64_t read_self_cpu_time_ns() const;
+  void sample_threads(double elapsed_sec, ProcessUsage & usage);
+
+  pid_t pid_;
+  bool sample_threads_;
+  bool use_getrusage_;
+  double ticks_per_sec_;
+  PersistentFile stat_file_;
+  PersistentFile status_file_;
+  PersistentFile meminfo_file_;
+  std::string content_;
+
+  bool has_prev_{false};
+  std::chrono::steady_clock::time_point prev_time_;
+  std::uint64_t prev_cpu_time_ns_{0};
+  std::unordered_map<pid_t, ThreadState> threads_;
+};
+
+}  // namespace autoware::component_monitor
+
+#endif  // PROCESS_SAMPLER_HPP_
@@ -0,0 +1,93 @@
+// Copyright 2025 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "process_sampler.hpp"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <string>
+
+namespace autoware::component_monitor
+{
+TEST(ProcessSampler, parse_proc_stat)
+{
+  // comm with spaces and parentheses
+  const std::string content =
+    "1234 (my (component) container) S 1 1234 1234 0 -1 4194560 26120 0 0 0 250 75 0 0 20 0 12 0 "
+    "1000 2905940000 3000 18446744073709551615 1 1 0 0 0 0 0 4096 17663 0 0 0 17 3 0 0 0 0 0\n";
+
+  ProcStat stat;
+  ASSERT_TRUE(parse_proc_stat(content, stat));
+  EXPECT_EQ(stat.comm, "my (component) container");
+  EXPECT_EQ(stat.utime_ticks, 250U);
+  EXPECT_EQ(stat.stime_ticks, 75U);
+  EXPECT_EQ(stat.num_threads, 12U);
+  EXPECT_EQ(stat.rss_pages, 3000U);
+
+  EXPECT_FALSE(parse_proc_stat("1234 (truncated) S 1 2 3\n", stat));
+  EXPECT_FALSE(parse_proc_stat("", stat));
+}
+
+TEST(ProcessSampler, parse_proc_status)
+{
+  const std::string content =
+    "Name:\tcomponent_conta\n"
+    "VmPeak:\t 2905940 kB\n"
+    "VmRSS:\t   12000 kB\n"
+    "Threads:\t12\n"
+    "voluntary_ctxt_switches:\t150\n"
+    "nonvoluntary_ctxt_switches:\t7\n";
+
+  ProcStatus status;
+  ASSERT_TRUE(parse_proc_status(content, status));
+  EXPECT_EQ(status.vm_rss_bytes, 12000U * 1024U);
+  EXPECT_EQ(status.voluntary_ctxt_switches, 150U);
+  EXPECT_EQ(status.nonvoluntary_ctxt_switches, 7U);
+
+  EXPECT_FALSE(parse_proc_status("Name:\tcomponent_conta\n", status));
+}
+
+TEST(ProcessSampler, sample_self)
+{
+  for (const bool use_getrusage : {false, true}) {
+    ProcessSampler sampler(getpid(), true, use_getrusage);
+    const auto start = std::chrono::steady_clock::now();
+    const auto first = sampler.sample(start);
+    EXPECT_FLOAT_EQ(first.cpu_cores_utilized, 0.0f);
+    EXPECT_GT(first.process_memory_bytes, 0U);
+    EXPECT_GT(first.total_memory_bytes, 0U);
+    ASSERT_FALSE(first.threads.empty());
+    EXPECT_EQ(first.threads.front().tid, getpid());
+
+    // Burn some CPU time
+    volatile double value = 0.0;
+    while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(200)) {
+      value = value + 1.0;
+    }
+
+    const auto second = sampler.sample(std::chrono::steady_clock::now());
+    EXPECT_GT(second.cpu_cores_utilized, 0.0f);
+    ASSERT_FALSE(second.threads.empty());
+    EXPECT_GT(second.threads.front().cpu_cores_utilized, 0.0f);
+  }
+}
+
+TEST(ProcessSampler, missing_process)
+{
+  EXPECT_THROW(ProcessSampler(-1, false, false), std::runtime_error);
+}
+}  // namespace autoware::component_monitor
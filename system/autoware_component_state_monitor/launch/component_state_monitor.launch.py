@@ -18,13 +18,10 @@ from pathlib import Path
 
 import launch
 from launch.actions import DeclareLaunchArgument
-from launch.actions import IncludeLaunchDescription
 from launch.actions import OpaqueFunction
 from launch.substitutions import LaunchConfiguration
-from launch.substitutions import PathJoinSubstitution
 from launch_ros.actions import ComposableNodeContainer
 from launch_ros.descriptions import ComposableNode
-from launch_ros.substitutions import FindPackageShare
 import yaml
 
 
@@ -37,13 +34,10 @@ def create_topic_monitor_name(row):
     return "topic_state_monitor_{}: {}".format(row["args"]["node_name_suffix"], diag_name)
 
 
-def create_topic_monitor_node(row):
-    tf_mode = "" if "topic_type" in row["args"] else "_tf"
-    package = FindPackageShare("autoware_topic_state_monitor")
-    include = PathJoinSubstitution([package, f"launch/topic_state_monitor{tf_mode}.launch.xml"])
-    diag_name = create_diagnostic_name(row)
-    arguments = [("diag_name", diag_name)] + [(k, str(v)) for k, v in row["args"].items()]
-    return IncludeLaunchDescription(include, launch_arguments=arguments)
+def create_topic_monitor_param(row):
+    param = {k: v for k, v in row["args"].items() if k != "node_name_suffix"}
+    param["diag_name"] = create_topic_monitor_name(row)
+    return param
 
 
 def launch_setup(context, *args, **kwargs):
@@ -51,13 +45,25 @@ def launch_setup(context, *args, **kwargs):
     mode = LaunchConfiguration("mode").perform(context)
     rows = yaml.safe_load(Path(LaunchConfiguration("file").perform(context)).read_text())
     rows = [row for row in rows if mode in row["mode"]]
-    topic_monitor_nodes = [create_topic_monitor_node(row) for row in rows]
+    topic_monitor_keys = [row["args"]["node_name_suffix"] for row in rows]
     topic_monitor_names = [create_topic_monitor_name(row) for row in rows]
     topic_monitor_param = defaultdict(lambda: defaultdict(list))
     for row in rows:
         topic_monitor_param[row["type"]][row["module"]].append(create_topic_monitor_name(row))
     topic_monitor_param = {name: dict(module) for name, module in topic_monitor_param.items()}
 
+    # create a monitor for all topics, the diagnostic names are the same as the node per topic
+    topic_monitor = ComposableNode(
+        namespace="component_state_monitor",
+        name="topic_state_monitor",
+        package="autoware_topic_state_monitor",
+        plugin="autoware::topic_state_monitor::MultiTopicStateMonitorNode",
+        parameters=[
+            {"topics": topic_monitor_keys},
+            {row["args"]["node_name_suffix"]: create_topic_monitor_param(row) for row in rows},
+        ],
+    )
+
     # create component
     component = ComposableNode(
         namespace="component_state_monitor",
@@ -71,9 +77,9 @@ def launch_setup(context, *args, **kwargs):
         name="container",
         package="rclcpp_components",
         executable="component_container",
-        composable_node_descriptions=[component],
+        composable_node_descriptions=[component, topic_monitor],
     )
-    return [container, *topic_monitor_nodes]
+    return [container]
 
 
 def generate_launch_description():
@@ -19,12 +19,32 @@
 #include "loader.hpp"
 #include "units.hpp"
 
+#include <algorithm>
 #include <string>
 #include <unordered_map>
 
 namespace autoware::diagnostic_graph_aggregator
 {
 
+namespace
+{
+
+size_t calc_height(BaseUnit * unit, std::unordered_map<BaseUnit *, size_t> & heights)
+{
+  const auto iter = heights.find(unit);
+  if (iter != heights.end()) return iter->second;
+
+  // The graph is acyclic since it is checked by the loader.
+  size_t height = 0;
+  for (const auto & link : unit->child_links()) {
+    height = std::max(height, calc_height(link->child(), heights) + 1);
+  }
+  unit->set_height(height);
+  return heights[unit] = height;
+}
+
+}  // namespace
+
 void Graph::create(const std::string & file, const std::string & id)
 {
   GraphLoader graph(file);
@@ -36,11 +56,29 @@ void Graph::create(const std::string & file, const std::string & id)
   for (const auto & diag : diags_) units_.push_back(diag.get());
 
   id_ = id;
+
+  // Prepare the status message whose entries are rewritten when the units change.
+  status_.id = id_;
+  for (const auto & node : nodes_) status_.nodes.push_back(node->create_status());
+  for (const auto & diag : diags_) status_.diags.push_back(diag->create_status());
+  for (const auto & link : links_) status_.links.push_back(link->create_status());
+
+  // Evaluate all units once in topological order.
+  std::unordered_map<BaseUnit *, size_t> heights;
+  size_t max_height = 0;
+  for (const auto & unit : units_) max_height = std::max(max_height, calc_height(unit, heights));
+  dirty_units_.resize(max_height + 1);
+  for (const auto & unit : units_) schedule(unit);
+  propagate();
 }
 
 void Graph::update(const rclcpp::Time & stamp)
 {
-  for (const auto & diag : diags_) diag->on_time(stamp);
+  for (const auto & diag : diags_) {
+    if (diag->on_time(stamp)) schedule(diag.get());
+  }
+  propagate();
+  status_.stamp = stamp;
 }
 
 bool Graph::update(const rclcpp::Time & stamp, const DiagnosticStatus & status)
@@ -48,9 +86,40 @@ bool Graph::update(const rclcpp::Time & stamp, const DiagnosticStatus & status)
   const auto iter = names_.find(status.name);
   if (iter == names_.end()) return false;
   iter->second->on_diag(stamp, status);
+  schedule(iter->second);
+  propagate();
   return true;
 }
 
+void Graph::schedule(BaseUnit * unit)
+{
+  if (unit->is_dirty()) return;
+  unit->set_dirty(true);
+  dirty_units_[unit->height()].push_back(unit);
+}
+
+void Graph::propagate()
+{
+  // The parents are always higher than the children, so each unit is evaluated only once.
+  for (auto & units : dirty_units_) {
+    for (const auto & unit : units) {
+      unit->set_dirty(false);
+      if (unit->is_leaf()) {
+        // The message of the diag may change even if the level does not change.
+        const auto leaf = static_cast<const LeafUnit *>(unit);
+        status_.diags[leaf->index()] = leaf->create_status();
+      }
+      if (!unit->update()) continue;
+      if (!unit->is_leaf()) {
+        const auto node = static_cast<const NodeUnit *>(unit);
+        status_.nodes[node->index()] = node->create_status();
+      }
+      for (const auto & link : unit->parent_links()) schedule(link->parent());
+    }
+    units.clear();
+  }
+}
+
 DiagGraphStruct Graph::create_struct(const rclcpp::Time & stamp) const
 {
   DiagGraphStruct msg;
@@ -64,12 +133,8 @@ DiagGraphStruct Graph::create_struct(const rclcpp::Time & stamp) const
 
 DiagGraphStatus Graph::create_status(const rclcpp::Time & stamp) const
 {
-  DiagGraphStatus msg;
+  DiagGraphStatus msg = status_;
   msg.stamp = stamp;
-  msg.id = id_;
-  for (const auto & node : nodes_) msg.nodes.push_back(node->create_status());
-  for (const auto & diag : diags_) msg.diags.push_back(diag->create_status());
-  for (const auto & link : links_) msg.links.push_back(link->create_status());
   return msg;
 }
 
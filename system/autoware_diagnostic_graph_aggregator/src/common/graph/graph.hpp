@@ -37,11 +37,15 @@ public:
   const auto & units() const { return units_; }
   DiagGraphStruct create_struct(const rclcpp::Time & stamp) const;
   DiagGraphStatus create_status(const rclcpp::Time & stamp) const;
+  const DiagGraphStatus & status() const { return status_; }
 
   Graph();   // For unique_ptr members.
   ~Graph();  // For unique_ptr members.
 
 private:
+  void schedule(BaseUnit * unit);
+  void propagate();
+
   // Note: keep order correspondence between links and unit children for viewer.
   std::vector<std::unique_ptr<NodeUnit>> nodes_;
   std::vector<std::unique_ptr<DiagUnit>> diags_;
@@ -49,6 +53,11 @@ private:
   std::vector<BaseUnit *> units_;
   std::unordered_map<std::string, DiagUnit *> names_;
   std::string id_;
+
+  // The units to be evaluated grouped by height, the children are evaluated before the parents.
+  std::vector<std::vector<BaseUnit *>> dirty_units_;
+  // The status message is kept and only the entries of the changed units are rewritten.
+  DiagGraphStatus status_;
 };
 
 }  // namespace autoware::diagnostic_graph_aggregator
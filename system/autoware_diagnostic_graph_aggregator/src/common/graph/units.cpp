@@ -41,9 +41,45 @@ void UnitLink::initialize_status()
   // Do nothing.
 }
 
+LevelCounts::LevelCounts(size_t size) : counts_()
+{
+  // The children are regarded as stale until they are evaluated.
+  counts_[slot(DiagnosticStatus::STALE)] = size;
+}
+
+size_t LevelCounts::slot(DiagnosticLevel level)
+{
+  // Unexpected levels are regarded as stale, they are clamped to error by the units in any case.
+  return std::min<size_t>(level, DiagnosticStatus::STALE);
+}
+
+void LevelCounts::update(DiagnosticLevel prev, DiagnosticLevel curr)
+{
+  --counts_[slot(prev)];
+  ++counts_[slot(curr)];
+}
+
+DiagnosticLevel LevelCounts::max() const
+{
+  for (size_t level = counts_.size() - 1; 0 < level; --level) {
+    if (counts_[level]) return static_cast<DiagnosticLevel>(level);
+  }
+  return DiagnosticStatus::OK;
+}
+
+DiagnosticLevel LevelCounts::min() const
+{
+  for (size_t level = 0; level < counts_.size() - 1; ++level) {
+    if (counts_[level]) return static_cast<DiagnosticLevel>(level);
+  }
+  return DiagnosticStatus::STALE;
+}
+
 BaseUnit::BaseUnit(const UnitLoader & unit)
 {
   index_ = unit.index();
+  height_ = 0;
+  dirty_ = false;
   parents_ = unit.parents();
 }
 
@@ -55,15 +91,19 @@ bool BaseUnit::update()
   // If the level does not change, it will not affect the parents.
   const auto curr_level = level();
   if (curr_level == prev_level_) return false;
+  const auto prev_level = prev_level_.value_or(DiagnosticStatus::STALE);
   prev_level_ = curr_level;
 
-  // If the level changes, the parents also need to be updated.
-  bool result = false;
+  // If the level changes, the parents also need to be updated. This is done by the graph.
   for (const auto & link : parents_) {
-    const auto unit = link->parent();
-    result = result || unit->update();
+    link->parent()->on_child_level(prev_level, curr_level);
   }
-  return result;
+  return true;
+}
+
+void BaseUnit::on_child_level(DiagnosticLevel, DiagnosticLevel)
+{
+  // Do nothing. The units that refer the children directly do not need to count the levels.
 }
 
 NodeUnit::NodeUnit(const UnitLoader & unit) : BaseUnit(unit)
@@ -79,7 +119,7 @@ void NodeUnit::initialize_struct()
 
 void NodeUnit::initialize_status()
 {
-  if (child_links().size() == 0) update();
+  // Do nothing. All units are evaluated by the graph in topological order.
 }
 
 LeafUnit::LeafUnit(const UnitLoader & unit) : BaseUnit(unit)
@@ -100,7 +140,7 @@ void LeafUnit::initialize_struct()
 
 void LeafUnit::initialize_status()
 {
-  if (child_links().size() == 0) update();
+  // Do nothing. All units are evaluated by the graph in topological order.
 }
 
 DiagUnit::DiagUnit(const UnitLoader & unit) : LeafUnit(unit)
@@ -113,14 +153,13 @@ void DiagUnit::update_status()
   // Do nothing. The level is updated by on_diag and on_time.
 }
 
-bool DiagUnit::on_diag(const rclcpp::Time & stamp, const DiagnosticStatus & status)
+void DiagUnit::on_diag(const rclcpp::Time & stamp, const DiagnosticStatus & status)
 {
   last_updated_time_ = stamp;
   status_.level = status.level;
   status_.message = status.message;
   status_.hardware_id = status.hardware_id;
   status_.values = status.values;
-  return update();
 }
 
 bool DiagUnit::on_time(const rclcpp::Time & stamp)
@@ -132,52 +171,52 @@ bool DiagUnit::on_time(const rclcpp::Time & stamp)
       last_updated_time_ = std::nullopt;
       status_ = DiagLeafStatus();
       status_.level = DiagnosticStatus::STALE;
+      return true;
     }
   }
-  return update();
+  return false;
 }
 
-MaxUnit::MaxUnit(const UnitLoader & unit) : NodeUnit(unit)
+MaxUnit::MaxUnit(const UnitLoader & unit)
+: NodeUnit(unit), links_(unit.children()), counts_(links_.size())
 {
-  links_ = unit.children();
 }
 
 void MaxUnit::update_status()
 {
-  DiagnosticLevel level = DiagnosticStatus::OK;
-  for (const auto * const link : links_) {
-    level = std::max(level, link->child()->level());
-  }
-  status_.level = std::min(level, DiagnosticStatus::ERROR);
+  status_.level = std::min(counts_.max(), DiagnosticStatus::ERROR);
+}
+
+void MaxUnit::on_child_level(DiagnosticLevel prev, DiagnosticLevel curr)
+{
+  counts_.update(prev, curr);
 }
 
 void ShortCircuitMaxUnit::update_status()
 {
   // TODO(Takagi, Isamu): update link flags.
-  DiagnosticLevel level = DiagnosticStatus::OK;
-  for (const auto * const link : links_) {
-    level = std::max(level, link->child()->level());
-  }
-  status_.level = std::min(level, DiagnosticStatus::ERROR);
+  status_.level = std::min(counts_.max(), DiagnosticStatus::ERROR);
 }
 
-MinUnit::MinUnit(const UnitLoader & unit) : NodeUnit(unit)
+MinUnit::MinUnit(const UnitLoader & unit)
+: NodeUnit(unit), links_(unit.children()), counts_(links_.size())
 {
-  links_ = unit.children();
 }
 
 void MinUnit::update_status()
 {
   DiagnosticLevel level = DiagnosticStatus::OK;
   if (!links_.empty()) {
-    level = DiagnosticStatus::STALE;
-    for (const auto * const link : links_) {
-      level = std::min(level, link->child()->level());
-    }
+    level = counts_.min();
   }
   status_.level = std::min(level, DiagnosticStatus::ERROR);
 }
 
+void MinUnit::on_child_level(DiagnosticLevel prev, DiagnosticLevel curr)
+{
+  counts_.update(prev, curr);
+}
+
 RemapUnit::RemapUnit(const UnitLoader & unit) : NodeUnit(unit)
 {
   link_ = unit.child();
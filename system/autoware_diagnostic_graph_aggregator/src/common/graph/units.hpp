@@ -20,6 +20,7 @@
 
 #include <rclcpp/time.hpp>
 
+#include <array>
 #include <optional>
 #include <string>
 #include <vector>
@@ -47,6 +48,19 @@ private:
   DiagLinkStatus status_;
 };
 
+class LevelCounts
+{
+public:
+  explicit LevelCounts(size_t size);
+  void update(DiagnosticLevel prev, DiagnosticLevel curr);
+  DiagnosticLevel max() const;
+  DiagnosticLevel min() const;
+
+private:
+  static size_t slot(DiagnosticLevel level);
+  std::array<size_t, DiagnosticStatus::STALE + 1> counts_;
+};
+
 class BaseUnit
 {
 public:
@@ -59,13 +73,20 @@ public:
   virtual bool is_leaf() const = 0;
   size_t index() const { return index_; }
   size_t parent_size() const { return parents_.size(); }
+  const std::vector<UnitLink *> & parent_links() const { return parents_; }
 
-protected:
   bool update();
+  size_t height() const { return height_; }
+  void set_height(size_t height) { height_ = height; }
+  bool is_dirty() const { return dirty_; }
+  void set_dirty(bool dirty) { dirty_ = dirty; }
 
 private:
   virtual void update_status() = 0;
+  virtual void on_child_level(DiagnosticLevel prev, DiagnosticLevel curr);
   size_t index_;
+  size_t height_;
+  bool dirty_;
   std::vector<UnitLink *> parents_;
   std::optional<DiagnosticLevel> prev_level_;
 };
@@ -112,7 +133,7 @@ public:
   std::string type() const override { return unit_name::diag; }
   std::vector<UnitLink *> child_links() const override { return {}; }
   bool on_time(const rclcpp::Time & stamp);
-  bool on_diag(const rclcpp::Time & stamp, const DiagnosticStatus & status);
+  void on_diag(const rclcpp::Time & stamp, const DiagnosticStatus & status);
 
 private:
   void update_status() override;
@@ -129,9 +150,11 @@ public:
 
 protected:
   std::vector<UnitLink *> links_;
+  LevelCounts counts_;
 
 private:
   void update_status() override;
+  void on_child_level(DiagnosticLevel prev, DiagnosticLevel curr) override;
 };
 
 class ShortCircuitMaxUnit : public MaxUnit
@@ -153,9 +176,11 @@ public:
 
 protected:
   std::vector<UnitLink *> links_;
+  LevelCounts counts_;
 
 private:
   void update_status() override;
+  void on_child_level(DiagnosticLevel prev, DiagnosticLevel curr) override;
 };
 
 class RemapUnit : public NodeUnit
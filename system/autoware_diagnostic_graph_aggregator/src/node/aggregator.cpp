@@ -77,8 +77,8 @@ void AggregatorNode::on_timer()
   const auto stamp = now();
   graph_.update(stamp);
 
-  // Publish status.
-  pub_status_->publish(graph_.create_status(stamp));
+  // Publish status. The message is kept by the graph and published without copying.
+  pub_status_->publish(graph_.status());
   pub_unknown_->publish(create_unknown_diags(stamp));
   if (modes_) modes_->update(stamp);
 }
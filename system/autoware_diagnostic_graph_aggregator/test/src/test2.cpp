@@ -87,6 +87,46 @@ TEST_P(GraphTest, Aggregation)
   EXPECT_EQ(output, param.result);
 }
 
+TEST(GraphUpdate, Propagation)
+{
+  const auto stamp = rclcpp::Clock().now();
+  Graph graph;
+  graph.create(resource("test2/or.yaml"));
+  EXPECT_EQ(get_output(graph, stamp), ERROR);
+
+  const auto update = [&graph, &stamp](const std::vector<uint8_t> & inputs) {
+    for (const auto & status : create_input(inputs).status) {
+      graph.update(stamp, status);
+    }
+    return get_output(graph, stamp);
+  };
+  EXPECT_EQ(update({ERROR, STALE}), ERROR);
+  EXPECT_EQ(update({WARN, STALE}), WARN);
+  EXPECT_EQ(update({WARN, OK}), OK);
+  EXPECT_EQ(update({ERROR, OK}), OK);
+  EXPECT_EQ(update({ERROR, ERROR}), ERROR);
+  EXPECT_EQ(update({STALE, STALE}), ERROR);
+}
+
+TEST(GraphUpdate, Timeout)
+{
+  const auto stamp = rclcpp::Clock().now();
+  Graph graph;
+  graph.create(resource("test2/and.yaml"));
+
+  for (const auto & status : create_input({OK, OK}).status) {
+    graph.update(stamp, status);
+  }
+  graph.update(stamp + rclcpp::Duration::from_seconds(0.5));
+  EXPECT_EQ(get_output(graph, stamp), OK);
+
+  graph.update(stamp + rclcpp::Duration::from_seconds(1.5));
+  EXPECT_EQ(get_output(graph, stamp), ERROR);
+  for (const auto & diag : graph.status().diags) {
+    EXPECT_EQ(diag.level, STALE);
+  }
+}
+
 // clang-format off
 
 INSTANTIATE_TEST_SUITE_P(And, GraphTest,
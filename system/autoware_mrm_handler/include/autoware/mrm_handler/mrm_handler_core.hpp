@@ -100,8 +100,20 @@ private:
 
   tier4_system_msgs::msg::OperationModeAvailability::ConstSharedPtr operation_mode_availability_;
 
+  // Inputs of the subscribers without callback, taken once per evaluation so that all the
+  // decisions of an evaluation use the same data
+  nav_msgs::msg::Odometry::ConstSharedPtr odom_;
+  autoware_vehicle_msgs::msg::ControlModeReport::ConstSharedPtr control_mode_;
+  tier4_system_msgs::msg::MrmBehaviorStatus::ConstSharedPtr mrm_pull_over_status_;
+  tier4_system_msgs::msg::MrmBehaviorStatus::ConstSharedPtr mrm_comfortable_stop_status_;
+  tier4_system_msgs::msg::MrmBehaviorStatus::ConstSharedPtr mrm_emergency_stop_status_;
+  autoware_adapi_v1_msgs::msg::OperationModeState::ConstSharedPtr operation_mode_state_;
+  autoware_vehicle_msgs::msg::GearCommand::ConstSharedPtr gear_cmd_;
+  void takeInputs();
+
   void onOperationModeAvailability(
     const tier4_system_msgs::msg::OperationModeAvailability::ConstSharedPtr msg);
+  void updateEmergencyHolding(const tier4_system_msgs::msg::OperationModeAvailability & msg);
 
   // Publisher
 
@@ -148,6 +160,7 @@ private:
 
   bool isDataReady();
   void onTimer();
+  void update();
 
   // Heartbeat
   rclcpp::Time stamp_operation_mode_availability_;
@@ -159,18 +172,19 @@ private:
   bool is_emergency_holding_ = false;
   uint8_t last_gear_command_{autoware_vehicle_msgs::msg::GearCommand::DRIVE};
   void transitionTo(const int new_state);
+  void updateMrm();
   void updateMrmState();
   void operateMrm();
   void handleFailedRequest();
   autoware_adapi_v1_msgs::msg::MrmState::_behavior_type getCurrentMrmBehavior();
-  bool isStopped();
+  bool isStopped() const;
   bool isEmergency() const;
-  bool isControlModeAutonomous();
-  bool isOperationModeAutonomous();
-  bool isPullOverStatusAvailable();
-  bool isComfortableStopStatusAvailable();
-  bool isEmergencyStopStatusAvailable();
-  bool isArrivedAtGoal();
+  bool isControlModeAutonomous() const;
+  bool isOperationModeAutonomous() const;
+  bool isPullOverStatusAvailable() const;
+  bool isComfortableStopStatusAvailable() const;
+  bool isEmergencyStopStatusAvailable() const;
+  bool isArrivedAtGoal() const;
 };
 
 }  // namespace autoware::mrm_handler
@@ -90,8 +90,23 @@ MrmHandler::MrmHandler(const rclcpp::NodeOptions & options) : Node("mrm_handler"
 void MrmHandler::onOperationModeAvailability(
   const tier4_system_msgs::msg::OperationModeAvailability::ConstSharedPtr msg)
 {
+  const bool was_emergency = operation_mode_availability_ && isEmergency();
   stamp_operation_mode_availability_ = this->now();
   operation_mode_availability_ = msg;
+
+  takeInputs();
+  updateEmergencyHolding(*msg);
+
+  // The MRM is decided as soon as the emergency changes, instead of at the next timer period.
+  // The timer and this callback are in the same mutually exclusive callback group.
+  if (isEmergency() != was_emergency && isDataReady()) {
+    updateMrm();
+  }
+}
+
+void MrmHandler::updateEmergencyHolding(
+  const tier4_system_msgs::msg::OperationModeAvailability & msg)
+{
   const bool skip_emergency_holding_check =
     !param_.use_emergency_holding || is_emergency_holding_ || !isOperationModeAutonomous();
 
@@ -99,7 +114,7 @@ void MrmHandler::onOperationModeAvailability(
     return;
   }
 
-  if (msg->autonomous) {
+  if (msg.autonomous) {
     stamp_autonomous_become_unavailable_.reset();
     return;
   }
@@ -158,8 +173,7 @@ void MrmHandler::publishGearCmd()
       (param_.use_parking_after_stopped && isStopped()) ? GearCommand::PARK : last_gear_command_;
   } else {
     // use the same gear as the input gear
-    auto gear = sub_gear_cmd_.take_data();
-    msg.command = (gear == nullptr) ? last_gear_command_ : gear->command;
+    msg.command = (gear_cmd_ == nullptr) ? last_gear_command_ : gear_cmd_->command;
     last_gear_command_ = msg.command;
   }
 
@@ -360,7 +374,24 @@ void MrmHandler::checkOperationModeAvailabilityTimeout()
   }
 }
 
+void MrmHandler::takeInputs()
+{
+  odom_ = sub_odom_.take_data();
+  control_mode_ = sub_control_mode_.take_data();
+  mrm_pull_over_status_ = sub_mrm_pull_over_status_.take_data();
+  mrm_comfortable_stop_status_ = sub_mrm_comfortable_stop_status_.take_data();
+  mrm_emergency_stop_status_ = sub_mrm_emergency_stop_status_.take_data();
+  operation_mode_state_ = sub_operation_mode_state_.take_data();
+  gear_cmd_ = sub_gear_cmd_.take_data();
+}
+
 void MrmHandler::onTimer()
+{
+  takeInputs();
+  update();
+}
+
+void MrmHandler::update()
 {
   if (!isDataReady()) {
     return;
@@ -369,18 +400,25 @@ void MrmHandler::onTimer()
   // Check whether operation_mode_availability is timeout
   checkOperationModeAvailabilityTimeout();
 
+  updateMrm();
+
+  // Publish
+  publishEmergencyHolding();
+}
+
+void MrmHandler::updateMrm()
+{
   // Update Emergency State
   updateMrmState();
 
   // Operate MRM
   operateMrm();
 
-  // Publish
+  // Publish the outputs depending on the MRM state
   publishMrmState();
   publishTurnIndicatorCmd();
   publishHazardCmd();
   publishGearCmd();
-  publishEmergencyHolding();
 }
 
 void MrmHandler::transitionTo(const int new_state)
@@ -547,12 +585,11 @@ autoware_adapi_v1_msgs::msg::MrmState::_behavior_type MrmHandler::getCurrentMrmB
   return mrm_state_.behavior;
 }
 
-bool MrmHandler::isStopped()
+bool MrmHandler::isStopped() const
 {
-  auto odom = sub_odom_.take_data();
-  if (odom == nullptr) return false;
+  if (odom_ == nullptr) return false;
   constexpr auto th_stopped_velocity = 0.001;
-  return (std::abs(odom->twist.twist.linear.x) < th_stopped_velocity);
+  return (std::abs(odom_->twist.twist.linear.x) < th_stopped_velocity);
 }
 
 bool MrmHandler::isEmergency() const
@@ -561,49 +598,45 @@ bool MrmHandler::isEmergency() const
          is_operation_mode_availability_timeout;
 }
 
-bool MrmHandler::isControlModeAutonomous()
+bool MrmHandler::isControlModeAutonomous() const
 {
   using autoware_vehicle_msgs::msg::ControlModeReport;
-  auto mode = sub_control_mode_.take_data();
-  if (mode == nullptr) return false;
-  return mode->mode == ControlModeReport::AUTONOMOUS;
+  if (control_mode_ == nullptr) return false;
+  return control_mode_->mode == ControlModeReport::AUTONOMOUS;
 }
 
-bool MrmHandler::isOperationModeAutonomous()
+bool MrmHandler::isOperationModeAutonomous() const
 {
   using autoware_adapi_v1_msgs::msg::OperationModeState;
-  auto state = sub_operation_mode_state_.take_data();
-  if (state == nullptr) return false;
-  return state->mode == OperationModeState::AUTONOMOUS;
+  if (operation_mode_state_ == nullptr) return false;
+  return operation_mode_state_->mode == OperationModeState::AUTONOMOUS;
 }
 
-bool MrmHandler::isPullOverStatusAvailable()
+bool MrmHandler::isPullOverStatusAvailable() const
 {
-  auto status = sub_mrm_pull_over_status_.take_data();
-  if (status == nullptr) return false;
-  return status->state != tier4_system_msgs::msg::MrmBehaviorStatus::NOT_AVAILABLE;
+  if (mrm_pull_over_status_ == nullptr) return false;
+  return mrm_pull_over_status_->state != tier4_system_msgs::msg::MrmBehaviorStatus::NOT_AVAILABLE;
 }
 
-bool MrmHandler::isComfortableStopStatusAvailable()
+bool MrmHandler::isComfortableStopStatusAvailable() const
 {
-  auto status = sub_mrm_comfortable_stop_status_.take_data();
-  if (status == nullptr) return false;
-  return status->state != tier4_system_msgs::msg::MrmBehaviorStatus::NOT_AVAILABLE;
+  if (mrm_comfortable_stop_status_ == nullptr) return false;
+  return mrm_comfortable_stop_status_->state !=
+         tier4_system_msgs::msg::MrmBehaviorStatus::NOT_AVAILABLE;
 }
 
-bool MrmHandler::isEmergencyStopStatusAvailable()
+bool MrmHandler::isEmergencyStopStatusAvailable() const
 {
-  auto status = sub_mrm_emergency_stop_status_.take_data();
-  if (status == nullptr) return false;
-  return status->state != tier4_system_msgs::msg::MrmBehaviorStatus::NOT_AVAILABLE;
+  if (mrm_emergency_stop_status_ == nullptr) return false;
+  return mrm_emergency_stop_status_->state !=
+         tier4_system_msgs::msg::MrmBehaviorStatus::NOT_AVAILABLE;
 }
 
-bool MrmHandler::isArrivedAtGoal()
+bool MrmHandler::isArrivedAtGoal() const
 {
   using autoware_adapi_v1_msgs::msg::OperationModeState;
-  auto state = sub_operation_mode_state_.take_data();
-  if (state == nullptr) return false;
-  return state->mode == OperationModeState::STOP;
+  if (operation_mode_state_ == nullptr) return false;
+  return operation_mode_state_->mode == OperationModeState::STOP;
 }
 
 }  // namespace autoware::mrm_handler
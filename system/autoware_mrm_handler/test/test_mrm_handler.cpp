@@ -0,0 +1,211 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/mrm_handler/mrm_handler_core.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <autoware_adapi_v1_msgs/msg/mrm_state.hpp>
+#include <autoware_adapi_v1_msgs/msg/operation_mode_state.hpp>
+#include <autoware_vehicle_msgs/msg/control_mode_report.hpp>
+#include <autoware_vehicle_msgs/msg/hazard_lights_command.hpp>
+#include <nav_msgs/msg/odometry.hpp>
+#include <tier4_system_msgs/msg/emergency_holding_state.hpp>
+#include <tier4_system_msgs/msg/mrm_behavior_status.hpp>
+#include <tier4_system_msgs/msg/operation_mode_availability.hpp>
+#include <tier4_system_msgs/srv/operate_mrm.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+using autoware::mrm_handler::MrmHandler;
+using autoware_adapi_v1_msgs::msg::MrmState;
+using autoware_adapi_v1_msgs::msg::OperationModeState;
+using autoware_vehicle_msgs::msg::ControlModeReport;
+using autoware_vehicle_msgs::msg::HazardLightsCommand;
+using nav_msgs::msg::Odometry;
+using tier4_system_msgs::msg::EmergencyHoldingState;
+using tier4_system_msgs::msg::MrmBehaviorStatus;
+using tier4_system_msgs::msg::OperationModeAvailability;
+using tier4_system_msgs::srv::OperateMrm;
+
+namespace
+{
+bool wait_for(const std::function<bool()> & condition, const std::chrono::milliseconds timeout)
+{
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (!condition()) {
+    if (std::chrono::steady_clock::now() > deadline) return false;
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return true;
+}
+}  // namespace
+
+class MrmHandlerTest : public ::testing::Test
+{
+protected:
+  std::shared_ptr<MrmHandler> handler_;
+  std::shared_ptr<rclcpp::Node> test_node_;
+  std::shared_ptr<rclcpp::executors::MultiThreadedExecutor> executor_;
+  std::thread spin_thread_;
+
+  rclcpp::Publisher<OperationModeAvailability>::SharedPtr pub_availability_;
+  rclcpp::Publisher<Odometry>::SharedPtr pub_odom_;
+  rclcpp::Publisher<ControlModeReport>::SharedPtr pub_control_mode_;
+  rclcpp::Publisher<MrmBehaviorStatus>::SharedPtr pub_emergency_stop_status_;
+  rclcpp::Publisher<OperationModeState>::SharedPtr pub_operation_mode_state_;
+  rclcpp::Subscription<MrmState>::SharedPtr sub_mrm_state_;
+  rclcpp::Subscription<HazardLightsCommand>::SharedPtr sub_hazard_;
+  rclcpp::Subscription<EmergencyHoldingState>::SharedPtr sub_emergency_holding_;
+  rclcpp::Service<OperateMrm>::SharedPtr srv_emergency_stop_;
+
+  std::mutex mutex_;
+  std::optional<MrmState> last_mrm_state_;
+  std::optional<HazardLightsCommand> last_hazard_;
+  std::atomic<int> emergency_holding_count_{0};
+  std::atomic<int> emergency_stop_call_count_{0};
+
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+
+    rclcpp::NodeOptions options;
+    // No clock is published, so the simulated time never advances and the timer never fires.
+    // Every output of the handler then comes from the operation mode availability callback.
+    options.parameter_overrides(
+      {{"use_sim_time", true},
+       {"timeout_call_mrm_behavior", 1.0},
+       {"timeout_cancel_mrm_behavior", 1.0}});
+    handler_ = std::make_shared<MrmHandler>(options);
+    test_node_ = std::make_shared<rclcpp::Node>("mrm_handler_test_node");
+
+    pub_availability_ = test_node_->create_publisher<OperationModeAvailability>(
+      "/mrm_handler/input/operation_mode_availability", rclcpp::QoS{1});
+    pub_odom_ = test_node_->create_publisher<Odometry>("/mrm_handler/input/odometry", 1);
+    pub_control_mode_ =
+      test_node_->create_publisher<ControlModeReport>("/mrm_handler/input/control_mode", 1);
+    pub_emergency_stop_status_ = test_node_->create_publisher<MrmBehaviorStatus>(
+      "/mrm_handler/input/mrm/emergency_stop/status", 1);
+    pub_operation_mode_state_ = test_node_->create_publisher<OperationModeState>(
+      "/mrm_handler/input/api/operation_mode/state", 1);
+
+    sub_mrm_state_ = test_node_->create_subscription<MrmState>(
+      "/mrm_handler/output/mrm/state", 1, [this](const MrmState::ConstSharedPtr msg) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        last_mrm_state_ = *msg;
+      });
+    sub_hazard_ = test_node_->create_subscription<HazardLightsCommand>(
+      "/mrm_handler/output/hazard", 1, [this](const HazardLightsCommand::ConstSharedPtr msg) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        last_hazard_ = *msg;
+      });
+    sub_emergency_holding_ = test_node_->create_subscription<EmergencyHoldingState>(
+      "/mrm_handler/output/emergency_holding", 1,
+      [this](const EmergencyHoldingState::ConstSharedPtr) { ++emergency_holding_count_; });
+    srv_emergency_stop_ = test_node_->create_service<OperateMrm>(
+      "/mrm_handler/output/mrm/emergency_stop/operate",
+      [this](
+        const OperateMrm::Request::SharedPtr, const OperateMrm::Response::SharedPtr response) {
+        ++emergency_stop_call_count_;
+        response->response.success = true;
+      });
+
+    executor_ = std::make_shared<rclcpp::executors::MultiThreadedExecutor>();
+    executor_->add_node(handler_);
+    executor_->add_node(test_node_);
+    spin_thread_ = std::thread([this] { executor_->spin(); });
+  }
+
+  void TearDown() override
+  {
+    executor_->cancel();
+    spin_thread_.join();
+    rclcpp::shutdown();
+  }
+
+  // Publish the inputs taken by the polling subscribers of an ego driving autonomously
+  void publishAutonomousDriving()
+  {
+    ASSERT_TRUE(wait_for(
+      [this] {
+        return pub_availability_->get_subscription_count() > 0 &&
+               pub_odom_->get_subscription_count() > 0 &&
+               pub_control_mode_->get_subscription_count() > 0 &&
+               pub_emergency_stop_status_->get_subscription_count() > 0 &&
+               pub_operation_mode_state_->get_subscription_count() > 0 &&
+               sub_mrm_state_->get_publisher_count() > 0;
+      },
+      std::chrono::seconds(5)));
+
+    Odometry odom;
+    odom.twist.twist.linear.x = 10.0;
+    pub_odom_->publish(odom);
+    ControlModeReport control_mode;
+    control_mode.mode = ControlModeReport::AUTONOMOUS;
+    pub_control_mode_->publish(control_mode);
+    MrmBehaviorStatus emergency_stop_status;
+    emergency_stop_status.state = MrmBehaviorStatus::AVAILABLE;
+    pub_emergency_stop_status_->publish(emergency_stop_status);
+    OperationModeState operation_mode_state;
+    operation_mode_state.mode = OperationModeState::AUTONOMOUS;
+    pub_operation_mode_state_->publish(operation_mode_state);
+    // let the middleware deliver the messages before the availability callback takes them
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  }
+
+  void publishAvailability(const bool autonomous)
+  {
+    OperationModeAvailability availability;
+    availability.autonomous = autonomous;
+    availability.emergency_stop = true;
+    pub_availability_->publish(availability);
+  }
+};
+
+TEST_F(MrmHandlerTest, OperateMrmAsSoonAsEmergencyChanges)
+{
+  publishAutonomousDriving();
+
+  // no emergency change, so nothing is published until the next timer period
+  publishAvailability(true);
+  std::this_thread::sleep_for(std::chrono::milliseconds(300));
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    EXPECT_FALSE(last_mrm_state_.has_value());
+  }
+
+  publishAvailability(false);
+  ASSERT_TRUE(wait_for(
+    [this] {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return last_mrm_state_.has_value() && last_hazard_.has_value();
+    },
+    std::chrono::seconds(3)));
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  EXPECT_EQ(last_mrm_state_->state, MrmState::MRM_OPERATING);
+  EXPECT_EQ(last_mrm_state_->behavior, MrmState::EMERGENCY_STOP);
+  EXPECT_EQ(last_hazard_->command, HazardLightsCommand::ENABLE);
+  EXPECT_EQ(emergency_stop_call_count_, 1);
+  // the emergency holding state is not affected by the MRM transition and waits for the timer
+  EXPECT_EQ(emergency_holding_count_, 0);
+}
@@ -0,0 +1,116 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "log_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace autoware::processing_time_checker
+{
+
+LogHistogram::LogHistogram(
+  const double min_value, const double max_value, const size_t bins_per_decade)
+: min_value_(min_value),
+  max_value_(max_value),
+  bins_per_decade_(bins_per_decade),
+  log_min_value_(std::log10(min_value))
+{
+  if (!(0.0 < min_value && min_value < max_value) || bins_per_decade == 0) {
+    throw std::invalid_argument("LogHistogram: invalid bin layout");
+  }
+  // The bins are rounded up to cover max_value, and two more bins hold the under and overflow
+  const auto num_log_bins = static_cast<size_t>(
+    std::ceil(static_cast<double>(bins_per_decade) * (std::log10(max_value) - log_min_value_)));
+  counts_.assign(num_log_bins + 2, 0);
+}
+
+void LogHistogram::add(const double value)
+{
+  size_t index = 0;
+  if (value >= max_value_) {
+    index = counts_.size() - 1;
+  } else if (value >= min_value_) {
+    const double offset =
+      static_cast<double>(bins_per_decade_) * (std::log10(value) - log_min_value_);
+    index = std::min(static_cast<size_t>(offset) + 1, counts_.size() - 2);
+  }
+  ++counts_[index];
+  min_ = std::min(min_, value);
+  max_ = std::max(max_, value);
+  ++count_;
+}
+
+void LogHistogram::merge(const LogHistogram & other)
+{
+  if (
+    min_value_ != other.min_value_ || max_value_ != other.max_value_ ||
+    bins_per_decade_ != other.bins_per_decade_) {
+    throw std::invalid_argument("LogHistogram: cannot merge histograms of different layouts");
+  }
+  for (size_t i = 0; i < counts_.size(); ++i) {
+    counts_[i] += other.counts_[i];
+  }
+  min_ = std::min(min_, other.min_);
+  max_ = std::max(max_, other.max_);
+  count_ += other.count_;
+}
+
+double LogHistogram::lower_bound(const size_t index) const
+{
+  if (index == 0) {
+    return min_;
+  }
+  if (index == counts_.size() - 1) {
+    return max_value_;
+  }
+  return min_value_ * std::pow(10.0, static_cast<double>(index - 1) / bins_per_decade_);
+}
+
+double LogHistogram::upper_bound(const size_t index) const
+{
+  if (index == 0) {
+    return min_value_;
+  }
+  if (index >= counts_.size() - 2) {
+    return index == counts_.size() - 1 ? max_ : max_value_;
+  }
+  return lower_bound(index + 1);
+}
+
+double LogHistogram::quantile(const double probability) const
+{
+  if (count_ == 0) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  const double rank = std::clamp(probability, 0.0, 1.0) * static_cast<double>(count_);
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < counts_.size(); ++i) {
+    if (counts_[i] == 0 || static_cast<double>(cumulative + counts_[i]) < rank) {
+      cumulative += counts_[i];
+      continue;
+    }
+    const double fraction = (rank - static_cast<double>(cumulative)) / counts_[i];
+    const double lower = std::clamp(lower_bound(i), min_, max_);
+    const double upper = std::clamp(upper_bound(i), min_, max_);
+    if (lower > 0.0 && i != 0) {
+      return lower * std::pow(upper / lower, fraction);
+    }
+    return lower + (upper - lower) * fraction;
+  }
+  return max_;
+}
+
+}  // namespace autoware::processing_time_checker
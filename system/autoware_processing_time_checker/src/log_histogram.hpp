@@ -0,0 +1,106 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LOG_HISTOGRAM_HPP_
+#define LOG_HISTOGRAM_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace autoware::processing_time_checker
+{
+/**
+ * @brief histogram with logarithmically spaced bins, suited to positive values such as latencies.
+ * @details The bins cover [min_value, max_value) with a constant relative width, the values below
+ * min_value (including the negative ones) fall into the first bin and the values above max_value
+ * into the last one. Histograms with the same layout can be merged, e.g. to combine runs.
+ */
+class LogHistogram
+{
+public:
+  /**
+   * @brief constructor
+   * @param min_value lower bound of the first logarithmic bin, must be positive
+   * @param max_value upper bound of the last logarithmic bin, must be greater than min_value
+   * @param bins_per_decade number of bins between a value and ten times the value
+   * @throw std::invalid_argument if the layout is invalid
+   */
+  LogHistogram(double min_value, double max_value, size_t bins_per_decade);
+
+  /**
+   * @brief add a value
+   * @param value value to add
+   */
+  void add(double value);
+
+  /**
+   * @brief add the values of another histogram
+   * @param other histogram to merge
+   * @throw std::invalid_argument if the layouts of the histograms differ
+   */
+  void merge(const LogHistogram & other);
+
+  /**
+   * @brief get an estimate of a quantile, interpolated geometrically inside its bin
+   * @param probability probability of the quantile, in [0, 1]
+   * @return the quantile clamped to the observed range, or NaN if no value was added
+   */
+  double quantile(double probability) const;
+
+  /**
+   * @brief get the lower bound of a bin, the lowest observed value for the underflow bin
+   */
+  double lower_bound(size_t index) const;
+
+  /**
+   * @brief get the upper bound of a bin, the highest observed value for the overflow bin
+   */
+  double upper_bound(size_t index) const;
+
+  /**
+   * @brief get the count of each bin, from the underflow bin to the overflow bin
+   */
+  const std::vector<uint64_t> & counts() const { return counts_; }
+
+  /**
+   * @brief get the minimum value
+   */
+  double min() const { return min_; }
+
+  /**
+   * @brief get the maximum value
+   */
+  double max() const { return max_; }
+
+  /**
+   * @brief get the number of values used to build this statistic
+   */
+  uint64_t count() const { return count_; }
+
+private:
+  double min_value_;
+  double max_value_;
+  size_t bins_per_decade_;
+  double log_min_value_;
+  std::vector<uint64_t> counts_;
+  double min_ = std::numeric_limits<double>::max();
+  double max_ = std::numeric_limits<double>::lowest();
+  uint64_t count_ = 0;
+};
+
+}  // namespace autoware::processing_time_checker
+
+#endif  // LOG_HISTOGRAM_HPP_
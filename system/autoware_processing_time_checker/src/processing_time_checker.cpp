@@ -18,10 +18,14 @@
 #include <rclcpp/rclcpp.hpp>
 
 #include <chrono>
+#include <cmath>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <optional>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace autoware::processing_time_checker
@@ -44,10 +48,14 @@ ProcessingTimeChecker::ProcessingTimeChecker(const rclcpp::NodeOptions & node_op
 : Node("processing_time_checker", node_options)
 {
   output_metrics_ = declare_parameter<bool>("output_metrics");
+  deadline_ms_ = declare_parameter<double>("deadline_ms", 100.0);
   const double update_rate = declare_parameter<double>("update_rate");
   const auto processing_time_topic_name_list =
     declare_parameter<std::vector<std::string>>("processing_time_topic_name_list");
 
+  // topic name - module slot
+  std::vector<std::pair<std::string, ModuleSlot *>> topic_slots;
+  std::unordered_map<std::string, ModuleSlot *> module_slot_map;
   for (const auto & processing_time_topic_name : processing_time_topic_name_list) {
     std::optional<std::string> module_name{std::nullopt};
 
@@ -68,26 +76,37 @@ ProcessingTimeChecker::ProcessingTimeChecker(const rclcpp::NodeOptions & node_op
     }
 
     // register module name
-    if (module_name) {
-      module_name_map_.insert_or_assign(processing_time_topic_name, *module_name);
-      processing_time_accumulator_map_.insert_or_assign(*module_name, Accumulator<double>());
-    } else {
+    if (!module_name) {
       throw std::invalid_argument("The format of the processing time topic name is not correct.");
     }
+    auto [module_slot_it, inserted] = module_slot_map.emplace(*module_name, nullptr);
+    if (inserted) {
+      auto & module_slot = module_slots_.emplace_back();
+      module_slot.module_name = *module_name;
+      module_slot.metric_name = "processing_time/" + *module_name;
+      module_slot_it->second = &module_slot;
+    }
+    topic_slots.emplace_back(processing_time_topic_name, module_slot_it->second);
   }
 
-  // create subscribers
-  for (const auto & processing_time_topic_name : processing_time_topic_name_list) {
-    const auto & module_name = module_name_map_.at(processing_time_topic_name);
-
+  // create subscribers, in a callback group of their own so that they do not wait for the timer
+  subscriber_callback_group_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  rclcpp::SubscriptionOptions subscription_options;
+  subscription_options.callback_group = subscriber_callback_group_;
+  for (const auto & [processing_time_topic_name, module_slot] : topic_slots) {
     // clang-format off
     processing_time_subscribers_.push_back(
       create_subscription<Float64Stamped>(
         processing_time_topic_name, 1,
-        [this, &module_name]([[maybe_unused]] const Float64Stamped & msg) {
-          processing_time_map_.insert_or_assign(module_name, msg.data);
-          processing_time_accumulator_map_.at(module_name).add(msg.data);
-        }));
+        [this, module_slot = module_slot](const Float64Stamped & msg) {
+          module_slot->latest_processing_time.store(msg.data, std::memory_order_relaxed);
+          module_slot->accumulator.add(msg.data);
+          module_slot->histogram.add(msg.data);
+          if (msg.data > deadline_ms_) {
+            ++module_slot->deadline_miss_count;
+          }
+        },
+        subscription_options));
     // clang-format on
   }
 
@@ -107,13 +126,19 @@ ProcessingTimeChecker::~ProcessingTimeChecker()
   try {
     // generate json data
     nlohmann::json j;
-    for (const auto & accumulator_iterator : processing_time_accumulator_map_) {
-      const auto module_name = accumulator_iterator.first;
-      const auto processing_time_accumulator = accumulator_iterator.second;
+    for (const auto & module_slot : module_slots_) {
+      const auto & module_name = module_slot.module_name;
+      const auto & processing_time_accumulator = module_slot.accumulator;
       j[module_name + "/min"] = processing_time_accumulator.min();
       j[module_name + "/max"] = processing_time_accumulator.max();
       j[module_name + "/mean"] = processing_time_accumulator.mean();
       j[module_name + "/count"] = processing_time_accumulator.count();
+      if (processing_time_accumulator.count() > 0) {
+        j[module_name + "/p50"] = module_slot.histogram.quantile(0.5);
+        j[module_name + "/p95"] = module_slot.histogram.quantile(0.95);
+        j[module_name + "/p99"] = module_slot.histogram.quantile(0.99);
+      }
+      j[module_name + "/deadline_miss_count"] = module_slot.deadline_miss_count;
       j[module_name + "/description"] = "processing time of " + module_name + "[ms]";
     }
 
@@ -156,16 +181,20 @@ void ProcessingTimeChecker::on_timer()
 {
   // create MetricArrayMsg
   MetricArrayMsg metrics_msg;
-  for (const auto & processing_time_iterator : processing_time_map_) {
-    const auto processing_time_topic_name = processing_time_iterator.first;
-    const double processing_time = processing_time_iterator.second;
+  metrics_msg.metric_array.reserve(module_slots_.size());
+  for (const auto & module_slot : module_slots_) {
+    const double processing_time =
+      module_slot.latest_processing_time.load(std::memory_order_relaxed);
+    if (std::isnan(processing_time)) {  // not received yet
+      continue;
+    }
 
     // generate MetricMsg
     MetricMsg metric;
-    metric.name = "processing_time/" + processing_time_topic_name;
+    metric.name = module_slot.metric_name;
     metric.value = std::to_string(processing_time);
     metric.unit = "millisecond";
-    metrics_msg.metric_array.push_back(metric);
+    metrics_msg.metric_array.push_back(std::move(metric));
   }
 
   // publish
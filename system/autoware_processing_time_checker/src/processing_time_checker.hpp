@@ -16,6 +16,7 @@
 #define PROCESSING_TIME_CHECKER_HPP_
 
 #include "autoware_utils/math/accumulator.hpp"
+#include "log_histogram.hpp"
 
 #include <rclcpp/rclcpp.hpp>
 
@@ -23,8 +24,11 @@
 #include <tier4_metric_msgs/msg/metric.hpp>
 #include <tier4_metric_msgs/msg/metric_array.hpp>
 
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <limits>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 namespace autoware::processing_time_checker
@@ -43,20 +47,33 @@ public:
 private:
   void on_timer();
 
+  // Processing time of a module, shared by the topics of the module
+  struct ModuleSlot
+  {
+    std::string module_name;
+    std::string metric_name;
+
+    // latest processing time, written by the subscriptions and read by the timer
+    std::atomic<double> latest_processing_time{std::numeric_limits<double>::quiet_NaN()};
+
+    // statistics, only written by the subscriptions of the mutually exclusive callback group
+    Accumulator<double> accumulator;
+    LogHistogram histogram{0.01, 10000.0, 20};  // [ms] bins of 12% relative width
+    uint64_t deadline_miss_count{0};
+  };
+
   rclcpp::TimerBase::SharedPtr timer_;
 
   rclcpp::Publisher<MetricArrayMsg>::SharedPtr metrics_pub_;
+  rclcpp::CallbackGroup::SharedPtr subscriber_callback_group_;
   std::vector<rclcpp::Subscription<Float64Stamped>::SharedPtr> processing_time_subscribers_;
 
   // parameters
   bool output_metrics_;
+  double deadline_ms_;
 
-  // topic name - module name
-  std::unordered_map<std::string, std::string> module_name_map_{};
-  // module name - processing time
-  std::unordered_map<std::string, double> processing_time_map_{};
-  // module name - accumulator
-  std::unordered_map<std::string, Accumulator<double>> processing_time_accumulator_map_{};
+  // slots are only added in the constructor, so that their addresses are stable
+  std::deque<ModuleSlot> module_slots_;
 };
 }  // namespace autoware::processing_time_checker
 
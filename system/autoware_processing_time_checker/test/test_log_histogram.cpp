@@ -0,0 +1,79 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "log_histogram.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+TEST(log_histogram, addValues)
+{
+  autoware::processing_time_checker::LogHistogram histogram(1.0, 1000.0, 10);
+  histogram.add(-1.0);
+  histogram.add(1.0);
+  histogram.add(999.0);
+  histogram.add(1000.0);
+
+  const auto & counts = histogram.counts();
+  ASSERT_EQ(counts.size(), 32);
+  EXPECT_EQ(counts.front(), 1);
+  EXPECT_EQ(counts.at(1), 1);
+  EXPECT_EQ(counts.at(30), 1);
+  EXPECT_EQ(counts.back(), 1);
+  EXPECT_EQ(histogram.count(), 4);
+  EXPECT_DOUBLE_EQ(histogram.min(), -1.0);
+  EXPECT_DOUBLE_EQ(histogram.max(), 1000.0);
+  EXPECT_NEAR(histogram.lower_bound(11), 10.0, 1e-9);
+  EXPECT_NEAR(histogram.upper_bound(10), 10.0, 1e-9);
+}
+
+TEST(log_histogram, quantile)
+{
+  autoware::processing_time_checker::LogHistogram histogram(0.001, 10.0, 20);
+  EXPECT_TRUE(std::isnan(histogram.quantile(0.5)));
+
+  std::mt19937 engine(0);
+  std::exponential_distribution<double> distribution(10.0);
+  for (int i = 0; i < 100000; ++i) {
+    histogram.add(distribution(engine));
+  }
+
+  // Quantiles of the exponential distribution are -ln(1 - p) / lambda, bins are 12% wide
+  EXPECT_NEAR(histogram.quantile(0.5), std::log(2.0) / 10.0, 0.01);
+  EXPECT_NEAR(histogram.quantile(0.99), std::log(100.0) / 10.0, 0.05);
+  EXPECT_DOUBLE_EQ(histogram.quantile(0.0), histogram.min());
+  EXPECT_DOUBLE_EQ(histogram.quantile(1.0), histogram.max());
+}
+
+TEST(log_histogram, merge)
+{
+  autoware::processing_time_checker::LogHistogram a(1.0, 100.0, 5);
+  autoware::processing_time_checker::LogHistogram b(1.0, 100.0, 5);
+  a.add(2.0);
+  b.add(50.0);
+  b.add(0.5);
+  a.merge(b);
+
+  EXPECT_EQ(a.count(), 3);
+  EXPECT_DOUBLE_EQ(a.min(), 0.5);
+  EXPECT_DOUBLE_EQ(a.max(), 50.0);
+  EXPECT_EQ(a.counts().front(), 1);
+
+  autoware::processing_time_checker::LogHistogram c(1.0, 100.0, 10);
+  EXPECT_THROW(a.merge(c), std::invalid_argument);
+  EXPECT_THROW(autoware::processing_time_checker::LogHistogram(0.0, 1.0, 10), std::invalid_argument);
+}
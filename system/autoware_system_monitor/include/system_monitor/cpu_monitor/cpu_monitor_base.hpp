@@ -20,6 +20,8 @@
 #ifndef SYSTEM_MONITOR__CPU_MONITOR__CPU_MONITOR_BASE_HPP_
 #define SYSTEM_MONITOR__CPU_MONITOR__CPU_MONITOR_BASE_HPP_
 
+#include "system_monitor/system_sampler/system_sampler.hpp"
+
 #include <diagnostic_updater/diagnostic_updater.hpp>
 
 #include <tier4_external_api_msgs/msg/cpu_status.hpp>
@@ -102,7 +104,7 @@ protected:
 
   /**
    * @brief convert Cpu Usage To diagnostic Level
-   * @param [cpu_name] mpstat cpu name
+   * @param [cpu_name] cpu name, "all" or the core index
    * @param [usage] cpu usage value
    * @return DiagStatus::OK or WARN or ERROR
    */
@@ -141,7 +143,10 @@ protected:
   std::vector<cpu_freq_info> freqs_;        //!< @brief CPU list for frequency
   std::vector<int> usage_warn_check_cnt_;   //!< @brief CPU list for usage over warn check counter
   std::vector<int> usage_error_check_cnt_;  //!< @brief CPU list for usage over error check counter
-  bool mpstat_exists_;                      //!< @brief flag if mpstat exists
+  CpuUsageSampler cpu_usage_sampler_;       //!< @brief sampler of /proc/stat
+  std::vector<CpuLoad> cpu_loads_;          //!< @brief CPU usage of the last check
+  SysfsReader sysfs_reader_;                //!< @brief reader of /proc/loadavg and sysfs files
+  std::string sysfs_content_;               //!< @brief buffer reused between the file reads
 
   float usage_warn_;       //!< @brief CPU usage(%) to generate warning
   float usage_error_;      //!< @brief CPU usage(%) to generate error
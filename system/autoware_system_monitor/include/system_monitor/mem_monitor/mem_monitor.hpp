@@ -20,6 +20,8 @@
 #ifndef SYSTEM_MONITOR__MEM_MONITOR__MEM_MONITOR_HPP_
 #define SYSTEM_MONITOR__MEM_MONITOR__MEM_MONITOR_HPP_
 
+#include "system_monitor/system_sampler/system_sampler.hpp"
+
 #include <diagnostic_updater/diagnostic_updater.hpp>
 
 #include <climits>
@@ -60,10 +62,10 @@ protected:
 
   /**
    * @brief get human-readable output for memory size
-   * @param [in] str size with bytes
+   * @param [in] bytes size in bytes
    * @return human-readable output
    */
-  std::string toHumanReadable(const std::string & str);
+  std::string toHumanReadable(const size_t bytes);
 
   diagnostic_updater::Updater updater_;  //!< @brief Updater class which advertises to /diagnostics
 
@@ -71,6 +73,8 @@ protected:
 
   size_t available_size_;  //!< @brief Memory available size to generate error
 
+  MemInfoSampler mem_info_sampler_;  //!< @brief sampler of /proc/meminfo
+
   /**
    * @brief Memory usage status messages
    */
@@ -17,11 +17,14 @@
 
 // This file defines structures for process information.
 // As the definitions are implementation dependent,
-// this file should be included only from process_monitor.cpp to reduce dependencies.
+// this file should be included only from the sources of process monitor to reduce dependencies.
+
+#include <dirent.h>
 
 #include <cstdint>  // for int32_t, int64_t
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // For type and size of fields, see "man 5 proc".
@@ -96,4 +99,31 @@ struct ProcessStatistics
   double uptime_delta_sec;
 };
 
+// Information of a process kept across scans.
+struct ProcessEntry
+{
+  RawProcessInfo info;
+  uint64_t generation;  // Last scan in which the process was valid.
+};
+
+// Candidate of a ranking, which refers to an entry of ProcessScanState::processes.
+struct RankingCandidate
+{
+  int64_t value;
+  uint32_t order;  // Order in the scan. The earlier process wins a tie.
+  const RawProcessInfo * info;
+};
+
+// State of the incremental scanner of /proc, kept across scans to avoid allocations.
+struct ProcessScanState
+{
+  std::unordered_map<pid_t, ProcessEntry> processes;
+  std::string root_path;  // Root of /proc from which the processes are scanned.
+  uint64_t generation;
+  std::unique_ptr<DIR, int (*)(DIR *)> proc_dir{nullptr, closedir};
+  std::string buffer;  // Reused buffer for reading /proc files.
+  std::vector<RankingCandidate> load_heap;
+  std::vector<RankingCandidate> memory_heap;
+};
+
 #endif  // SYSTEM_MONITOR__PROCESS_MONITOR__PROCESS_INFORMATION_HPP_
@@ -30,9 +30,9 @@
 #include <memory>
 #include <mutex>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
+struct ProcessScanState;
 struct ProcessStatistics;
 struct RawProcessInfo;
 
@@ -145,11 +145,18 @@ private:
    */
   void initializeProcessStatistics();
 
+  /**
+   * @brief open the proc filesystem directory, which is kept open across scans
+   * @return true if successful
+   */
+  bool openProcDir();
+
   /**
    * @brief collect process information
    * @param [in]  pid_str Process ID in numeric string
+   * @param [in]  order   Order of the process in the current scan
    */
-  void collectProcessInfo(const char * pid_str);
+  void collectProcessInfo(const char * pid_str, uint32_t order);
 
   /**
    * @brief scan proc filesystem
@@ -164,28 +171,16 @@ private:
   bool readMemInfo();
 
   /**
-   * @brief update high load process ranking
-   * @param [in]  info Raw process information
-   */
-  void updateHighLoadProcessRanking(const RawProcessInfo & info);
-
-  /**
-   * @brief update high memory process ranking
-   * @param [in]  info Raw process information
-   */
-  void updateHighMemoryProcessRanking(const RawProcessInfo & info);
-
-  /**
-   * @brief register process information to new map
-   * @param [in] pid  Process ID
-   * @param [in] info Raw process information
+   * @brief update high load and high memory process rankings
+   * @param [in]  info  Raw process information
+   * @param [in]  order Order of the process in the current scan
    */
-  void registerProcessInfoToNewMap(const pid_t pid, const RawProcessInfo & info);
+  void updateProcessRankings(const RawProcessInfo & info, uint32_t order);
 
   /**
-   * @brief rotate process maps
+   * @brief copy the ranked processes to the process statistics
    */
-  void rotateProcessMaps();
+  void fillProcessRankings();
 
   /**
    * @brief get system uptime
@@ -233,10 +228,8 @@ private:
 
   std::unique_ptr<ProcessStatistics>
     work_{};  //!< @brief Unstable information being read from /proc files
-  std::unordered_map<pid_t, std::shared_ptr<RawProcessInfo>> pid_map1_{};
-  std::unordered_map<pid_t, std::shared_ptr<RawProcessInfo>> pid_map2_{};
-  std::unordered_map<pid_t, std::shared_ptr<RawProcessInfo>> & prev_map_{pid_map1_};
-  std::unordered_map<pid_t, std::shared_ptr<RawProcessInfo>> & new_map_{pid_map2_};
+  std::unique_ptr<ProcessScanState>
+    scan_state_{};  //!< @brief Processes and buffers kept across scans of /proc
 
   std::unique_ptr<ProcessStatistics>
     snapshot_{};  //!< @brief Stable information copied from work_ within mutex_ locked scope
@@ -0,0 +1,133 @@
+// Copyright 2025 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file process_scan.hpp
+ * @brief Parsers of /proc files and rankings used by the incremental scanner of process monitor
+ */
+
+#ifndef SYSTEM_MONITOR__PROCESS_MONITOR__PROCESS_SCAN_HPP_
+#define SYSTEM_MONITOR__PROCESS_MONITOR__PROCESS_SCAN_HPP_
+
+#include "system_monitor/process_monitor/process_information.hpp"
+
+#include <sys/types.h>
+
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief extract a number in the same way as std::istream::operator>>, without a stream
+ * @param [in,out] pos Position to extract from, moved past the number on success
+ * @param [out] value Extracted number
+ * @return false if no number is found or it overflows T
+ * @note Leading spaces are skipped. A negative value of an unsigned type wraps around.
+ */
+template <typename T>
+bool extractNumber(const char *& pos, T & value)
+{
+  using Unsigned = std::make_unsigned_t<T>;
+
+  const char * p = pos;
+  while (std::isspace(static_cast<unsigned char>(*p))) {
+    ++p;
+  }
+  bool negative = false;
+  if (*p == '+' || *p == '-') {
+    negative = (*p == '-');
+    ++p;
+  }
+  if (!std::isdigit(static_cast<unsigned char>(*p))) {
+    return false;
+  }
+  Unsigned max_magnitude = std::numeric_limits<T>::max();
+  if (std::is_signed_v<T> && negative) {
+    max_magnitude += 1;  // The magnitude of the minimum value.
+  }
+  Unsigned magnitude = 0;
+  bool overflow = false;
+  for (; std::isdigit(static_cast<unsigned char>(*p)); ++p) {
+    const auto digit = static_cast<Unsigned>(*p - '0');
+    if (magnitude > (max_magnitude - digit) / 10) {
+      overflow = true;  // Consume the remaining digits as istream does.
+    } else {
+      magnitude = magnitude * 10 + digit;
+    }
+  }
+  if (overflow) {
+    return false;
+  }
+  value = static_cast<T>(negative ? Unsigned{0} - magnitude : magnitude);
+  pos = p;
+  return true;
+}
+
+/**
+ * @brief extract a character which is not a space
+ * @param [in,out] pos Position to extract from, moved past the character on success
+ * @param [out] value Extracted character
+ * @return false if the end of the string is reached
+ */
+bool extractChar(const char *& pos, char & value);
+
+/**
+ * @brief parse the first line of /proc/[pid]/stat
+ * @param [in] buffer Content of the file
+ * @param [out] info Parsed fields, left unchanged on failure
+ * @return false if any of the fields is missing or malformed
+ */
+bool parseStat(const std::string & buffer, StatInfo & info);
+
+/**
+ * @brief parse /proc/[pid]/statm
+ * @param [in] buffer Content of the file
+ * @param [out] info Parsed fields, left unchanged on failure
+ * @return false if any of the fields is missing or malformed
+ */
+bool parseStatMemory(const std::string & buffer, StatMemoryInfo & info);
+
+/**
+ * @brief order of the rankings: the higher value first, and the earlier process for a tie
+ * @param [in] lhs Candidate
+ * @param [in] rhs Candidate
+ * @return true if lhs is ranked higher than rhs
+ */
+bool isRankedHigher(const RankingCandidate & lhs, const RankingCandidate & rhs);
+
+/**
+ * @brief keep the highest candidates in a bounded heap whose top is the lowest ranked one
+ * @param [in,out] heap Heap of the candidates
+ * @param [in] capacity Maximum number of the candidates kept in the heap
+ * @param [in] candidate Candidate to push
+ */
+void pushRankingCandidate(
+  std::vector<RankingCandidate> & heap, std::size_t capacity, const RankingCandidate & candidate);
+
+/**
+ * @brief find the entry of a process kept from the previous scans, or add a new one
+ * @param [in,out] scan State of the scanner
+ * @param [in] pid Process ID
+ * @param [in] starttime_tick Start time of the process, which tells a reused pid apart
+ * @param [out] known true if the entry holds the same process from the previous scans
+ * @return Entry of the process
+ */
+ProcessEntry & findProcessEntry(
+  ProcessScanState & scan, pid_t pid, uint64_t starttime_tick, bool & known);
+
+#endif  // SYSTEM_MONITOR__PROCESS_MONITOR__PROCESS_SCAN_HPP_
@@ -0,0 +1,164 @@
+// Copyright 2025 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file system_sampler.hpp
+ * @brief Samplers reading /proc and sysfs directly, without executing external commands
+ */
+
+#ifndef SYSTEM_MONITOR__SYSTEM_SAMPLER__SYSTEM_SAMPLER_HPP_
+#define SYSTEM_MONITOR__SYSTEM_SAMPLER__SYSTEM_SAMPLER_HPP_
+
+#include <autoware/universe_utils/system/proc_file.hpp>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+/**
+ * @brief reader of sysfs attributes which keeps a file descriptor open for each path
+ */
+class SysfsReader
+{
+public:
+  /**
+   * @brief read the attribute
+   * @param [in] path path of the attribute
+   * @param [out] content content of the attribute
+   * @return true on success, otherwise the error is available with getError
+   */
+  bool read(const std::string & path, std::string & content);
+
+  const std::string & getError() const { return error_; }
+
+private:
+  //! @brief opened files by path
+  std::map<std::string, autoware::universe_utils::PersistentFile> files_;
+  std::string error_;  //!< @brief error of the last failed read
+};
+
+/**
+ * @brief CPU time counters of a line of /proc/stat, in USER_HZ
+ */
+struct CpuTimes
+{
+  uint64_t user{0};
+  uint64_t nice{0};
+  uint64_t system{0};
+  uint64_t idle{0};
+  uint64_t iowait{0};
+  uint64_t irq{0};
+  uint64_t softirq{0};
+  uint64_t steal{0};
+  uint64_t guest{0};
+  uint64_t guest_nice{0};
+};
+
+/**
+ * @brief CPU usage between two samples in percent, with the same fields as mpstat
+ */
+struct CpuLoad
+{
+  std::string name;  //!< @brief "all" for the whole CPU, otherwise the core index
+  float usr{0.0};
+  float nice{0.0};
+  float sys{0.0};
+  float iowait{0.0};
+  float irq{0.0};
+  float soft{0.0};
+  float steal{0.0};
+  float guest{0.0};
+  float gnice{0.0};
+  float idle{0.0};
+};
+
+/**
+ * @brief parse the cpu lines of /proc/stat
+ * @param [in] content content of /proc/stat
+ * @return CPU names ("all" for the first line, then the core indices) and their counters
+ */
+std::vector<std::pair<std::string, CpuTimes>> parseProcStat(const std::string & content);
+
+/**
+ * @brief calculate the CPU usage between two samples
+ * @param [in] name CPU name
+ * @param [in] prev counters of the previous sample
+ * @param [in] curr counters of the current sample
+ * @return CPU usage, fully idle if no time elapsed
+ */
+CpuLoad calcCpuLoad(const std::string & name, const CpuTimes & prev, const CpuTimes & curr);
+
+/**
+ * @brief sampler of the CPU usage of /proc/stat, the usage is calculated over the period between
+ * two updates instead of blocking during a measurement period
+ */
+class CpuUsageSampler
+{
+public:
+  /**
+   * @brief constructor, which takes the first sample
+   */
+  CpuUsageSampler();
+
+  /**
+   * @brief sample /proc/stat and calculate the usage since the previous sample
+   * @param [out] loads usage of the whole CPU followed by the usage of each core
+   * @return true on success, otherwise the error is available with getError
+   */
+  bool update(std::vector<CpuLoad> & loads);
+
+  const std::string & getError() const { return error_; }
+
+private:
+  autoware::universe_utils::PersistentFile file_;  //!< @brief /proc/stat
+  std::string content_;                            //!< @brief buffer reused between the samples
+  std::map<std::string, CpuTimes> prev_;  //!< @brief counters of the previous sample by name
+  std::string error_;                              //!< @brief error of the last failed update
+};
+
+/**
+ * @brief sampler of /proc/meminfo
+ */
+class MemInfoSampler
+{
+public:
+  MemInfoSampler();
+
+  /**
+   * @brief sample /proc/meminfo
+   * @param [out] mem_info memory information
+   * @return true on success, otherwise the error is available with getError
+   */
+  bool update(autoware::universe_utils::MemInfo & mem_info);
+
+  const std::string & getError() const { return error_; }
+
+private:
+  autoware::universe_utils::PersistentFile file_;  //!< @brief /proc/meminfo
+  std::string content_;                            //!< @brief buffer reused between the samples
+  std::string error_;                              //!< @brief error of the last failed update
+};
+
+/**
+ * @brief find the sysfs input of a hwmon voltage channel
+ * @param [in] label label of the channel (content of in*_label) or its name (in0, in1, ...).
+ * A trailing colon is ignored, so that the label printed by `sensors` can be used.
+ * @return path of the in*_input file in millivolts, empty if not found
+ */
+std::string findHwmonVoltageInput(const std::string & label);
+
+#endif  // SYSTEM_MONITOR__SYSTEM_SAMPLER__SYSTEM_SAMPLER_HPP_
@@ -20,10 +20,12 @@
 #ifndef SYSTEM_MONITOR__VOLTAGE_MONITOR__VOLTAGE_MONITOR_HPP_
 #define SYSTEM_MONITOR__VOLTAGE_MONITOR__VOLTAGE_MONITOR_HPP_
 
+#include "system_monitor/system_sampler/system_sampler.hpp"
+
 #include <diagnostic_updater/diagnostic_updater.hpp>
 
 #include <climits>
-#include <regex>
+#include <memory>
 #include <string>
 class VoltageMonitor : public rclcpp::Node
 {
@@ -66,7 +68,10 @@ protected:
   float voltage_warn_;
   float voltage_error_;
   std::string voltage_string_;
-  std::regex voltage_regex_;
+  //! @brief hwmon input of cmos_battery_label
+  std::unique_ptr<autoware::universe_utils::PersistentFile> voltage_file_;
+  autoware::universe_utils::PersistentFile rtc_file_;  //!< @brief /proc/driver/rtc
+  std::string content_;                                //!< @brief buffer reused between the reads
 };
 
 #endif  // SYSTEM_MONITOR__VOLTAGE_MONITOR__VOLTAGE_MONITOR_HPP_
@@ -20,17 +20,21 @@
 #include "system_monitor/process_monitor/process_monitor.hpp"
 
 #include "system_monitor/process_monitor/process_information.hpp"
+#include "system_monitor/process_monitor/process_scan.hpp"
 
 #include <autoware_utils/system/stop_watch.hpp>
 
 #include <dirent.h>
+#include <fcntl.h>
 #include <fmt/format.h>
 #include <pwd.h>
 #include <sys/types.h>
 #include <unistd.h>  // for gethostname()
 
 #include <algorithm>
+#include <cerrno>
 #include <cmath>  // for std::ceil()
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -223,84 +227,26 @@ bool isProcessID(const char * entry)
   return isNumeric(name);
 }
 
-bool readStat(const std::string & proc_path, StatInfo & info)
+// Read a whole file relative to a directory descriptor into the reused buffer.
+bool readFileAt(int dir_fd, const char * path, std::string & buffer)
 {
-  std::string stat_path = proc_path + "stat";
-
-  std::ifstream stat_file(stat_path);
-  if (!stat_file) {
-    return false;
-  }
-  std::string line;
-  if (!std::getline(stat_file, line, '\n')) {
-    return false;
-  }
-
-  StatInfo info_temp{};
-  try {
-    std::istringstream line_stream(line);
-    line_stream.exceptions(std::ios::failbit | std::ios::badbit);
-    line_stream >> info_temp.pid;
-    line_stream.exceptions();  // Reset to default state
-  } catch (...) {
-    return false;
-  }
-
-  // command may include spaces. Ex. (UVM deferred release queue)
-  // command may include multiple pairs of parentheses. Ex. ((XXX))
-  const std::size_t left_parenthesis_pos = line.find('(');
-  const std::size_t right_parenthesis_pos = line.find_last_of(')');
-  if ((left_parenthesis_pos == std::string::npos) || (right_parenthesis_pos == std::string::npos)) {
+  const int fd = openat(dir_fd, path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
     return false;
   }
-
-  const std::size_t command_len =
-    right_parenthesis_pos - left_parenthesis_pos + 1;  // includes parentheses.
-  try {  // Handle exceptions from std::string::substr(). Just in case.
-    const std::string command = line.substr(left_parenthesis_pos, command_len);
-    const std::string after_command = line.substr(right_parenthesis_pos + 1);
-    info_temp.command = command;
-
-    try {
-      std::istringstream after_command_stream(after_command);
-      after_command_stream.exceptions(std::ios::failbit | std::ios::badbit);
-      after_command_stream >> info_temp.state >> info_temp.ppid >> info_temp.pgrp >>
-        info_temp.session >> info_temp.tty_nr >> info_temp.tpgid >> info_temp.flags >>
-        info_temp.min_flt >> info_temp.c_min_flt >> info_temp.maj_flt >> info_temp.c_maj_flt >>
-        info_temp.utime_tick >> info_temp.stime_tick >> info_temp.c_utime_tick >>
-        info_temp.c_stime_tick >> info_temp.priority >> info_temp.nice >> info_temp.num_threads >>
-        info_temp.it_real_value >> info_temp.starttime_tick >> info_temp.vsize_byte >>
-        info_temp.rss_page;
-      after_command_stream.exceptions();  // Reset to default state
-    } catch (...) {
-      return false;  // Failed to read all values
+  buffer.clear();
+  char chunk[4096];
+  for (;;) {
+    const ssize_t size = read(fd, chunk, sizeof(chunk));
+    if (size < 0 && errno == EINTR) {
+      continue;
     }
-    info = info_temp;
-    return true;
-  } catch (...) {
-    return false;
-  }
-}
-
-bool readStatMemory(const std::string & proc_path, StatMemoryInfo & info)
-{
-  // cspell:ignore statm
-  const std::string stat_memory_path = proc_path + "statm";
-
-  std::ifstream stat_memory_file(stat_memory_path);
-  if (!stat_memory_file) {
-    return false;
-  }
-  StatMemoryInfo info_temp{};
-  try {
-    stat_memory_file.exceptions(std::ios::failbit | std::ios::badbit);
-    stat_memory_file >> info_temp.size_page >> info_temp.resident_page >> info_temp.share_page;
-    stat_memory_file.exceptions();  // Reset to default state
-  } catch (...) {
-    stat_memory_file.exceptions();  // Reset even if exception occurs
-    return false;                   // Failed to read all values
+    if (size <= 0) {
+      break;
+    }
+    buffer.append(chunk, static_cast<std::size_t>(size));
   }
-  info = info_temp;
+  close(fd);
   return true;
 }
 
@@ -360,50 +306,6 @@ bool readStatus(const std::string & proc_path, StatusInfo & info)
   return true;
 }
 
-// Helper function for process ranking about CPU usage
-int64_t getCpuUsage(const RawProcessInfo & info)
-{
-  return info.diff_info.cpu_usage;
-}
-
-// Helper function for process rankin about memory usage
-int64_t getMemoryUsage(const RawProcessInfo & info)
-{
-  return info.stat_memory_info.resident_page;
-}
-
-void updateProcessRanking(
-  const RawProcessInfo & info, std::vector<std::unique_ptr<RawProcessInfo>> & tasks,
-  int64_t compare_value, int64_t (*get_value)(const RawProcessInfo &))
-{
-  using TaskIterator = std::vector<std::unique_ptr<RawProcessInfo>>::iterator;
-  std::reverse_iterator<TaskIterator> lowest(tasks.end());
-  std::reverse_iterator<TaskIterator> highest(tasks.begin());
-
-  std::size_t order = tasks.size();
-  for (std::reverse_iterator<TaskIterator> iter = lowest; iter != highest; iter++) {
-    if (get_value(**iter) < compare_value) {
-      order--;
-    } else {
-      break;
-    }
-  }
-  // No smaller value found
-  if (order >= tasks.size()) {
-    return;
-  }
-  // Shift elements after order to make space for insertion.
-  std::size_t dst_index = tasks.size() - 1;
-  for (std::reverse_iterator<TaskIterator> iter = lowest; iter != highest; iter++) {
-    if (dst_index == order) {
-      break;
-    }
-    **iter = **(iter + 1);
-    dst_index--;
-  }
-  *tasks[order] = info;
-}
-
 void invalidateRankingEntry(const std::unique_ptr<RawProcessInfo> & entry)
 {
   // Clear only the members used for comparison.
@@ -450,20 +352,23 @@ void ProcessMonitor::initialize()
 {
   using namespace std::literals::chrono_literals;
 
-  setRoot("/");
-  gethostname(hostname_, sizeof(hostname_));
-
-  updater_.setHardwareID(hostname_);
-  updater_.add("Tasks Summary", this, &ProcessMonitor::monitorProcesses);
-
   // As long as the number of processes is less than EXPECTED_NUM_PROCESSES,
-  // the size of the maps can be a compile-time constant.
+  // the size of the map can be a compile-time constant.
   // This is to avoid the cost of rehashing when the map is resized.
   // When the number of processes exceeds EXPECTED_NUM_PROCESSES,
   // the map will be resized, which is a costly operation.
   constexpr int32_t EXPECTED_NUM_PROCESSES = 1024;
-  pid_map1_.reserve(EXPECTED_NUM_PROCESSES);
-  pid_map2_.reserve(EXPECTED_NUM_PROCESSES);
+  scan_state_ = std::make_unique<ProcessScanState>();
+  scan_state_->processes.reserve(EXPECTED_NUM_PROCESSES);
+  scan_state_->generation = 0;
+  scan_state_->load_heap.reserve(getNumOfProcs());
+  scan_state_->memory_heap.reserve(getNumOfProcs());
+
+  setRoot("/");
+  gethostname(hostname_, sizeof(hostname_));
+
+  updater_.setHardwareID(hostname_);
+  updater_.add("Tasks Summary", this, &ProcessMonitor::monitorProcesses);
 
   work_ = std::make_unique<ProcessStatistics>();
   snapshot_ = std::make_unique<ProcessStatistics>();
@@ -517,6 +422,9 @@ void ProcessMonitor::setRoot(const std::string & root_path)
     new_root_path.append(1, '/');
   }
   root_path_ = new_root_path;
+  // /proc of the new root is opened at the next scan, where the processes of the previous root are
+  // cleared. They are kept until then, so that setting the same root again keeps the history.
+  scan_state_->proc_dir.reset();
   // /proc/meminfo is read only when setRoot() is called.
   // If it can't be read, /proc pseudo-filesystem may not be mounted.
   bool meminfo_error_occurred = !readMemInfo();
@@ -691,49 +599,52 @@ void ProcessMonitor::initializeProcessStatistics()
   work_->uptime_delta_sec = 0.0;
 }
 
-// Use comparison function to update Load, Memory
-void ProcessMonitor::updateHighLoadProcessRanking(const RawProcessInfo & info)
+void ProcessMonitor::updateProcessRankings(const RawProcessInfo & info, const uint32_t order)
 {
-  updateProcessRanking(info, work_->load_tasks_raw, info.diff_info.cpu_usage, getCpuUsage);
+  const std::size_t capacity = static_cast<std::size_t>(getNumOfProcs());
+  pushRankingCandidate(
+    scan_state_->load_heap, capacity, RankingCandidate{info.diff_info.cpu_usage, order, &info});
+  pushRankingCandidate(
+    scan_state_->memory_heap, capacity,
+    RankingCandidate{info.stat_memory_info.resident_page, order, &info});
 }
 
-void ProcessMonitor::updateHighMemoryProcessRanking(const RawProcessInfo & info)
+void ProcessMonitor::fillProcessRankings()
 {
-  updateProcessRanking(
-    info, work_->memory_tasks_raw, info.stat_memory_info.resident_page, getMemoryUsage);
+  const auto fill = [this](
+                      std::vector<RankingCandidate> & heap,
+                      std::vector<std::unique_ptr<RawProcessInfo>> & tasks) {
+    std::sort_heap(heap.begin(), heap.end(), isRankedHigher);
+    for (std::size_t index = 0; index < heap.size() && index < tasks.size(); ++index) {
+      RawProcessInfo & task = *tasks[index];
+      task = *heap[index].info;
+      // status is read only when a process appears, so refresh it for the ranked processes.
+      // Keep the previous one if the process has exited in the meantime.
+      const std::string proc_path = root_path_ + "proc/" + std::to_string(task.stat_info.pid) + "/";
+      readStatus(proc_path, task.status_info);
+    }
+    heap.clear();
+  };
+  fill(scan_state_->load_heap, work_->load_tasks_raw);
+  fill(scan_state_->memory_heap, work_->memory_tasks_raw);
 }
 
-void ProcessMonitor::registerProcessInfoToNewMap(const pid_t pid, const RawProcessInfo & info)
+bool ProcessMonitor::openProcDir()
 {
-  std::shared_ptr<RawProcessInfo> prev_info{nullptr};
-  try {
-    prev_info = prev_map_.at(pid);
-  } catch (...) {
-    ;
-  }
-  auto rtn = new_map_.emplace(pid, std::make_shared<RawProcessInfo>(info));
-  int64_t cpu_usage;
-  if (prev_info) {
-    cpu_usage =
-      static_cast<int64_t>(info.stat_info.utime_tick + info.stat_info.stime_tick) -
-      static_cast<int64_t>(prev_info->stat_info.utime_tick + prev_info->stat_info.stime_tick);
-  } else {
-    // Pid is a new process, which is not in prev_map_
-    cpu_usage = static_cast<int64_t>(info.stat_info.utime_tick + info.stat_info.stime_tick);
+  ProcessScanState & scan = *scan_state_;
+  if (scan.proc_dir) {
+    // Restart from the first entry instead of opening /proc again.
+    rewinddir(scan.proc_dir.get());
+    return true;
   }
-  if (cpu_usage < 0) {
-    cpu_usage = 0;
+  // The entries kept from the previous scans are of another /proc if the root has changed.
+  if (scan.root_path != root_path_) {
+    scan.processes.clear();
+    scan.root_path = root_path_;
   }
-  (rtn.first->second)->diff_info.cpu_usage = cpu_usage;
-}
-
-void ProcessMonitor::rotateProcessMaps()
-{
-  auto temp = prev_map_;
-  prev_map_ = new_map_;
-  // Data of PIDs that are referenced only in prev_map_ are deleted as they are no longer in use.
-  new_map_ = temp;
-  new_map_.clear();
+  const std::string proc_path = root_path_ + "proc";
+  scan.proc_dir.reset(opendir(proc_path.c_str()));
+  return static_cast<bool>(scan.proc_dir);
 }
 
 bool ProcessMonitor::readMemInfo()
@@ -789,59 +700,90 @@ bool ProcessMonitor::readMemInfo()
   return true;
 }
 
-void ProcessMonitor::collectProcessInfo(const char * pid_str)
+void ProcessMonitor::collectProcessInfo(const char * pid_str, const uint32_t order)
 {
-  RawProcessInfo info;
+  ProcessScanState & scan = *scan_state_;
 
-  std::string procPath(root_path_ + "proc/");
-  procPath += pid_str;
-  procPath += "/";
+  errno = 0;
+  const unsigned long pid_value = std::strtoul(pid_str, nullptr, 10);  // NOLINT(runtime/int)
+  if (errno != 0) {
+    return;
+  }
+  const pid_t pid = static_cast<pid_t>(pid_value);
 
-  // If any of the following functions returns false, the process is not a valid process.
-  if (!readStat(procPath, info.stat_info)) {
+  // Only stat and statm are read at every scan. The buffer is reused to avoid allocations.
+  // cspell:ignore statm
+  const int dir_fd = dirfd(scan.proc_dir.get());
+  const std::string pid_dir(pid_str);
+  StatInfo stat_info;
+  if (!readFileAt(dir_fd, (pid_dir + "/stat").c_str(), scan.buffer)) {
     return;
   }
-  if (!readStatMemory(procPath, info.stat_memory_info)) {
+  if (!parseStat(scan.buffer, stat_info)) {
     return;
   }
-  if (!readStatus(procPath, info.status_info)) {
+  StatMemoryInfo stat_memory_info;
+  if (!readFileAt(dir_fd, (pid_dir + "/statm").c_str(), scan.buffer)) {
     return;
   }
-
-  pid_t pid;
-  try {
-    pid = static_cast<pid_t>(std::stoul(pid_str));
-  } catch (...) {
+  if (!parseStatMemory(scan.buffer, stat_memory_info)) {
     return;
   }
+
+  bool known = false;
+  ProcessEntry & entry = findProcessEntry(scan, pid, stat_info.starttime_tick, known);
+  if (!known) {
+    // status of a new process is read once here, and then only while it is ranked.
+    std::string procPath(root_path_ + "proc/");
+    procPath += pid_dir;
+    procPath += "/";
+    if (!readStatus(procPath, entry.info.status_info)) {
+      return;  // The entry is removed at the end of the scan.
+    }
+  }
+
   // CPU usage calculation is not possible from static information in /proc.
   // Calculate the difference from the previous information.
-  registerProcessInfoToNewMap(pid, info);
+  const int64_t cpu_tick = static_cast<int64_t>(stat_info.utime_tick + stat_info.stime_tick);
+  int64_t cpu_usage = cpu_tick;
+  if (known) {
+    cpu_usage -= static_cast<int64_t>(
+      entry.info.stat_info.utime_tick + entry.info.stat_info.stime_tick);
+  }
+  if (cpu_usage < 0) {
+    cpu_usage = 0;
+  }
+  entry.info.stat_info = std::move(stat_info);
+  entry.info.stat_memory_info = stat_memory_info;
+  entry.info.diff_info.cpu_usage = cpu_usage;
+  entry.generation = scan.generation;
+
+  accumulateStateCount(entry.info);
+  updateProcessRankings(entry.info, order);
 }
 
 bool ProcessMonitor::scanProcFs()
 {
-  std::string proc_path = root_path_ + "proc";
-
   // NOTE:
   // opendir() and readdir() are not perfectly thread-safe.
   // There shouldn't be a problem as long as other threads are not accessing /proc.
   // See "man 3 readdir".
   // readdir_r() has been deprecated and can't be used.
-  DIR * raw_dirp = opendir(proc_path.c_str());
-
-  if (raw_dirp == nullptr) {
+  // /proc is kept open across scans, and rewound at each scan.
+  if (!openProcDir()) {
     return false;
   }
-  std::unique_ptr<DIR, std::function<void(DIR *)>> directory(
-    raw_dirp, [](DIR * dirp) { closedir(dirp); });
+  ProcessScanState & scan = *scan_state_;
+  ++scan.generation;
+  initializeProcessStatistics();
 
   // Scan all directory entries under /proc
   // Note that any entry may disappear after readdir() returns.
   // Read "man 3 readdir" about thread safety.
+  uint32_t order = 0;
   for (;;) {
     errno = 0;
-    const struct dirent * dir_entry = readdir(directory.get());
+    const struct dirent * dir_entry = readdir(scan.proc_dir.get());
     if (dir_entry == nullptr) {
       // If errno is 0, there is no more entry to read in the directory.
       // If errno is not 0, there is an error.
@@ -854,18 +796,19 @@ bool ProcessMonitor::scanProcFs()
     if (!isProcessID(dir_entry->d_name)) {
       continue;
     }
-    collectProcessInfo(dir_entry->d_name);
+    collectProcessInfo(dir_entry->d_name, order++);
+  }
+  // The rankings refer to the entries, so they are filled before removing the exited processes.
+  fillProcessRankings();
+
+  // Data of PIDs that are not found in this scan are deleted as they are no longer in use.
+  for (auto iter = scan.processes.begin(); iter != scan.processes.end();) {
+    if (iter->second.generation != scan.generation) {
+      iter = scan.processes.erase(iter);
+    } else {
+      ++iter;
+    }
   }
-  // Information about all valid processes is stored in new_map_
-  initializeProcessStatistics();
-  for (const auto & iter : new_map_) {
-    const RawProcessInfo & info = *(iter.second);
-    accumulateStateCount(info);
-    updateHighLoadProcessRanking(info);
-    updateHighMemoryProcessRanking(info);
-  }
-  rotateProcessMaps();
-  // /proc is closed automatically by the destructor of directory.
   return true;
 }
 
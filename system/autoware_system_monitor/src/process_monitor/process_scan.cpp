@@ -0,0 +1,126 @@
+// Copyright 2025 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file process_scan.cpp
+ * @brief Parsers of /proc files and rankings used by the incremental scanner of process monitor
+ */
+
+#include "system_monitor/process_monitor/process_scan.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <vector>
+
+bool extractChar(const char *& pos, char & value)
+{
+  const char * p = pos;
+  while (std::isspace(static_cast<unsigned char>(*p))) {
+    ++p;
+  }
+  if (*p == '\0') {
+    return false;
+  }
+  value = *p;
+  pos = p + 1;
+  return true;
+}
+
+bool parseStat(const std::string & buffer, StatInfo & info)
+{
+  // Only the first line is used.
+  const std::string line = buffer.substr(0, buffer.find('\n'));
+
+  StatInfo info_temp{};
+  const char * pos = line.c_str();
+  if (!extractNumber(pos, info_temp.pid)) {
+    return false;
+  }
+
+  // command may include spaces. Ex. (UVM deferred release queue)
+  // command may include multiple pairs of parentheses. Ex. ((XXX))
+  const std::size_t left_parenthesis_pos = line.find('(');
+  const std::size_t right_parenthesis_pos = line.find_last_of(')');
+  if ((left_parenthesis_pos == std::string::npos) || (right_parenthesis_pos == std::string::npos)) {
+    return false;
+  }
+
+  const std::size_t command_len =
+    right_parenthesis_pos - left_parenthesis_pos + 1;  // includes parentheses.
+  try {  // Handle exceptions from std::string::substr(). Just in case.
+    info_temp.command = line.substr(left_parenthesis_pos, command_len);
+  } catch (...) {
+    return false;
+  }
+
+  pos = line.c_str() + right_parenthesis_pos + 1;
+  if (
+    !extractChar(pos, info_temp.state) || !extractNumber(pos, info_temp.ppid) ||
+    !extractNumber(pos, info_temp.pgrp) || !extractNumber(pos, info_temp.session) ||
+    !extractNumber(pos, info_temp.tty_nr) || !extractNumber(pos, info_temp.tpgid) ||
+    !extractNumber(pos, info_temp.flags) || !extractNumber(pos, info_temp.min_flt) ||
+    !extractNumber(pos, info_temp.c_min_flt) || !extractNumber(pos, info_temp.maj_flt) ||
+    !extractNumber(pos, info_temp.c_maj_flt) || !extractNumber(pos, info_temp.utime_tick) ||
+    !extractNumber(pos, info_temp.stime_tick) || !extractNumber(pos, info_temp.c_utime_tick) ||
+    !extractNumber(pos, info_temp.c_stime_tick) || !extractNumber(pos, info_temp.priority) ||
+    !extractNumber(pos, info_temp.nice) || !extractNumber(pos, info_temp.num_threads) ||
+    !extractNumber(pos, info_temp.it_real_value) || !extractNumber(pos, info_temp.starttime_tick) ||
+    !extractNumber(pos, info_temp.vsize_byte) || !extractNumber(pos, info_temp.rss_page)) {
+    return false;  // Failed to read all values
+  }
+  info = info_temp;
+  return true;
+}
+
+bool parseStatMemory(const std::string & buffer, StatMemoryInfo & info)
+{
+  StatMemoryInfo info_temp{};
+  const char * pos = buffer.c_str();
+  if (
+    !extractNumber(pos, info_temp.size_page) || !extractNumber(pos, info_temp.resident_page) ||
+    !extractNumber(pos, info_temp.share_page)) {
+    return false;  // Failed to read all values
+  }
+  info = info_temp;
+  return true;
+}
+
+bool isRankedHigher(const RankingCandidate & lhs, const RankingCandidate & rhs)
+{
+  return (lhs.value > rhs.value) || (lhs.value == rhs.value && lhs.order < rhs.order);
+}
+
+void pushRankingCandidate(
+  std::vector<RankingCandidate> & heap, std::size_t capacity, const RankingCandidate & candidate)
+{
+  if (heap.size() < capacity) {
+    heap.push_back(candidate);
+    std::push_heap(heap.begin(), heap.end(), isRankedHigher);
+  } else if (capacity > 0 && isRankedHigher(candidate, heap.front())) {
+    std::pop_heap(heap.begin(), heap.end(), isRankedHigher);
+    heap.back() = candidate;
+    std::push_heap(heap.begin(), heap.end(), isRankedHigher);
+  }
+}
+
+ProcessEntry & findProcessEntry(
+  ProcessScanState & scan, const pid_t pid, const uint64_t starttime_tick, bool & known)
+{
+  // An entry which is left from the previous scan is the same process unless the pid is reused.
+  auto [iter, inserted] = scan.processes.try_emplace(pid);
+  ProcessEntry & entry = iter->second;
+  known = !inserted && (entry.info.stat_info.starttime_tick == starttime_tick);
+  return entry;
+}
@@ -0,0 +1,234 @@
+// Copyright 2025 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file system_sampler.cpp
+ * @brief Samplers reading /proc and sysfs directly, without executing external commands
+ */
+
+#include "system_monitor/system_sampler/system_sampler.hpp"
+
+#include <boost/algorithm/string.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/range.hpp>
+
+#include <cstdlib>
+#include <cstring>
+#include <regex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace fs = boost::filesystem;
+
+bool SysfsReader::read(const std::string & path, std::string & content)
+{
+  auto itr = files_.find(path);
+  if (itr == files_.end()) {
+    itr = files_.emplace(path, autoware::universe_utils::PersistentFile(path)).first;
+  }
+  if (!itr->second.read(content)) {
+    error_ = itr->second.getError();
+    return false;
+  }
+  return true;
+}
+
+std::vector<std::pair<std::string, CpuTimes>> parseProcStat(const std::string & content)
+{
+  std::vector<std::pair<std::string, CpuTimes>> cpus;
+
+  /*
+   Example of /proc/stat, the cpu lines come first
+   cpu  10132153 290696 3084719 46828483 16683 0 25195 0 0 0
+   cpu0 1393280 32966 572056 13343292 6130 0 17875 0 0 0
+   intr 1462898 ...
+   */
+  size_t begin = 0;
+  while (begin < content.size()) {
+    size_t end = content.find('\n', begin);
+    if (end == std::string::npos) {
+      end = content.size();
+    }
+    if (content.compare(begin, 3, "cpu") != 0) {
+      break;
+    }
+
+    const char * p = content.c_str() + begin + 3;
+    std::string name = "all";
+    if (*p != ' ') {
+      char * name_end = nullptr;
+      const auto index = std::strtoul(p, &name_end, 10);
+      name = std::to_string(index);
+      p = name_end;
+    }
+
+    CpuTimes times;
+    uint64_t * const fields[] = {&times.user,   &times.nice,  &times.system,  &times.idle,
+                                 &times.iowait, &times.irq,   &times.softirq, &times.steal,
+                                 &times.guest,  &times.guest_nice};
+    for (auto * field : fields) {
+      char * field_end = nullptr;
+      *field = std::strtoull(p, &field_end, 10);
+      // Older kernels do not have the last fields
+      if (field_end == p) {
+        break;
+      }
+      p = field_end;
+    }
+    cpus.emplace_back(std::move(name), times);
+    begin = end + 1;
+  }
+  return cpus;
+}
+
+CpuLoad calcCpuLoad(const std::string & name, const CpuTimes & prev, const CpuTimes & curr)
+{
+  // The counters may go backward when a core goes offline and online
+  const auto delta = [](const uint64_t p, const uint64_t c) {
+    return c > p ? static_cast<double>(c - p) : 0.0;
+  };
+
+  // guest time is included in user time, and guest_nice in nice, same as mpstat
+  const double user = delta(prev.user - prev.guest, curr.user - curr.guest);
+  const double nice = delta(prev.nice - prev.guest_nice, curr.nice - curr.guest_nice);
+  const double system = delta(prev.system, curr.system);
+  const double idle = delta(prev.idle, curr.idle);
+  const double iowait = delta(prev.iowait, curr.iowait);
+  const double irq = delta(prev.irq, curr.irq);
+  const double softirq = delta(prev.softirq, curr.softirq);
+  const double steal = delta(prev.steal, curr.steal);
+  const double guest = delta(prev.guest, curr.guest);
+  const double guest_nice = delta(prev.guest_nice, curr.guest_nice);
+  const double total =
+    user + nice + system + idle + iowait + irq + softirq + steal + guest + guest_nice;
+
+  CpuLoad load;
+  load.name = name;
+  if (total <= 0.0) {
+    load.idle = 100.0;
+    return load;
+  }
+  const auto percent = [total](const double value) {
+    return static_cast<float>(value / total * 100.0);
+  };
+  load.usr = percent(user);
+  load.nice = percent(nice);
+  load.sys = percent(system);
+  load.iowait = percent(iowait);
+  load.irq = percent(irq);
+  load.soft = percent(softirq);
+  load.steal = percent(steal);
+  load.guest = percent(guest);
+  load.gnice = percent(guest_nice);
+  load.idle = percent(idle);
+  return load;
+}
+
+CpuUsageSampler::CpuUsageSampler() : file_("/proc/stat")
+{
+  if (file_.read(content_)) {
+    for (auto & [name, times] : parseProcStat(content_)) {
+      prev_[name] = times;
+    }
+  }
+}
+
+bool CpuUsageSampler::update(std::vector<CpuLoad> & loads)
+{
+  loads.clear();
+  if (!file_.read(content_)) {
+    error_ = file_.getError();
+    return false;
+  }
+
+  const auto cpus = parseProcStat(content_);
+  if (cpus.empty()) {
+    error_ = "format error";
+    return false;
+  }
+
+  for (const auto & [name, times] : cpus) {
+    auto itr = prev_.find(name);
+    if (itr == prev_.end()) {
+      // A core which went online, its usage is calculated from the next sample
+      prev_.emplace(name, times);
+      loads.push_back(calcCpuLoad(name, times, times));
+      continue;
+    }
+    loads.push_back(calcCpuLoad(name, itr->second, times));
+    itr->second = times;
+  }
+  return true;
+}
+
+MemInfoSampler::MemInfoSampler() : file_("/proc/meminfo")
+{
+}
+
+bool MemInfoSampler::update(autoware::universe_utils::MemInfo & mem_info)
+{
+  if (!file_.read(content_)) {
+    error_ = file_.getError();
+    return false;
+  }
+  if (!autoware::universe_utils::parseMemInfo(content_, mem_info)) {
+    error_ = "format error";
+    return false;
+  }
+  return true;
+}
+
+std::string findHwmonVoltageInput(const std::string & label)
+{
+  const std::string target = boost::algorithm::trim_right_copy_if(label, boost::is_any_of(":"));
+  if (target.empty()) {
+    return "";
+  }
+
+  const fs::path root("/sys/class/hwmon");
+  if (!fs::exists(root)) {
+    return "";
+  }
+
+  const std::regex input_regex(R"(in\d+_input)");
+  for (const fs::path & hwmon :
+       boost::make_iterator_range(fs::directory_iterator(root), fs::directory_iterator())) {
+    // The attributes are in the hwmon directory or in its device directory with older drivers
+    for (const fs::path & dir : {hwmon, hwmon / "device"}) {
+      if (!fs::is_directory(dir)) {
+        continue;
+      }
+      for (const fs::path & path :
+           boost::make_iterator_range(fs::directory_iterator(dir), fs::directory_iterator())) {
+        const std::string filename = path.filename().generic_string();
+        if (!std::regex_match(filename, input_regex)) {
+          continue;
+        }
+        // in7_input -> in7
+        const std::string channel = filename.substr(0, filename.size() - std::strlen("_input"));
+        if (channel == target) {
+          return path.generic_string();
+        }
+
+        fs::ifstream ifs(dir / (channel + "_label"), std::ios::in);
+        std::string channel_label;
+        if (ifs && std::getline(ifs, channel_label) && boost::trim_copy(channel_label) == target) {
+          return path.generic_string();
+        }
+      }
+    }
+  }
+  return "";
+}
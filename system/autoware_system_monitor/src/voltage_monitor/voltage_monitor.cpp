@@ -19,28 +19,17 @@
 
 #include "system_monitor/voltage_monitor/voltage_monitor.hpp"
 
-#include "system_monitor/msr_reader/msr_reader.hpp"
 #include "system_monitor/system_monitor_utility.hpp"
 
-#include <boost/algorithm/string.hpp>
-#include <boost/archive/text_iarchive.hpp>
-#include <boost/filesystem.hpp>
-#include <boost/process.hpp>
-
 #include <fmt/format.h>
-#include <netinet/in.h>
-#include <sys/socket.h>
 
-#include <algorithm>
-#include <regex>
+#include <cstdlib>
+#include <memory>
+#include <sstream>
 #include <string>
-#include <utility>
-#include <vector>
-
-namespace bp = boost::process;
 
 VoltageMonitor::VoltageMonitor(const rclcpp::NodeOptions & options)
-: Node("voltage_monitor", options), updater_(this), hostname_()
+: Node("voltage_monitor", options), updater_(this), hostname_(), rtc_file_("/proc/driver/rtc")
 {
   gethostname(hostname_, sizeof(hostname_));
 
@@ -52,26 +41,18 @@ VoltageMonitor::VoltageMonitor(const rclcpp::NodeOptions & options)
   voltage_string_ = declare_parameter<std::string>("cmos_battery_label", "");
   voltage_warn_ = declare_parameter<float>("cmos_battery_warn", 2.95);
   voltage_error_ = declare_parameter<float>("cmos_battery_error", 2.75);
-  bool sensors_exists = false;
-  if (voltage_string_ == "") {
-    sensors_exists = false;
-  } else {
-    // Check if command exists
-    fs::path p = bp::search_path("sensors");
-    sensors_exists = (p.empty()) ? false : true;
-  }
-  gethostname(hostname_, sizeof(hostname_));
   auto callback = &VoltageMonitor::checkBatteryStatus;
-  if (sensors_exists) {
-    try {
-      std::regex re(R"((\d+).(\d+))");
-      voltage_regex_ = re;
-    } catch (std::regex_error & e) {
-      // never comes here.
-      RCLCPP_WARN(get_logger(), "std::regex_error %d", e.code());
-      return;
+  if (voltage_string_ != "") {
+    // Look up the hwmon channel once, then only its input file is read at each check
+    const std::string voltage_path = findHwmonVoltageInput(voltage_string_);
+    if (voltage_path.empty()) {
+      RCLCPP_WARN(
+        get_logger(), "voltage input of '%s' not found in /sys/class/hwmon",
+        voltage_string_.c_str());
+    } else {
+      voltage_file_ = std::make_unique<autoware::universe_utils::PersistentFile>(voltage_path);
+      callback = &VoltageMonitor::checkVoltage;
     }
-    callback = &VoltageMonitor::checkVoltage;
   }
   updater_.add("CMOS Battery Status", this, callback);
 }
@@ -80,53 +61,15 @@ void VoltageMonitor::checkVoltage(diagnostic_updater::DiagnosticStatusWrapper &
 {
   // Remember start time to measure elapsed time
   const auto t_start = SystemMonitorUtility::startMeasurement();
-  float voltage = 0.0;
-
-  int out_fd[2];
-  if (RCUTILS_UNLIKELY(pipe2(out_fd, O_CLOEXEC) != 0)) {
-    stat.summary(DiagStatus::ERROR, "pipe2 error");
-    stat.add("pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe out_pipe{out_fd[0], out_fd[1]};
-  bp::ipstream is_out{std::move(out_pipe)};
 
-  int err_fd[2];
-  if (RCUTILS_UNLIKELY(pipe2(err_fd, O_CLOEXEC) != 0)) {
-    stat.summary(DiagStatus::ERROR, "pipe2 error");
-    stat.add("pipe2", strerror(errno));
+  // The input of hwmon is in millivolts
+  if (RCUTILS_UNLIKELY(!voltage_file_->read(content_) || content_.empty())) {
+    stat.summary(DiagStatus::ERROR, "hwmon error");
+    stat.add(voltage_file_->getPath(), voltage_file_->getError());
     return;
   }
-  bp::pipe err_pipe{err_fd[0], err_fd[1]};
-  bp::ipstream is_err{std::move(err_pipe)};
-
-  bp::child c("sensors", bp::std_out > is_out, bp::std_err > is_err);
-  c.wait();
+  const float voltage = std::strtof(content_.c_str(), nullptr) / 1000.0f;
 
-  if (RCUTILS_UNLIKELY(c.exit_code() != 0)) {  // failed to execute sensors
-    std::ostringstream os;
-    is_err >> os.rdbuf();
-    stat.summary(DiagStatus::ERROR, "sensors error");
-    stat.add("sensors", os.str().c_str());
-    return;
-  }
-  std::string line;
-  while (std::getline(is_out, line)) {
-    auto voltageStringPos = line.find(voltage_string_.c_str());
-    if (voltageStringPos != std::string::npos) {
-      try {
-        std::smatch match;
-        std::regex_search(line, match, voltage_regex_);
-        auto voltageString = match.str();
-        voltage = std::stof(voltageString);
-      } catch (std::regex_error & e) {
-        stat.summary(DiagStatus::WARN, "format error");
-        stat.add("exception in std::regex_search ", fmt::format("{}", e.code()));
-        return;
-      }
-      break;
-    }
-  }
   stat.add("CMOS battery voltage", fmt::format("{}", voltage));
   if (voltage < voltage_error_) {
     stat.summary(DiagStatus::WARN, "Battery Died");
@@ -146,35 +89,13 @@ void VoltageMonitor::checkBatteryStatus(diagnostic_updater::DiagnosticStatusWrap
   const auto t_start = SystemMonitorUtility::startMeasurement();
 
   // Get status of RTC
-  int out_fd[2];
-  if (RCUTILS_UNLIKELY(pipe2(out_fd, O_CLOEXEC) != 0)) {
-    stat.summary(DiagStatus::ERROR, "pipe2 error");
-    stat.add("pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe out_pipe{out_fd[0], out_fd[1]};
-  bp::ipstream is_out{std::move(out_pipe)};
-
-  int err_fd[2];
-  if (RCUTILS_UNLIKELY(pipe2(err_fd, O_CLOEXEC) != 0)) {
-    stat.summary(DiagStatus::ERROR, "pipe2 error");
-    stat.add("pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe err_pipe{err_fd[0], err_fd[1]};
-  bp::ipstream is_err{std::move(err_pipe)};
-
-  bp::child c("cat /proc/driver/rtc", bp::std_out > is_out, bp::std_err > is_err);
-  c.wait();
-
-  if (RCUTILS_UNLIKELY(c.exit_code() != 0)) {
-    std::ostringstream os;
-    is_err >> os.rdbuf();
+  if (RCUTILS_UNLIKELY(!rtc_file_.read(content_))) {
     stat.summary(DiagStatus::ERROR, "rtc error");
-    stat.add("rtc", os.str().c_str());
+    stat.add("rtc", rtc_file_.getError());
     return;
   }
 
+  std::istringstream is_out(content_);
   std::string line;
   bool status = false;
   while (std::getline(is_out, line)) {
@@ -0,0 +1,216 @@
+// Copyright 2025 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "system_monitor/process_monitor/process_scan.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Fields after the command: state, ppid, ..., starttime, vsize and rss.
+constexpr char STAT_FIELDS[] =
+  "S 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 -5 17 18 19 20 21 22 23 24\n";
+
+template <typename T>
+bool extractAll(const std::string & text, T & value)
+{
+  const char * pos = text.c_str();
+  return extractNumber(pos, value) && (*pos == '\0');
+}
+}  // namespace
+
+TEST(ProcessScanTest, ExtractNumber)
+{
+  int32_t value = 0;
+  const std::string text = "  42 -7 +3";
+  const char * pos = text.c_str();
+  ASSERT_TRUE(extractNumber(pos, value));
+  EXPECT_EQ(value, 42);
+  ASSERT_TRUE(extractNumber(pos, value));
+  EXPECT_EQ(value, -7);
+  ASSERT_TRUE(extractNumber(pos, value));
+  EXPECT_EQ(value, 3);
+  EXPECT_EQ(*pos, '\0');
+  EXPECT_FALSE(extractNumber(pos, value));
+}
+
+TEST(ProcessScanTest, ExtractNumberMalformed)
+{
+  int64_t value = 99;
+  for (const std::string text : {"", "   ", "x1", "-", "+ 1", "--1"}) {
+    const char * pos = text.c_str();
+    EXPECT_FALSE(extractNumber(pos, value)) << "\"" << text << "\"";
+    EXPECT_EQ(pos, text.c_str()) << "\"" << text << "\"";
+  }
+  EXPECT_EQ(value, 99);
+
+  // The extraction stops at the first non-digit character as istream does.
+  const std::string text = "12ab";
+  const char * pos = text.c_str();
+  ASSERT_TRUE(extractNumber(pos, value));
+  EXPECT_EQ(value, 12);
+  EXPECT_EQ(std::string(pos), "ab");
+}
+
+TEST(ProcessScanTest, ExtractNumberOverflow)
+{
+  int32_t value32 = 0;
+  EXPECT_TRUE(extractAll("2147483647", value32));
+  EXPECT_EQ(value32, std::numeric_limits<int32_t>::max());
+  EXPECT_TRUE(extractAll("-2147483648", value32));
+  EXPECT_EQ(value32, std::numeric_limits<int32_t>::min());
+  EXPECT_FALSE(extractAll("2147483648", value32));
+  EXPECT_FALSE(extractAll("-2147483649", value32));
+  EXPECT_FALSE(extractAll("99999999999999999999999", value32));
+  EXPECT_EQ(value32, std::numeric_limits<int32_t>::min());
+
+  uint64_t value64 = 0;
+  EXPECT_TRUE(extractAll("18446744073709551615", value64));
+  EXPECT_EQ(value64, std::numeric_limits<uint64_t>::max());
+  EXPECT_FALSE(extractAll("18446744073709551616", value64));
+  EXPECT_FALSE(extractAll("184467440737095516150", value64));
+  EXPECT_EQ(value64, std::numeric_limits<uint64_t>::max());
+
+  // A negative value of an unsigned type wraps around as istream does.
+  EXPECT_TRUE(extractAll("-1", value64));
+  EXPECT_EQ(value64, std::numeric_limits<uint64_t>::max());
+
+  // The position is not moved on overflow.
+  const std::string text = "1 99999999999 3";
+  const char * pos = text.c_str();
+  ASSERT_TRUE(extractNumber(pos, value32));
+  const char * overflow_pos = pos;
+  EXPECT_FALSE(extractNumber(pos, value32));
+  EXPECT_EQ(pos, overflow_pos);
+}
+
+TEST(ProcessScanTest, ParseStat)
+{
+  StatInfo info{};
+  ASSERT_TRUE(parseStat(std::string("1234 ((UVM deferred) queue) ") + STAT_FIELDS, info));
+  EXPECT_EQ(info.pid, 1234);
+  EXPECT_EQ(info.command, "((UVM deferred) queue)");
+  EXPECT_EQ(info.state, 'S');
+  EXPECT_EQ(info.ppid, 1);
+  EXPECT_EQ(info.utime_tick, 11u);
+  EXPECT_EQ(info.stime_tick, 12u);
+  EXPECT_EQ(info.nice, -5);
+  EXPECT_EQ(info.starttime_tick, 19u);
+  EXPECT_EQ(info.vsize_byte, 20u);
+  EXPECT_EQ(info.rss_page, 21);
+
+  // Only the first line is used.
+  ASSERT_TRUE(parseStat(std::string("1 (a) ") + STAT_FIELDS + "2 (b) R", info));
+  EXPECT_EQ(info.pid, 1);
+  EXPECT_EQ(info.command, "(a)");
+}
+
+TEST(ProcessScanTest, ParseStatMalformed)
+{
+  StatInfo info{};
+  info.pid = 99;
+  const std::string line = std::string("1234 (cmd) ") + STAT_FIELDS;
+  const std::vector<std::string> malformed_lines = {
+    "",
+    "(cmd) S 1",
+    "1234 cmd S 1 2 3",
+    "1234 (cmd S 1 2 3",
+    "1234 (cmd) S 1 x 3 4 5 6 7 8 9 10 11 12 13 14 15 -5 17 18 19 20 21",
+    "1234 (cmd) S 1 2 3 4 5 6 7 8 9 10 99999999999999999999999 12 13 14 15 -5 17 18 19 20 21",
+    "1234 (cmd) S 99999999999 2 3 4 5 6 7 8 9 10 11 12 13 14 15 -5 17 18 19 20 21",
+  };
+  for (const auto & malformed_line : malformed_lines) {
+    EXPECT_FALSE(parseStat(malformed_line, info)) << malformed_line;
+  }
+  // Every truncation before rss, the last field used, fails.
+  const std::size_t rss_pos = line.find(" 21 ") + 1;
+  for (std::size_t length = 0; length <= rss_pos; ++length) {
+    EXPECT_FALSE(parseStat(line.substr(0, length), info)) << line.substr(0, length);
+  }
+  // The output is not modified on failure.
+  EXPECT_EQ(info.pid, 99);
+}
+
+TEST(ProcessScanTest, ParseStatMemory)
+{
+  StatMemoryInfo info{};
+  ASSERT_TRUE(parseStatMemory("100 20 3 4 0 5 0\n", info));
+  EXPECT_EQ(info.size_page, 100);
+  EXPECT_EQ(info.resident_page, 20);
+  EXPECT_EQ(info.share_page, 3);
+
+  for (const std::string malformed : {"", "100 20", "100 x 3", "100 20 99999999999999999999"}) {
+    EXPECT_FALSE(parseStatMemory(malformed, info)) << malformed;
+  }
+  EXPECT_EQ(info.size_page, 100);
+}
+
+TEST(ProcessScanTest, RankingTieOrder)
+{
+  std::vector<RankingCandidate> heap;
+  constexpr std::size_t capacity = 3;
+  const std::vector<int64_t> values = {5, 5, 7, 5, 1, 7, 5};
+  for (uint32_t order = 0; order < values.size(); ++order) {
+    pushRankingCandidate(heap, capacity, RankingCandidate{values.at(order), order, nullptr});
+  }
+  ASSERT_EQ(heap.size(), capacity);
+  std::sort_heap(heap.begin(), heap.end(), isRankedHigher);
+
+  // The higher value first, and the earlier process in the scan for a tie.
+  EXPECT_EQ(heap.at(0).value, 7);
+  EXPECT_EQ(heap.at(0).order, 2u);
+  EXPECT_EQ(heap.at(1).value, 7);
+  EXPECT_EQ(heap.at(1).order, 5u);
+  EXPECT_EQ(heap.at(2).value, 5);
+  EXPECT_EQ(heap.at(2).order, 0u);
+}
+
+TEST(ProcessScanTest, RankingWithoutCapacity)
+{
+  std::vector<RankingCandidate> heap;
+  pushRankingCandidate(heap, 0, RankingCandidate{1, 0, nullptr});
+  EXPECT_TRUE(heap.empty());
+}
+
+TEST(ProcessScanTest, FindProcessEntry)
+{
+  ProcessScanState scan;
+  bool known = true;
+  ProcessEntry & entry = findProcessEntry(scan, 100, 5000, known);
+  EXPECT_FALSE(known);
+  entry.info.stat_info.starttime_tick = 5000;
+  entry.info.stat_info.utime_tick = 30;
+
+  // The same process in the next scan.
+  ProcessEntry & same_entry = findProcessEntry(scan, 100, 5000, known);
+  EXPECT_TRUE(known);
+  EXPECT_EQ(&same_entry, &entry);
+  EXPECT_EQ(same_entry.info.stat_info.utime_tick, 30u);
+
+  // Another process.
+  findProcessEntry(scan, 101, 5000, known);
+  EXPECT_FALSE(known);
+
+  // The pid is reused by a process which started later.
+  ProcessEntry & reused_entry = findProcessEntry(scan, 100, 6000, known);
+  EXPECT_FALSE(known);
+  EXPECT_EQ(&reused_entry, &entry);
+  EXPECT_EQ(scan.processes.size(), 2u);
+}
@@ -0,0 +1,100 @@
+// Copyright 2025 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "system_monitor/system_sampler/system_sampler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+TEST(SystemSamplerTest, ParseProcStat)
+{
+  const std::string content =
+    "cpu  100 10 50 800 20 0 5 0 30 2\n"
+    "cpu0 60 5 30 400 10 0 3 0 20 1\n"
+    "cpu1 40 5 20 400 10 0 2 0 10 1\n"
+    "intr 1462898 9 0 0\n"
+    "ctxt 2923490\n";
+
+  const auto cpus = parseProcStat(content);
+  ASSERT_EQ(cpus.size(), 3u);
+  EXPECT_EQ(cpus.at(0).first, "all");
+  EXPECT_EQ(cpus.at(1).first, "0");
+  EXPECT_EQ(cpus.at(2).first, "1");
+  EXPECT_EQ(cpus.at(0).second.user, 100u);
+  EXPECT_EQ(cpus.at(0).second.idle, 800u);
+  EXPECT_EQ(cpus.at(0).second.guest_nice, 2u);
+  EXPECT_EQ(cpus.at(2).second.system, 20u);
+}
+
+TEST(SystemSamplerTest, ParseProcStatOfOlderKernel)
+{
+  // Kernels older than 2.6.33 do not have guest_nice
+  const auto cpus = parseProcStat("cpu  100 10 50 800 20 0 5 0 30\n");
+  ASSERT_EQ(cpus.size(), 1u);
+  EXPECT_EQ(cpus.at(0).second.guest, 30u);
+  EXPECT_EQ(cpus.at(0).second.guest_nice, 0u);
+}
+
+TEST(SystemSamplerTest, CalcCpuLoad)
+{
+  CpuTimes prev;
+  prev.user = 100;
+  prev.nice = 10;
+  prev.system = 50;
+  prev.idle = 800;
+  prev.guest = 20;
+
+  // 200 ticks elapsed: 40 user including 10 guest, 20 system, 10 iowait, 130 idle
+  CpuTimes curr = prev;
+  curr.user += 40;
+  curr.guest += 10;
+  curr.system += 20;
+  curr.iowait += 10;
+  curr.idle += 130;
+
+  const auto load = calcCpuLoad("0", prev, curr);
+  EXPECT_EQ(load.name, "0");
+  EXPECT_NEAR(load.usr, 15.0, 1e-4);
+  EXPECT_NEAR(load.guest, 5.0, 1e-4);
+  EXPECT_NEAR(load.sys, 10.0, 1e-4);
+  EXPECT_NEAR(load.iowait, 5.0, 1e-4);
+  EXPECT_NEAR(load.idle, 65.0, 1e-4);
+  EXPECT_NEAR(load.nice, 0.0, 1e-4);
+}
+
+TEST(SystemSamplerTest, CalcCpuLoadWithoutElapsedTime)
+{
+  CpuTimes times;
+  times.user = 100;
+  times.idle = 800;
+
+  const auto load = calcCpuLoad("all", times, times);
+  EXPECT_FLOAT_EQ(load.idle, 100.0);
+  EXPECT_FLOAT_EQ(load.usr, 0.0);
+}
+
+TEST(SystemSamplerTest, CpuUsageSampler)
+{
+  CpuUsageSampler sampler;
+  std::vector<CpuLoad> loads;
+  ASSERT_TRUE(sampler.update(loads));
+  ASSERT_FALSE(loads.empty());
+  EXPECT_EQ(loads.front().name, "all");
+  for (const auto & load : loads) {
+    EXPECT_GE(load.idle, 0.0);
+    EXPECT_LE(load.idle, 100.0);
+  }
+}
@@ -0,0 +1,79 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__TOPIC_STATE_MONITOR__MULTI_TOPIC_STATE_MONITOR_CORE_HPP_
+#define AUTOWARE__TOPIC_STATE_MONITOR__MULTI_TOPIC_STATE_MONITOR_CORE_HPP_
+
+#include "autoware/topic_state_monitor/topic_state_monitor.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
+#include <tf2_msgs/msg/tf_message.hpp>
+
+#include <string>
+#include <vector>
+
+namespace autoware::topic_state_monitor
+{
+struct TopicParam
+{
+  std::string diag_name;
+  std::string topic;
+  std::string topic_type;
+  std::string frame_id;
+  std::string child_frame_id;
+  bool transient_local;
+  bool best_effort;
+  bool is_transform;
+};
+
+// Monitors many topics in one node. The state of the topics is kept in flat arrays indexed in the
+// order of the topics parameter, and the diagnostics of all topics are published in one array.
+class MultiTopicStateMonitorNode : public rclcpp::Node
+{
+public:
+  explicit MultiTopicStateMonitorNode(const rclcpp::NodeOptions & node_options);
+
+private:
+  using DiagnosticArray = diagnostic_msgs::msg::DiagnosticArray;
+  using DiagnosticStatus = diagnostic_msgs::msg::DiagnosticStatus;
+
+  // Parameter
+  double update_rate_;
+  std::vector<TopicParam> topic_params_;
+  std::vector<Param> params_;
+
+  // Core
+  std::vector<TopicStateMonitor> topic_state_monitors_;
+  std::vector<TopicStatus> prev_topic_statuses_;
+
+  // Subscriber
+  void createSubscriptions();
+  std::vector<rclcpp::GenericSubscription::SharedPtr> sub_topics_;
+  std::vector<rclcpp::Subscription<tf2_msgs::msg::TFMessage>::SharedPtr> sub_transforms_;
+
+  // Timer
+  void onTimer();
+  rclcpp::TimerBase::SharedPtr timer_;
+
+  // Diagnostics
+  rclcpp::Publisher<DiagnosticArray>::SharedPtr pub_diagnostics_;
+  DiagnosticArray diagnostics_;
+
+  void checkTopicStatus(size_t index, const rclcpp::Time & now, DiagnosticStatus & status);
+};
+}  // namespace autoware::topic_state_monitor
+
+#endif  // AUTOWARE__TOPIC_STATE_MONITOR__MULTI_TOPIC_STATE_MONITOR_CORE_HPP_
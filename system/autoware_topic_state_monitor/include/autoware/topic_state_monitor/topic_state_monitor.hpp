@@ -17,8 +17,8 @@
 
 #include <rclcpp/rclcpp.hpp>
 
-#include <deque>
 #include <string>
+#include <vector>
 
 namespace autoware::topic_state_monitor
 {
@@ -42,31 +42,39 @@ class TopicStateMonitor
 {
 public:
   explicit TopicStateMonitor(rclcpp::Node & node);
+  explicit TopicStateMonitor(const rclcpp::Clock::SharedPtr & clock);
 
-  void setParam(const Param & param) { param_ = param; }
+  void setParam(const Param & param);
 
   rclcpp::Time getLastMessageTime() const { return last_message_time_; }
   double getTopicRate() const { return topic_rate_; }
 
   void update();
+  void update(const rclcpp::Time & stamp);
   TopicStatus getTopicStatus() const;
+  TopicStatus getTopicStatus(const rclcpp::Time & now) const;
 
 private:
   Param param_;
 
   static constexpr double max_rate = 100000.0;
 
-  std::deque<rclcpp::Time> time_buffer_;
+  // Ring buffer of the last window_size message times
+  std::vector<rclcpp::Time> time_buffer_ = std::vector<rclcpp::Time>(1);
+  size_t time_buffer_head_ = 0;
+  size_t time_buffer_size_ = 0;
   rclcpp::Time last_message_time_ = rclcpp::Time(0);
   double topic_rate_ = TopicStateMonitor::max_rate;
 
   rclcpp::Clock::SharedPtr clock_;
 
+  const rclcpp::Time & oldestTime() const;
+  const rclcpp::Time & latestTime() const;
   double calcTopicRate() const;
   bool isNotReceived() const;
   bool isWarnRate() const;
   bool isErrorRate() const;
-  bool isTimeout() const;
+  bool isTimeout(const rclcpp::Time & now) const;
 };
 }  // namespace autoware::topic_state_monitor
 
@@ -0,0 +1,267 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/topic_state_monitor/multi_topic_state_monitor_core.hpp"
+
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+// Keys of the diagnostic values in the order of DiagnosticStatus::values
+enum ValueIndex : size_t {
+  Topic,
+  Status,
+  WarnRate,
+  ErrorRate,
+  Timeout,
+  MeasuredRate,
+  Now,
+  LastMessageTime,
+  NumValues,
+};
+
+void format_value(std::string & value, const char * format, double number)
+{
+  char buffer[64];
+  std::snprintf(buffer, sizeof(buffer), format, number);
+  value = buffer;
+}
+
+const char * to_string(autoware::topic_state_monitor::TopicStatus topic_status)
+{
+  using autoware::topic_state_monitor::TopicStatus;
+  switch (topic_status) {
+    case TopicStatus::Ok:
+      return "OK";
+    case TopicStatus::NotReceived:
+      return "NotReceived";
+    case TopicStatus::WarnRate:
+      return "WarnRate";
+    case TopicStatus::ErrorRate:
+      return "ErrorRate";
+    case TopicStatus::Timeout:
+      return "Timeout";
+  }
+  return "";
+}
+}  // namespace
+
+namespace autoware::topic_state_monitor
+{
+MultiTopicStateMonitorNode::MultiTopicStateMonitorNode(const rclcpp::NodeOptions & node_options)
+: Node("multi_topic_state_monitor", node_options)
+{
+  // Parameter
+  update_rate_ = declare_parameter("update_rate", 10.0);
+  const auto names = declare_parameter<std::vector<std::string>>("topics");
+  for (const auto & name : names) {
+    const auto prefix = name + ".";
+    TopicParam topic_param;
+    topic_param.topic = declare_parameter<std::string>(prefix + "topic");
+    topic_param.transient_local = declare_parameter(prefix + "transient_local", false);
+    topic_param.best_effort = declare_parameter(prefix + "best_effort", false);
+    topic_param.diag_name = declare_parameter<std::string>(prefix + "diag_name");
+    topic_param.is_transform = (topic_param.topic == "/tf" || topic_param.topic == "/tf_static");
+
+    if (topic_param.is_transform) {
+      topic_param.frame_id = declare_parameter<std::string>(prefix + "frame_id");
+      topic_param.child_frame_id = declare_parameter<std::string>(prefix + "child_frame_id");
+    } else {
+      topic_param.topic_type = declare_parameter<std::string>(prefix + "topic_type");
+    }
+
+    Param param;
+    param.warn_rate = declare_parameter(prefix + "warn_rate", 0.5);
+    param.error_rate = declare_parameter(prefix + "error_rate", 0.1);
+    param.timeout = declare_parameter(prefix + "timeout", 1.0);
+    param.window_size = declare_parameter(prefix + "window_size", 10);
+
+    topic_params_.push_back(topic_param);
+    params_.push_back(param);
+  }
+
+  // Core
+  for (const auto & param : params_) {
+    topic_state_monitors_.emplace_back(get_clock()).setParam(param);
+  }
+  prev_topic_statuses_.resize(topic_params_.size(), TopicStatus::Ok);
+
+  // Subscriber
+  createSubscriptions();
+
+  // Diagnostics, the names and the keys are set once and only the values are rewritten.
+  pub_diagnostics_ = create_publisher<DiagnosticArray>("/diagnostics", rclcpp::QoS(1));
+  diagnostics_.status.resize(topic_params_.size());
+  for (size_t i = 0; i < topic_params_.size(); ++i) {
+    auto & status = diagnostics_.status[i];
+    status.name = topic_params_[i].diag_name;
+    status.hardware_id = "topic_state_monitor";
+    status.values.resize(ValueIndex::NumValues);
+    status.values[ValueIndex::Topic].key = "topic";
+    status.values[ValueIndex::Status].key = "status";
+    status.values[ValueIndex::WarnRate].key = "warn_rate";
+    status.values[ValueIndex::ErrorRate].key = "error_rate";
+    status.values[ValueIndex::Timeout].key = "timeout";
+    status.values[ValueIndex::MeasuredRate].key = "measured_rate";
+    status.values[ValueIndex::Now].key = "now";
+    status.values[ValueIndex::LastMessageTime].key = "last_message_time";
+  }
+
+  // Timer
+  const auto period_ns = rclcpp::Rate(update_rate_).period();
+  timer_ = rclcpp::create_timer(
+    this, get_clock(), period_ns, std::bind(&MultiTopicStateMonitorNode::onTimer, this));
+}
+
+void MultiTopicStateMonitorNode::createSubscriptions()
+{
+  // Topics with the same name and QoS share one subscription.
+  using SubscriptionKey = std::tuple<std::string, std::string, bool, bool>;
+  std::map<SubscriptionKey, std::vector<size_t>> topic_groups;
+  std::map<SubscriptionKey, std::vector<size_t>> transform_groups;
+  for (size_t i = 0; i < topic_params_.size(); ++i) {
+    const auto & param = topic_params_[i];
+    const auto key =
+      SubscriptionKey{param.topic, param.topic_type, param.transient_local, param.best_effort};
+    (param.is_transform ? transform_groups : topic_groups)[key].push_back(i);
+  }
+
+  for (const auto & [key, indices] : topic_groups) {
+    const auto & [topic, topic_type, transient_local, best_effort] = key;
+    rclcpp::QoS qos = rclcpp::QoS{1};
+    if (transient_local) {
+      qos.transient_local();
+    }
+    if (best_effort) {
+      qos.best_effort();
+    }
+    sub_topics_.push_back(create_generic_subscription(
+      topic, topic_type, qos,
+      [this, indices = indices]([[maybe_unused]] std::shared_ptr<rclcpp::SerializedMessage> msg) {
+        const auto stamp = now();
+        for (const auto index : indices) {
+          topic_state_monitors_[index].update(stamp);
+        }
+      }));
+  }
+
+  for (const auto & [key, indices] : transform_groups) {
+    const auto & [topic, topic_type, transient_local, best_effort] = key;
+    rclcpp::QoS qos = rclcpp::QoS{1};
+    if (transient_local) {
+      qos.transient_local();
+    }
+    if (best_effort) {
+      qos.best_effort();
+    }
+    sub_transforms_.push_back(create_subscription<tf2_msgs::msg::TFMessage>(
+      topic, qos, [this, indices = indices](tf2_msgs::msg::TFMessage::ConstSharedPtr msg) {
+        const auto stamp = now();
+        for (const auto & transform : msg->transforms) {
+          for (const auto index : indices) {
+            const auto & param = topic_params_[index];
+            if (
+              transform.header.frame_id == param.frame_id &&
+              transform.child_frame_id == param.child_frame_id) {
+              topic_state_monitors_[index].update(stamp);
+            }
+          }
+        }
+      }));
+  }
+}
+
+void MultiTopicStateMonitorNode::onTimer()
+{
+  // Publish diagnostics of all topics at once
+  const auto stamp = now();
+  diagnostics_.header.stamp = stamp;
+  for (size_t i = 0; i < topic_params_.size(); ++i) {
+    checkTopicStatus(i, stamp, diagnostics_.status[i]);
+  }
+  pub_diagnostics_->publish(diagnostics_);
+}
+
+void MultiTopicStateMonitorNode::checkTopicStatus(
+  size_t index, const rclcpp::Time & now, DiagnosticStatus & status)
+{
+  const auto & topic_param = topic_params_[index];
+  const auto & param = params_[index];
+  const auto & topic_state_monitor = topic_state_monitors_[index];
+
+  // Get information
+  const auto topic_status = topic_state_monitor.getTopicStatus(now);
+  const auto last_message_time = topic_state_monitor.getLastMessageTime();
+  const auto topic_rate = topic_state_monitor.getTopicRate();
+
+  // Add topic name
+  auto & values = status.values;
+  if (topic_param.is_transform) {
+    values[ValueIndex::Topic].value = topic_param.topic + " (" + topic_param.frame_id + " to " +
+                                      topic_param.child_frame_id + ")";
+  } else {
+    values[ValueIndex::Topic].value = topic_param.topic;
+  }
+
+  // Judge level
+  if (topic_status == TopicStatus::Ok) {
+    status.level = DiagnosticStatus::OK;
+    status.message = "OK";
+  } else if (topic_status == TopicStatus::WarnRate) {
+    status.level = DiagnosticStatus::WARN;
+    status.message = "Warn";
+  } else {
+    status.level = DiagnosticStatus::ERROR;
+    status.message = "Error";
+  }
+  values[ValueIndex::Status].value = to_string(topic_status);
+
+  // Print the changes only, instead of throttling the messages of many topics
+  if (topic_status != prev_topic_statuses_[index]) {
+    prev_topic_statuses_[index] = topic_status;
+    if (topic_status == TopicStatus::NotReceived) {
+      RCLCPP_INFO(
+        get_logger(), "%s has not received. Set ERROR in diagnostics.", topic_param.topic.c_str());
+    } else if (topic_status == TopicStatus::WarnRate) {
+      RCLCPP_WARN(
+        get_logger(), "%s topic rate has dropped to the warning level. Set WARN in diagnostics.",
+        topic_param.topic.c_str());
+    } else if (topic_status == TopicStatus::ErrorRate) {
+      RCLCPP_WARN(
+        get_logger(), "%s topic rate has dropped to the error level. Set ERROR in diagnostics.",
+        topic_param.topic.c_str());
+    } else if (topic_status == TopicStatus::Timeout) {
+      RCLCPP_WARN(
+        get_logger(), "%s topic is timeout. Set ERROR in diagnostics.", topic_param.topic.c_str());
+    }
+  }
+
+  // Add key-value
+  format_value(values[ValueIndex::WarnRate].value, "%.2f [Hz]", param.warn_rate);
+  format_value(values[ValueIndex::ErrorRate].value, "%.2f [Hz]", param.error_rate);
+  format_value(values[ValueIndex::Timeout].value, "%.2f [s]", param.timeout);
+  format_value(values[ValueIndex::MeasuredRate].value, "%.2f [Hz]", topic_rate);
+  format_value(values[ValueIndex::Now].value, "%.2f [s]", now.seconds());
+  format_value(values[ValueIndex::LastMessageTime].value, "%.2f [s]", last_message_time.seconds());
+}
+
+}  // namespace autoware::topic_state_monitor
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(autoware::topic_state_monitor::MultiTopicStateMonitorNode)
@@ -14,33 +14,69 @@
 
 #include "autoware/topic_state_monitor/topic_state_monitor.hpp"
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 namespace autoware::topic_state_monitor
 {
 TopicStateMonitor::TopicStateMonitor(rclcpp::Node & node) : clock_(node.get_clock())
 {
 }
 
-void TopicStateMonitor::update()
+TopicStateMonitor::TopicStateMonitor(const rclcpp::Clock::SharedPtr & clock) : clock_(clock)
+{
+}
+
+void TopicStateMonitor::setParam(const Param & param)
 {
-  // Add data
-  last_message_time_ = clock_->now();
-  time_buffer_.push_back(last_message_time_);
+  param_ = param;
 
-  // Remove old data
-  while (static_cast<int>(time_buffer_.size()) > param_.window_size) {
-    time_buffer_.pop_front();
+  // Resize the buffer keeping the latest data
+  const auto capacity = static_cast<size_t>(std::max(param_.window_size, 1));
+  if (capacity == time_buffer_.size()) {
+    return;
+  }
+  std::vector<rclcpp::Time> time_buffer(capacity);
+  const auto size = std::min(time_buffer_size_, capacity);
+  for (size_t i = 0; i < size; ++i) {
+    const auto index = (time_buffer_head_ + time_buffer_.size() - size + i) % time_buffer_.size();
+    time_buffer[i] = time_buffer_[index];
   }
+  time_buffer_ = std::move(time_buffer);
+  time_buffer_head_ = size % capacity;
+  time_buffer_size_ = size;
+  topic_rate_ = calcTopicRate();
+}
+
+void TopicStateMonitor::update()
+{
+  update(clock_->now());
+}
+
+void TopicStateMonitor::update(const rclcpp::Time & stamp)
+{
+  // Add data, the oldest data is overwritten when the buffer is full
+  last_message_time_ = stamp;
+  time_buffer_[time_buffer_head_] = last_message_time_;
+  time_buffer_head_ = (time_buffer_head_ + 1) % time_buffer_.size();
+  time_buffer_size_ = std::min(time_buffer_size_ + 1, time_buffer_.size());
 
   // Calc topic rate
   topic_rate_ = calcTopicRate();
 }
 
 TopicStatus TopicStateMonitor::getTopicStatus() const
+{
+  return getTopicStatus(clock_->now());
+}
+
+TopicStatus TopicStateMonitor::getTopicStatus(const rclcpp::Time & now) const
 {
   if (isNotReceived()) {
     return TopicStatus::NotReceived;
   }
-  if (isTimeout()) {
+  if (isTimeout(now)) {
     return TopicStatus::Timeout;
   }
   if (isErrorRate()) {
@@ -52,23 +88,35 @@ TopicStatus TopicStateMonitor::getTopicStatus() const
   return TopicStatus::Ok;
 }
 
+const rclcpp::Time & TopicStateMonitor::oldestTime() const
+{
+  const auto capacity = time_buffer_.size();
+  return time_buffer_[(time_buffer_head_ + capacity - time_buffer_size_) % capacity];
+}
+
+const rclcpp::Time & TopicStateMonitor::latestTime() const
+{
+  const auto capacity = time_buffer_.size();
+  return time_buffer_[(time_buffer_head_ + capacity - 1) % capacity];
+}
+
 double TopicStateMonitor::calcTopicRate() const
 {
   // Output max_rate when topic rate can't be calculated.
   // In this case, it's assumed timeout is used instead.
-  if (time_buffer_.size() < 2) {
+  if (time_buffer_size_ < 2) {
     return TopicStateMonitor::max_rate;
   }
 
-  const auto time_diff = (time_buffer_.back() - time_buffer_.front()).seconds();
-  const auto num_intervals = time_buffer_.size() - 1;
+  const auto time_diff = (latestTime() - oldestTime()).seconds();
+  const auto num_intervals = time_buffer_size_ - 1;
 
   return static_cast<double>(num_intervals) / time_diff;
 }
 
 bool TopicStateMonitor::isNotReceived() const
 {
-  return time_buffer_.empty();
+  return time_buffer_size_ == 0;
 }
 
 bool TopicStateMonitor::isWarnRate() const
@@ -89,13 +137,13 @@ bool TopicStateMonitor::isErrorRate() const
   return getTopicRate() < param_.error_rate;
 }
 
-bool TopicStateMonitor::isTimeout() const
+bool TopicStateMonitor::isTimeout(const rclcpp::Time & now) const
 {
   if (param_.timeout == 0.0) {
     return false;
   }
 
-  const auto time_diff = (clock_->now() - time_buffer_.back()).seconds();
+  const auto time_diff = (now - latestTime()).seconds();
 
   return time_diff > param_.timeout;
 }